@@ -0,0 +1,68 @@
+#include <memory>
+#include <random>
+
+#include "benchmark/benchmark.h"
+
+#include "cache/cache.hpp"
+#include "cache/gdfs_cache.hpp"
+#include "cache/lru_k_cache.hpp"
+#include "cache/random_cache.hpp"
+#include "cache/sharded_cache.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto CACHE_CAPACITY = size_t{1024};
+
+// Twice as many keys as the cache can hold, so that about half of the lookups miss and lead to an insertion
+constexpr auto KEY_COUNT = 2 * static_cast<int>(CACHE_CAPACITY);
+
+std::shared_ptr<Cache<int, int>> benchmark_cache;  // NOLINT
+
+}  // namespace
+
+/**
+ * Measures the throughput of concurrent plan cache accesses, i.e., lookups of random keys that insert the key on a
+ * miss. All threads share one Cache that uses the given implementation. Compare the results for different thread
+ * counts to see how far the cache accesses serialize.
+ */
+template <typename CacheImpl>
+static void BM_CacheConcurrentAccess(benchmark::State& state) {  // NOLINT
+  if (state.thread_index == 0) {
+    benchmark_cache = std::make_shared<Cache<int, int>>();
+    benchmark_cache->replace_cache_impl<CacheImpl>(CACHE_CAPACITY);
+    for (auto key = 0; key < static_cast<int>(CACHE_CAPACITY); ++key) {
+      benchmark_cache->set(key, key);
+    }
+  }
+
+  auto generator = std::mt19937{static_cast<std::mt19937::result_type>(state.thread_index)};
+  auto distribution = std::uniform_int_distribution<>{0, KEY_COUNT - 1};
+
+  // The loop is entered by all threads at the same time, i.e., after thread 0 set up the cache
+  for (auto _ : state) {
+    const auto key = distribution(generator);
+    if (!benchmark_cache->try_get(key)) {
+      benchmark_cache->set(key, key);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations());
+
+  if (state.thread_index == 0) {
+    if (const auto sharded_cache = dynamic_cast<const ShardedCache<int, int>*>(&benchmark_cache->cache())) {
+      const auto metrics = sharded_cache->metrics();
+      state.counters["hit_rate"] = metrics.hit_rate();
+      state.counters["lock_contentions"] = static_cast<double>(metrics.lock_contention_count);
+    }
+    benchmark_cache.reset();
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_CacheConcurrentAccess, GDFSCache<int, int>)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_CacheConcurrentAccess, LRUKCache<2, int, int>)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_CacheConcurrentAccess, RandomCache<int, int>)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_CacheConcurrentAccess, ShardedCache<int, int>)->ThreadRange(1, 16)->UseRealTime();
+
+}  // namespace opossum
@@ -0,0 +1,95 @@
+#include <cxxopts.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "concurrency_benchmark_utils.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+/**
+ * Measures the commit throughput of the TransactionManager: An increasing number of clients, each in its own thread,
+ * repeatedly begins and commits a transaction. By default, the transactions are empty, so that only the commit
+ * pipeline (assigning commit ids and tracking active snapshots) is measured. Optionally, each transaction inserts a
+ * few rows, so that committing takes longer and more transactions share a commit id (group commit). For each number
+ * of clients, the commits per second, the measured mean latency of a transaction, and the mean number of transactions
+ * per commit id are reported.
+ */
+
+using namespace opossum;  // NOLINT
+
+int main(int argc, char* argv[]) {
+  auto cli_options = cxxopts::Options{"Hyrise Commit Concurrency Benchmark"};
+
+  add_concurrency_benchmark_options(cli_options, 128);
+
+  // clang-format off
+  cli_options.add_options()
+    ("rows_per_transaction", "Number of rows that each transaction inserts (0 for empty transactions)",
+     cxxopts::value<size_t>()->default_value("0"));
+  // clang-format on
+
+  const auto cli_parse_result = cli_options.parse(argc, argv);
+  if (cli_parse_result.count("help")) {
+    std::cout << cli_options.help() << std::endl;
+    return 0;
+  }
+
+  const auto max_client_count = cli_parse_result["max_clients"].as<size_t>();
+  const auto duration = std::chrono::seconds{cli_parse_result["duration"].as<size_t>()};
+  const auto rows_per_transaction = cli_parse_result["rows_per_transaction"].as<size_t>();
+
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+
+  std::cout << "- Committing transactions that insert " << rows_per_transaction << " row(s) each" << std::endl;
+  const auto columns = std::vector<ConcurrencyBenchmarkColumn>{
+      {"commits/s", 1}, {"mean latency [us]", 3}, {"transactions/commit id", 2}};
+  print_concurrency_benchmark_header(columns);
+
+  for_each_client_count(max_client_count, [&](const size_t client_count) {
+    const auto table_name = "commit_benchmark_" + std::to_string(client_count);
+    auto table_wrapper = std::shared_ptr<TableWrapper>{};
+    if (rows_per_transaction > 0) {
+      StorageManager::get().add_table(table_name,
+                                      std::make_shared<Table>(column_definitions, TableType::Data, Chunk::DEFAULT_SIZE,
+                                                              UseMvcc::Yes));
+
+      auto values = std::make_shared<Table>(column_definitions, TableType::Data);
+      for (auto row_index = size_t{0}; row_index < rows_per_transaction; ++row_index) {
+        values->append({static_cast<int32_t>(row_index)});
+      }
+      table_wrapper = std::make_shared<TableWrapper>(values);
+      table_wrapper->execute();
+    }
+
+    const auto first_commit_id = TransactionManager::get().last_commit_id();
+
+    const auto result = run_concurrent_clients(client_count, duration, [&](const size_t /* client_index */) {
+      const auto context = TransactionManager::get().new_transaction_context();
+      if (table_wrapper) {
+        const auto insert = std::make_shared<Insert>(table_name, table_wrapper);
+        insert->set_transaction_context(context);
+        insert->execute();
+      }
+      context->commit();
+    });
+
+    const auto mean_latency_us = std::chrono::duration<double, std::micro>{result.mean_latency()}.count();
+    const auto commit_id_count = TransactionManager::get().last_commit_id() - first_commit_id;
+    const auto transactions_per_commit_id =
+        commit_id_count > 0 ? static_cast<double>(result.operation_count) / static_cast<double>(commit_id_count) : 0.0;
+    print_concurrency_benchmark_row(client_count, columns,
+                                    {result.throughput(), mean_latency_us, transactions_per_commit_id});
+
+    if (rows_per_transaction > 0) StorageManager::get().drop_table(table_name);
+  });
+
+  return 0;
+}
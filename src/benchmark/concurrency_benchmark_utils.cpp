@@ -0,0 +1,105 @@
+#include "concurrency_benchmark_utils.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+constexpr auto CLIENT_COLUMN_WIDTH = 10;
+constexpr auto MIN_COLUMN_WIDTH = 16;
+
+int column_width(const opossum::ConcurrencyBenchmarkColumn& column) {
+  return std::max(MIN_COLUMN_WIDTH, static_cast<int>(column.name.size()) + 4);
+}
+
+}  // namespace
+
+namespace opossum {
+
+double ConcurrentClientsResult::throughput() const {
+  return elapsed.count() > 0 ? static_cast<double>(operation_count) / elapsed.count() : 0.0;
+}
+
+std::chrono::duration<double> ConcurrentClientsResult::mean_latency() const {
+  return operation_count > 0 ? total_latency / static_cast<double>(operation_count) : std::chrono::duration<double>{};
+}
+
+void add_concurrency_benchmark_options(cxxopts::Options& cli_options, const size_t default_max_client_count) {
+  // clang-format off
+  cli_options.add_options()
+    ("help", "print this help message")
+    ("max_clients", "Maximum number of concurrent clients, starting from one and doubling",
+     cxxopts::value<size_t>()->default_value(std::to_string(default_max_client_count)))
+    ("duration", "Seconds that each number of clients runs", cxxopts::value<size_t>()->default_value("5"));
+  // clang-format on
+}
+
+void for_each_client_count(const size_t max_client_count, const std::function<void(size_t)>& run) {
+  for (auto client_count = size_t{1}; client_count <= max_client_count; client_count *= 2) {
+    run(client_count);
+  }
+}
+
+ConcurrentClientsResult run_concurrent_clients(const size_t client_count, const std::chrono::seconds duration,
+                                               const std::function<void(size_t)>& operation) {
+  auto result = ConcurrentClientsResult{};
+  auto result_mutex = std::mutex{};
+
+  const auto start_time = std::chrono::steady_clock::now();
+  const auto end_time = start_time + duration;
+
+  auto client_threads = std::vector<std::thread>{};
+  for (auto client_index = size_t{0}; client_index < client_count; ++client_index) {
+    client_threads.emplace_back([&, client_index]() {
+      auto client_operation_count = size_t{0};
+      auto client_latency = std::chrono::steady_clock::duration{};
+
+      auto operation_start = std::chrono::steady_clock::now();
+      while (operation_start < end_time) {
+        operation(client_index);
+        const auto operation_end = std::chrono::steady_clock::now();
+
+        ++client_operation_count;
+        client_latency += operation_end - operation_start;
+        operation_start = operation_end;
+      }
+
+      const auto lock = std::lock_guard<std::mutex>{result_mutex};
+      result.operation_count += client_operation_count;
+      result.total_latency += client_latency;
+    });
+  }
+  for (auto& client_thread : client_threads) {
+    client_thread.join();
+  }
+
+  result.elapsed = std::chrono::steady_clock::now() - start_time;
+  return result;
+}
+
+void print_concurrency_benchmark_header(const std::vector<ConcurrencyBenchmarkColumn>& columns) {
+  std::cout << std::setw(CLIENT_COLUMN_WIDTH) << "clients";
+  for (const auto& column : columns) {
+    std::cout << std::setw(column_width(column)) << column.name;
+  }
+  std::cout << std::endl;
+}
+
+void print_concurrency_benchmark_row(const size_t client_count, const std::vector<ConcurrencyBenchmarkColumn>& columns,
+                                     const std::vector<double>& values) {
+  Assert(values.size() == columns.size(), "Expected one value per column");
+
+  std::cout << std::setw(CLIENT_COLUMN_WIDTH) << client_count << std::fixed;
+  for (auto column_idx = size_t{0}; column_idx < columns.size(); ++column_idx) {
+    std::cout << std::setw(column_width(columns[column_idx])) << std::setprecision(columns[column_idx].precision)
+              << values[column_idx];
+  }
+  std::cout << std::endl;
+}
+
+}  // namespace opossum
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cxxopts.hpp>
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace opossum {
+
+// Measurements of clients that concurrently execute the same operation, see run_concurrent_clients()
+struct ConcurrentClientsResult {
+  size_t operation_count{0};
+
+  // Time from starting the clients until the last one has finished its last operation
+  std::chrono::duration<double> elapsed{};
+
+  // Sum of the measured latencies of all operations
+  std::chrono::duration<double> total_latency{};
+
+  // Operations per second
+  double throughput() const;
+
+  std::chrono::duration<double> mean_latency() const;
+};
+
+// Adds the options shared by all concurrency benchmarks: help, max_clients, and duration
+void add_concurrency_benchmark_options(cxxopts::Options& cli_options, size_t default_max_client_count);
+
+// Calls run(client_count) for 1, 2, 4, ... up to max_client_count clients
+void for_each_client_count(size_t max_client_count, const std::function<void(size_t)>& run);
+
+// Starts client_count threads that call operation(client_index) over and over until duration has passed. Operations
+// that started before are completed, so the elapsed time is measured instead of assuming the duration.
+ConcurrentClientsResult run_concurrent_clients(size_t client_count, std::chrono::seconds duration,
+                                               const std::function<void(size_t)>& operation);
+
+struct ConcurrencyBenchmarkColumn {
+  std::string name;
+  int precision;
+};
+
+// Print the result table of a concurrency benchmark, with the number of clients as first column
+void print_concurrency_benchmark_header(const std::vector<ConcurrencyBenchmarkColumn>& columns);
+void print_concurrency_benchmark_row(size_t client_count, const std::vector<ConcurrencyBenchmarkColumn>& columns,
+                                     const std::vector<double>& values);
+
+}  // namespace opossum
@@ -0,0 +1,85 @@
+#include <cxxopts.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "concurrency/transaction_manager.hpp"
+#include "concurrency_benchmark_utils.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+/**
+ * Measures the throughput of small Inserts into the same table: An increasing number of clients, each in its own
+ * thread, repeatedly inserts a few rows in a transaction of its own. For each number of clients, the inserted rows per
+ * second and the mean latency of an Insert (including the commit) are reported, which shows how well concurrent Inserts
+ * into one table scale.
+ */
+
+using namespace opossum;  // NOLINT
+
+int main(int argc, char* argv[]) {
+  auto cli_options = cxxopts::Options{"Hyrise Insert Concurrency Benchmark"};
+  add_concurrency_benchmark_options(cli_options, 64);
+
+  // clang-format off
+  cli_options.add_options()
+    ("rows_per_insert", "Number of rows that each Insert adds", cxxopts::value<size_t>()->default_value("1"))
+    ("chunk_size", "Max chunk size of the target table",
+     cxxopts::value<ChunkOffset>()->default_value(std::to_string(Chunk::DEFAULT_SIZE)));
+  // clang-format on
+
+  const auto cli_parse_result = cli_options.parse(argc, argv);
+  if (cli_parse_result.count("help")) {
+    std::cout << cli_options.help() << std::endl;
+    return 0;
+  }
+
+  const auto max_client_count = cli_parse_result["max_clients"].as<size_t>();
+  const auto duration = std::chrono::seconds{cli_parse_result["duration"].as<size_t>()};
+  const auto rows_per_insert = cli_parse_result["rows_per_insert"].as<size_t>();
+  const auto chunk_size = cli_parse_result["chunk_size"].as<ChunkOffset>();
+
+  const auto column_definitions = TableColumnDefinitions{
+      {"a", DataType::Int, false}, {"b", DataType::Double, false}, {"c", DataType::String, true}};
+
+  std::cout << "- Inserting " << rows_per_insert << " row(s) per transaction into a table with a chunk size of "
+            << chunk_size << std::endl;
+  const auto columns = std::vector<ConcurrencyBenchmarkColumn>{{"rows/s", 1}, {"mean latency [us]", 3}};
+  print_concurrency_benchmark_header(columns);
+
+  for_each_client_count(max_client_count, [&](const size_t client_count) {
+    // Each number of clients starts with an empty table, so that the measurements are comparable
+    const auto table_name = "insert_benchmark_" + std::to_string(client_count);
+    StorageManager::get().add_table(
+        table_name, std::make_shared<Table>(column_definitions, TableType::Data, chunk_size, UseMvcc::Yes));
+
+    // The values are prepared up front, so that only the Insert and the commit are measured
+    auto values = std::make_shared<Table>(column_definitions, TableType::Data);
+    for (auto row_index = size_t{0}; row_index < rows_per_insert; ++row_index) {
+      values->append({static_cast<int32_t>(row_index), 0.5, pmr_string{"insert benchmark"}});
+    }
+    const auto table_wrapper = std::make_shared<TableWrapper>(values);
+    table_wrapper->execute();
+
+    const auto result = run_concurrent_clients(client_count, duration, [&](const size_t /* client_index */) {
+      const auto insert = std::make_shared<Insert>(table_name, table_wrapper);
+      const auto context = TransactionManager::get().new_transaction_context();
+      insert->set_transaction_context(context);
+      insert->execute();
+      context->commit();
+    });
+
+    const auto mean_latency_us = std::chrono::duration<double, std::micro>{result.mean_latency()}.count();
+    print_concurrency_benchmark_row(client_count, columns,
+                                    {result.throughput() * static_cast<double>(rows_per_insert), mean_latency_us});
+
+    StorageManager::get().drop_table(table_name);
+  });
+
+  return 0;
+}
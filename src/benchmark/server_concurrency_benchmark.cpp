@@ -0,0 +1,94 @@
+#include <boost/asio/io_service.hpp>
+#include <cxxopts.hpp>
+#include <pqxx/pqxx>
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "concurrency_benchmark_utils.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "server/server.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+/**
+ * A pgbench-style driver for the server: It starts a server with the given number of I/O threads within this process
+ * and lets an increasing number of clients run the same query over and over. For each number of clients, the query
+ * throughput and the mean latency are reported, which shows how connection handling scales with the number of clients.
+ * The default query returns few rows, so that the time is dominated by the network handling, not by the execution.
+ */
+
+using namespace opossum;  // NOLINT
+
+int main(int argc, char* argv[]) {
+  auto cli_options = cxxopts::Options{"Hyrise Server Concurrency Benchmark"};
+
+  add_concurrency_benchmark_options(cli_options, 256);
+
+  // clang-format off
+  cli_options.add_options()
+    ("io_threads", "Number of I/O threads of the server", cxxopts::value<size_t>()->default_value("4"))
+    ("rows", "Number of rows in the benchmark table", cxxopts::value<size_t>()->default_value("100000"))
+    ("query", "Query that the clients run",
+     cxxopts::value<std::string>()->default_value("SELECT a, b FROM server_benchmark WHERE a < 10;"));
+  // clang-format on
+
+  const auto cli_parse_result = cli_options.parse(argc, argv);
+  if (cli_parse_result.count("help")) {
+    std::cout << cli_options.help() << std::endl;
+    return 0;
+  }
+
+  const auto io_thread_count = cli_parse_result["io_threads"].as<size_t>();
+  const auto max_client_count = cli_parse_result["max_clients"].as<size_t>();
+  const auto duration = std::chrono::seconds{cli_parse_result["duration"].as<size_t>()};
+  const auto row_count = cli_parse_result["rows"].as<size_t>();
+  const auto query = cli_parse_result["query"].as<std::string>();
+
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}},
+                                       TableType::Data);
+  for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
+    table->append({static_cast<int32_t>(row_index), static_cast<int32_t>(row_index % 100)});
+  }
+  StorageManager::get().add_table("server_benchmark", table);
+
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  boost::asio::io_service io_service;
+  Server server{io_service, /* port = */ 0, io_thread_count};
+  auto accept_thread = std::thread{[&]() { io_service.run(); }};
+
+  const auto connection_string = "hostaddr=127.0.0.1 port=" + std::to_string(server.get_port_number());
+
+  std::cout << "- Running '" << query << "' with " << io_thread_count << " I/O thread(s)" << std::endl;
+  const auto columns = std::vector<ConcurrencyBenchmarkColumn>{{"queries/s", 1}, {"mean latency [ms]", 3}};
+  print_concurrency_benchmark_header(columns);
+
+  for_each_client_count(max_client_count, [&](const size_t client_count) {
+    // All clients connect before the measurement starts, so that establishing connections is not measured
+    auto connections = std::vector<std::unique_ptr<pqxx::connection>>{};
+    // Non-transactions are used because the regular transactions use SQL that we don't support
+    auto transactions = std::vector<std::unique_ptr<pqxx::nontransaction>>{};
+    for (auto client_index = size_t{0}; client_index < client_count; ++client_index) {
+      connections.emplace_back(std::make_unique<pqxx::connection>(connection_string));
+      transactions.emplace_back(std::make_unique<pqxx::nontransaction>(*connections.back()));
+    }
+
+    const auto result = run_concurrent_clients(client_count, duration, [&](const size_t client_index) {
+      transactions[client_index]->exec(query);
+    });
+
+    const auto mean_latency_ms = std::chrono::duration<double, std::milli>{result.mean_latency()}.count();
+    print_concurrency_benchmark_row(client_count, columns, {result.throughput(), mean_latency_ms});
+  });
+
+  io_service.stop();
+  accept_thread.join();
+
+  return 0;
+}
@@ -24,7 +24,7 @@ class BenchmarkConfig {
                   const Duration& warmup_duration, const std::optional<std::string>& output_file_path,
                   const bool enable_scheduler, const uint32_t cores, const uint32_t clients,
                   const bool enable_visualization, const bool verify, const bool cache_binary_tables,
-                  const bool enable_jit);
+                  const bool enable_jit, const bool enable_tiered_jit);
 
   static BenchmarkConfig get_default_config();
 
@@ -42,6 +42,8 @@ class BenchmarkConfig {
   bool verify = false;
   bool cache_binary_tables = false;
   bool enable_jit = false;
+  // Use JitExecutionMode::Tiered instead of compiling all jitted pipelines before their first execution
+  bool enable_tiered_jit = false;
 
   static const char* description;
 
@@ -10,6 +10,7 @@
 #include "benchmark_config.hpp"
 #include "benchmark_runner.hpp"
 #include "constant_mappings.hpp"
+#include "logical_query_plan/jit_aware_lqp_translator.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 #include "sql/create_sql_parser_error_message.hpp"
@@ -35,6 +36,11 @@ BenchmarkRunner::BenchmarkRunner(const BenchmarkConfig& config,
       _context(context) {
   SQLPipelineBuilder::default_pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
   SQLPipelineBuilder::default_lqp_cache = std::make_shared<SQLLogicalPlanCache>();
+#if HYRISE_JIT_SUPPORT
+  JitAwareLQPTranslator::default_pipeline_cache = std::make_shared<JitPipelineCache>();
+  JitAwareLQPTranslator::default_execution_mode =
+      config.enable_tiered_jit ? JitExecutionMode::Tiered : JitExecutionMode::Compile;
+#endif
 
   // Initialise the scheduler if the benchmark was requested to run multi-threaded
   if (config.enable_scheduler) {
@@ -385,7 +391,8 @@ cxxopts::Options BenchmarkRunner::get_basic_cli_options(const std::string& bench
 
   if constexpr (HYRISE_JIT_SUPPORT) {
     cli_options.add_options()
-      ("jit", "Enable just-in-time query compilation", cxxopts::value<bool>()->default_value("false")); // NOLINT
+      ("jit", "Enable just-in-time query compilation", cxxopts::value<bool>()->default_value("false")) // NOLINT
+      ("jit_tiered", "Interpret jitted pipelines until they are hot and compile them in the background", cxxopts::value<bool>()->default_value("false")); // NOLINT
   }
   // clang-format on
 
@@ -422,6 +429,7 @@ nlohmann::json BenchmarkRunner::create_context(const BenchmarkConfig& config) {
       {"warmup_duration", std::chrono::duration_cast<std::chrono::nanoseconds>(config.warmup_duration).count()},
       {"using_scheduler", config.enable_scheduler},
       {"using_jit", config.enable_jit},
+      {"using_tiered_jit", config.enable_tiered_jit},
       {"cores", config.cores},
       {"clients", config.clients},
       {"verify", config.verify},
@@ -134,14 +134,19 @@ BenchmarkConfig CLIConfigParser::parse_basic_options_json_config(const nlohmann:
   }
 
   auto enable_jit = false;
+  auto enable_tiered_jit = false;
   if constexpr (HYRISE_JIT_SUPPORT) {
     enable_jit = json_config.value("jit", default_config.enable_jit);
+    enable_tiered_jit = json_config.value("jit_tiered", default_config.enable_tiered_jit);
   }
   std::cout << "- JIT is " << (enable_jit ? "enabled" : "disabled") << std::endl;
+  if (enable_jit && enable_tiered_jit) {
+    std::cout << "- JIT pipelines are interpreted until they are hot and then compiled in the background" << std::endl;
+  }
 
-  return BenchmarkConfig{benchmark_mode,       chunk_size,       *encoding_config,    max_runs,  timeout_duration,
-                         warmup_duration,      output_file_path, enable_scheduler,    cores,     clients,
-                         enable_visualization, verify,           cache_binary_tables, enable_jit};
+  return BenchmarkConfig{benchmark_mode,       chunk_size,       *encoding_config,    max_runs,   timeout_duration,
+                         warmup_duration,      output_file_path, enable_scheduler,    cores,      clients,
+                         enable_visualization, verify,           cache_binary_tables, enable_jit, enable_tiered_jit};
 }
 
 BenchmarkConfig CLIConfigParser::parse_basic_cli_options(const cxxopts::ParseResult& parse_result) {
@@ -167,6 +172,7 @@ nlohmann::json CLIConfigParser::basic_cli_options_to_json(const cxxopts::ParseRe
   json_config.emplace("cache_binary_tables", parse_result["cache_binary_tables"].as<bool>());
   if constexpr (HYRISE_JIT_SUPPORT) {
     json_config.emplace("jit", parse_result["jit"].as<bool>());
+    json_config.emplace("jit_tiered", parse_result["jit_tiered"].as<bool>());
   }
 
   return json_config;
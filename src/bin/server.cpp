@@ -1,8 +1,10 @@
 #include <boost/asio/io_service.hpp>
 
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
+#include <thread>
 
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
@@ -11,6 +13,7 @@
 #include "storage/storage_manager.hpp"
 #include "utils/load_table.hpp"
 
+// usage: hyriseServer [port] [number of I/O threads]
 int main(int argc, char* argv[]) {
   uint16_t port = 5432;
 
@@ -22,6 +25,18 @@ int main(int argc, char* argv[]) {
     port = static_cast<uint16_t>(port_long);
   }
 
+  // The I/O threads parse the requests and serialize the results of the sessions, while the queries are executed by
+  // the scheduler's workers. A quarter of the cores is enough to keep the workers busy with several hundred clients.
+  auto io_thread_count = std::max(size_t{1}, static_cast<size_t>(std::thread::hardware_concurrency() / 4));
+
+  if (argc >= 3) {
+    char* endptr{nullptr};
+    errno = 0;
+    auto io_thread_count_long = std::strtol(argv[2], &endptr, 10);
+    Assert(errno == 0 && io_thread_count_long > 0 && *endptr == 0, "invalid number of I/O threads");
+    io_thread_count = static_cast<size_t>(io_thread_count_long);
+  }
+
   // Set scheduler so that the server can execute the tasks on separate threads.
   opossum::CurrentScheduler::set(std::make_shared<opossum::NodeQueueScheduler>());
 
@@ -29,8 +44,9 @@ int main(int argc, char* argv[]) {
 
   // The server registers itself to the boost io_service. The io_service is the main IO control unit here and it lives
   // until the server doesn't request any IO any more, i.e. is has terminated. The server requests IO in its
-  // constructor and then runs forever.
-  opossum::Server server{io_service, port};
+  // constructor and then runs forever. The io_service only accepts new connections, the sessions run on the server's
+  // I/O threads.
+  opossum::Server server{io_service, port, io_thread_count};
 
   io_service.run();
 
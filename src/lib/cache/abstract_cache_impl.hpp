@@ -2,6 +2,8 @@
 
 #include <boost/iterator/iterator_facade.hpp>
 
+#include <atomic>
+#include <optional>
 #include <utility>
 
 namespace opossum {
@@ -52,6 +54,12 @@ class AbstractCacheImpl {
   // Returns true if the cache holds an item at the given key.
   virtual bool has(const Key& key) const = 0;
 
+  // Returns a copy of the cached value at the given key if there is one.
+  virtual std::optional<Value> try_get(const Key& key) {
+    if (!has(key)) return std::nullopt;
+    return get(key);
+  }
+
   // Returns the number of elements currently held in the cache.
   virtual size_t size() const = 0;
 
@@ -64,6 +72,9 @@ class AbstractCacheImpl {
   virtual ErasedIterator begin() = 0;
   virtual ErasedIterator end() = 0;
 
+  // Returns true if the implementation synchronizes concurrent accesses itself. Otherwise, Cache serializes them.
+  virtual bool is_thread_safe() const { return false; }
+
   // Return the capacity of the cache.
   size_t capacity() const { return _capacity; }
 
@@ -71,7 +82,8 @@ class AbstractCacheImpl {
   // Remove an element from the cache according to the cache algorithm's strategy
   virtual void _evict() = 0;
 
-  size_t _capacity;
+  // Atomic, as Cache reads it without a lock for thread-safe implementations while they might be resized
+  std::atomic_size_t _capacity;
 };
 
 }  // namespace opossum
@@ -9,6 +9,7 @@
 
 #include "gdfs_cache.hpp"
 
+#include "utils/assert.hpp"
 #include "utils/singleton.hpp"
 
 namespace opossum {
@@ -30,7 +31,7 @@ class Cache {
   void set(const Key& query, const Value& value) {
     if (_impl->capacity() == 0) return;
 
-    std::lock_guard<std::mutex> lock(_mutex);
+    const auto lock = _lock();
     _impl->set(query, value);
   }
 
@@ -39,27 +40,29 @@ class Cache {
   std::optional<Value> try_get(const Key& query) {
     if (_impl->capacity() == 0) return {};
 
-    std::lock_guard<std::mutex> lock(_mutex);
-    if (!_impl->has(query)) {
-      return {};
-    }
-    return _impl->get(query);
+    const auto lock = _lock();
+    return _impl->try_get(query);
   }
 
   // Checks whether an entry for the query exists.
   bool has(const Key& query) const { return _impl->has(query); }
 
   // Returns and refreshes the cache entry for the given query.
-  // Causes undefined behavior if the query is not in the cache.
+  // Must not be called if the query is not in the cache. As get() of the underlying cache returns a reference that a
+  // concurrent set() might invalidate, the entry is copied by try_get() instead.
   Value get_entry(const Key& query) {
-    std::lock_guard<std::mutex> lock(_mutex);
-    return _impl->get(query);
+    auto value = try_get(query);
+    DebugAssert(value, "Query is not in the cache");
+    return std::move(*value);
   }
 
   // Purges all entries from the cache.
   void clear() { _impl->clear(); }
 
-  void resize(size_t capacity) { _impl->resize(capacity); }
+  void resize(size_t capacity) {
+    const auto lock = _lock();
+    _impl->resize(capacity);
+  }
 
   size_t size() const { return _impl->size(); }
 
@@ -79,6 +82,11 @@ class Cache {
   Iterator end() { return _impl->end(); }
 
  protected:
+  // Thread-safe implementations (e.g., ShardedCache) synchronize accesses themselves, all others are serialized here
+  std::unique_lock<std::mutex> _lock() {
+    return _impl->is_thread_safe() ? std::unique_lock<std::mutex>{} : std::unique_lock<std::mutex>{_mutex};
+  }
+
   // Underlying cache eviction strategy.
   std::unique_ptr<AbstractCacheImpl<Key, Value>> _impl;
 
@@ -0,0 +1,291 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>  // NOLINT lint thinks this is a C header or something
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "abstract_cache_impl.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// Thread-safe cache implementation for caches that are accessed by many threads (e.g., the plan caches of the server).
+// The keys are distributed over independent shards, each protected by its own std::shared_mutex. Within a shard, the
+// CLOCK policy (an approximation of LRU) decides which entry to evict. Unlike in the other policies, a hit does not
+// reorder any data structure but only sets the entry's reference bit atomically, so lookups only need the shard's
+// shared lock and do not block each other.
+//
+// The capacity is distributed over the shards and enforced per shard. To keep small caches exact, every shard gets a
+// capacity of at least MIN_SHARD_CAPACITY, i.e., caches smaller than twice that have a single shard.
+template <typename Key, typename Value>
+class ShardedCache : public AbstractCacheImpl<Key, Value> {
+ public:
+  using typename AbstractCacheImpl<Key, Value>::KeyValuePair;
+  using typename AbstractCacheImpl<Key, Value>::AbstractIterator;
+  using typename AbstractCacheImpl<Key, Value>::ErasedIterator;
+
+  static constexpr size_t DEFAULT_MAX_SHARD_COUNT = 16;
+  static constexpr size_t MIN_SHARD_CAPACITY = 64;
+
+  // Counters summed up over all shards. Lock contentions are acquisitions of a shard lock that had to wait.
+  struct Metrics {
+    size_t hit_count{0};
+    size_t miss_count{0};
+    size_t lock_contention_count{0};
+
+    double hit_rate() const {
+      const auto lookup_count = hit_count + miss_count;
+      return lookup_count == 0 ? 0.0 : static_cast<double>(hit_count) / static_cast<double>(lookup_count);
+    }
+  };
+
+ protected:
+  struct Slot {
+    Slot(const Key& key, const Value& value) : key_value(key, value), referenced(false) {}
+    Slot(Slot&& other) : key_value(std::move(other.key_value)), referenced(other.referenced.load()) {}
+
+    Slot& operator=(Slot&& other) {
+      key_value = std::move(other.key_value);
+      referenced = other.referenced.load();
+      return *this;
+    }
+
+    KeyValuePair key_value;
+    std::atomic_bool referenced;
+  };
+
+  struct Shard {
+    mutable std::shared_mutex mutex;
+    size_t capacity{0};
+
+    std::vector<Slot> slots;
+    std::unordered_map<Key, size_t> slot_by_key;
+    size_t clock_hand{0};
+
+    mutable std::atomic_size_t hit_count{0};
+    mutable std::atomic_size_t miss_count{0};
+    mutable std::atomic_size_t lock_contention_count{0};
+  };
+
+ public:
+  // Iterates over the entries of all shards. Like the iterators of the other policies, it must not be used while the
+  // cache is modified.
+  class Iterator : public AbstractIterator {
+   public:
+    Iterator(const std::vector<std::unique_ptr<Shard>>& shards, const size_t shard_idx)
+        : _shards(shards), _shard_idx(shard_idx) {
+      _skip_empty_shards();
+    }
+
+   private:
+    friend class boost::iterator_core_access;
+    friend class AbstractCacheImpl<Key, Value>::ErasedIterator;
+
+    const std::vector<std::unique_ptr<Shard>>& _shards;
+    size_t _shard_idx;
+    size_t _slot_idx{0};
+
+    void _skip_empty_shards() {
+      while (_shard_idx < _shards.size() && _slot_idx == _shards[_shard_idx]->slots.size()) {
+        ++_shard_idx;
+        _slot_idx = 0;
+      }
+    }
+
+    void increment() {
+      ++_slot_idx;
+      _skip_empty_shards();
+    }
+
+    bool equal(const AbstractIterator& other) const {
+      const auto& other_iterator = static_cast<const Iterator&>(other);
+      return _shard_idx == other_iterator._shard_idx && _slot_idx == other_iterator._slot_idx;
+    }
+
+    const KeyValuePair& dereference() const { return _shards[_shard_idx]->slots[_slot_idx].key_value; }
+  };
+
+  explicit ShardedCache(size_t capacity, size_t max_shard_count = DEFAULT_MAX_SHARD_COUNT)
+      : AbstractCacheImpl<Key, Value>(capacity) {
+    const auto shard_count = std::clamp(capacity / MIN_SHARD_CAPACITY, size_t{1}, std::max(max_shard_count, size_t{1}));
+    _shards.reserve(shard_count);
+    for (auto shard_idx = size_t{0}; shard_idx < shard_count; ++shard_idx) {
+      _shards.emplace_back(std::make_unique<Shard>());
+    }
+    _distribute_capacity();
+  }
+
+  // Sets the value to be cached at the given key.
+  void set(const Key& key, const Value& value, double cost = 1.0, double size = 1.0) {
+    auto& shard = _shard(key);
+    auto lock = _lock<std::unique_lock<std::shared_mutex>>(shard);
+
+    const auto iter = shard.slot_by_key.find(key);
+    if (iter != shard.slot_by_key.end()) {
+      auto& slot = shard.slots[iter->second];
+      slot.key_value.second = value;
+      slot.referenced = true;
+      return;
+    }
+
+    if (shard.capacity == 0) return;
+
+    if (shard.slots.size() < shard.capacity) {
+      shard.slot_by_key.emplace(key, shard.slots.size());
+      shard.slots.emplace_back(key, value);
+      return;
+    }
+
+    // Replace the entry chosen by the clock
+    const auto slot_idx = _clock_victim(shard);
+    shard.slot_by_key.erase(shard.slots[slot_idx].key_value.first);
+    shard.slots[slot_idx] = Slot{key, value};
+    shard.slot_by_key.emplace(key, slot_idx);
+  }
+
+  // Retrieves the value cached at the key.
+  // Causes undefined behavior if the key is not in the cache. As the entry might be evicted by a concurrent call of
+  // set(), the returned reference is only safe to use if there is none. Use try_get() otherwise.
+  Value& get(const Key& key) {
+    auto& shard = _shard(key);
+    auto lock = _lock<std::shared_lock<std::shared_mutex>>(shard);
+
+    auto& slot = shard.slots[shard.slot_by_key.find(key)->second];
+    slot.referenced.store(true, std::memory_order_relaxed);
+    shard.hit_count.fetch_add(1, std::memory_order_relaxed);
+    return slot.key_value.second;
+  }
+
+  std::optional<Value> try_get(const Key& key) {
+    auto& shard = _shard(key);
+    auto lock = _lock<std::shared_lock<std::shared_mutex>>(shard);
+
+    const auto iter = shard.slot_by_key.find(key);
+    if (iter == shard.slot_by_key.end()) {
+      shard.miss_count.fetch_add(1, std::memory_order_relaxed);
+      return std::nullopt;
+    }
+
+    auto& slot = shard.slots[iter->second];
+    slot.referenced.store(true, std::memory_order_relaxed);
+    shard.hit_count.fetch_add(1, std::memory_order_relaxed);
+    return slot.key_value.second;
+  }
+
+  bool has(const Key& key) const {
+    const auto& shard = _shard(key);
+    auto lock = _lock<std::shared_lock<std::shared_mutex>>(shard);
+    return shard.slot_by_key.find(key) != shard.slot_by_key.end();
+  }
+
+  size_t size() const {
+    auto size = size_t{0};
+    for (const auto& shard : _shards) {
+      auto lock = _lock<std::shared_lock<std::shared_mutex>>(*shard);
+      size += shard->slots.size();
+    }
+    return size;
+  }
+
+  void clear() {
+    for (const auto& shard : _shards) {
+      auto lock = _lock<std::unique_lock<std::shared_mutex>>(*shard);
+      shard->slots.clear();
+      shard->slot_by_key.clear();
+      shard->clock_hand = 0;
+    }
+  }
+
+  // The number of shards is fixed at construction, only their capacities change
+  void resize(size_t capacity) {
+    const auto lock = std::lock_guard<std::mutex>{_resize_mutex};
+    this->_capacity = capacity;
+    _distribute_capacity();
+  }
+
+  bool is_thread_safe() const { return true; }
+
+  Metrics metrics() const {
+    auto metrics = Metrics{};
+    for (const auto& shard : _shards) {
+      metrics.hit_count += shard->hit_count.load();
+      metrics.miss_count += shard->miss_count.load();
+      metrics.lock_contention_count += shard->lock_contention_count.load();
+    }
+    return metrics;
+  }
+
+  size_t shard_count() const { return _shards.size(); }
+
+  ErasedIterator begin() { return ErasedIterator{std::make_unique<Iterator>(_shards, 0)}; }
+
+  ErasedIterator end() { return ErasedIterator{std::make_unique<Iterator>(_shards, _shards.size())}; }
+
+ protected:
+  std::vector<std::unique_ptr<Shard>> _shards;
+
+  // Serializes concurrent calls of resize(), which would otherwise interleave their per-shard capacities
+  std::mutex _resize_mutex;
+
+  Shard& _shard(const Key& key) const { return *_shards[std::hash<Key>{}(key) % _shards.size()]; }
+
+  // Acquires the shard's lock and counts the acquisitions that had to wait
+  template <typename Lock>
+  static Lock _lock(const Shard& shard) {
+    auto lock = Lock{shard.mutex, std::try_to_lock};
+    if (!lock.owns_lock()) {
+      shard.lock_contention_count.fetch_add(1, std::memory_order_relaxed);
+      lock.lock();
+    }
+    return lock;
+  }
+
+  // Advances the clock hand to the first entry that was not referenced since the hand last passed it, clearing the
+  // reference bits on the way. Expects the shard's exclusive lock to be held.
+  static size_t _clock_victim(Shard& shard) {
+    while (shard.slots[shard.clock_hand].referenced.exchange(false)) {
+      shard.clock_hand = (shard.clock_hand + 1) % shard.slots.size();
+    }
+
+    const auto victim_idx = shard.clock_hand;
+    shard.clock_hand = (shard.clock_hand + 1) % shard.slots.size();
+    return victim_idx;
+  }
+
+  // Removes the entry chosen by the clock. Expects the shard's exclusive lock to be held.
+  static void _evict_from(Shard& shard) {
+    const auto victim_idx = _clock_victim(shard);
+    shard.slot_by_key.erase(shard.slots[victim_idx].key_value.first);
+    shard.slots.erase(shard.slots.begin() + victim_idx);
+
+    for (auto slot_idx = victim_idx; slot_idx < shard.slots.size(); ++slot_idx) {
+      shard.slot_by_key[shard.slots[slot_idx].key_value.first] = slot_idx;
+    }
+    shard.clock_hand = shard.slots.empty() ? 0 : victim_idx % shard.slots.size();
+  }
+
+  // Evictions happen per shard in set() and _distribute_capacity(), see _evict_from()
+  void _evict() { Fail("ShardedCache only evicts from single shards"); }
+
+  void _distribute_capacity() {
+    const auto shard_count = _shards.size();
+    for (auto shard_idx = size_t{0}; shard_idx < shard_count; ++shard_idx) {
+      auto& shard = *_shards[shard_idx];
+      auto lock = _lock<std::unique_lock<std::shared_mutex>>(shard);
+
+      shard.capacity = this->_capacity / shard_count + (shard_idx < this->_capacity % shard_count ? 1 : 0);
+      while (shard.slots.size() > shard.capacity) {
+        _evict_from(shard);
+      }
+    }
+  }
+};
+
+}  // namespace opossum
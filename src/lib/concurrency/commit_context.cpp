@@ -5,25 +5,49 @@
 
 namespace opossum {
 
-CommitContext::CommitContext(const CommitID commit_id) : _commit_id{commit_id}, _pending{false} {}
+CommitContext::CommitContext(const CommitID commit_id, const bool sealed)
+    : _commit_id{commit_id}, _state{sealed ? SEALED_FLAG : 0} {}
 
 CommitID CommitContext::commit_id() const { return _commit_id; }
 
-bool CommitContext::is_pending() const { return _pending; }
+bool CommitContext::try_join() {
+  auto state = _state.load();
+  do {
+    if (state & SEALED_FLAG) return false;
+  } while (!_state.compare_exchange_weak(state, (state | JOINED_FLAG) + 1));
+
+  return true;
+}
+
+bool CommitContext::try_seal() {
+  auto state = _state.load();
+  do {
+    if (!(state & JOINED_FLAG)) return false;
+    if (state & SEALED_FLAG) return true;
+  } while (!_state.compare_exchange_weak(state, state | SEALED_FLAG));
+
+  return true;
+}
+
+bool CommitContext::is_pending() const { return _state == (SEALED_FLAG | JOINED_FLAG); }
 
 void CommitContext::make_pending(const TransactionID transaction_id,
                                  const std::function<void(TransactionID)>& callback) {
   if (callback) {
-    _callback = [callback, transaction_id]() { callback(transaction_id); };
+    _callbacks.push_back([callback, transaction_id]() { callback(transaction_id); });
   }
 
-  // This line MUST be AFTER setting the callback. Otherwise we run into a race condition while committing, because this
-  // is 'pending' but the callback is not there yet.
-  _pending = true;
+  // This line MUST be AFTER adding the callback. Otherwise we run into a race condition while committing, because the
+  // context might be pending but the callback is not there yet.
+  const auto previous_state = _state--;
+  DebugAssert((previous_state & JOINED_FLAG) && (previous_state & ~(SEALED_FLAG | JOINED_FLAG)) > 0,
+              "Only transactions that joined the commit context can be marked as pending.");
 }
 
 void CommitContext::fire_callback() {
-  if (_callback) _callback();
+  for (const auto& callback : _callbacks) {
+    callback();
+  }
 }
 
 bool CommitContext::has_next() const { return next() != nullptr; }
@@ -4,6 +4,8 @@
 #include <functional>
 #include <memory>
 
+#include "tbb/concurrent_vector.h"
+
 #include "types.hpp"
 
 namespace opossum {
@@ -13,18 +15,41 @@ namespace opossum {
  * Its main purpose is to manage commit ids.
  * It is effectively part of the TransactionContext
  *
+ * A commit context is an epoch of a group commit: All transactions that join it share its commit id and become
+ * visible at the same time. Transactions join the youngest commit context until it is sealed, which happens as soon as
+ * its predecessor has been committed. Thus, while the transactions of one commit context write their commit ids,
+ * transactions that want to commit in the meantime gather in the next one. When the system is idle, every transaction
+ * seals its commit context right away and has a commit id of its own.
+ *
  * Should not be used outside the concurrency module!
  */
 class CommitContext : private Noncopyable {
  public:
-  explicit CommitContext(const CommitID commit_id);
+  /**
+   * @param sealed should only be true for the initial context of the TransactionManager, which has nothing to commit
+   */
+  explicit CommitContext(const CommitID commit_id, const bool sealed = false);
 
   CommitID commit_id() const;
 
+  /**
+   * Adds a transaction to the context. Returns false if the context has already been sealed.
+   */
+  bool try_join();
+
+  /**
+   * Seals the context, so that no more transactions can join it, unless no transaction has joined it yet.
+   * Returns whether the context is sealed.
+   */
+  bool try_seal();
+
+  /**
+   * True if the context has been sealed and all its transactions are pending
+   */
   bool is_pending() const;
 
   /**
-   * Marks the commit context as “pending”, i.e. ready to be committed
+   * Marks a transaction of the context as “pending”, i.e. ready to be committed
    * as soon as all previous pending have been committed.
    *
    * @param callback called when transaction is committed
@@ -32,7 +57,7 @@ class CommitContext : private Noncopyable {
   void make_pending(const TransactionID transaction_id, const std::function<void(TransactionID)>& callback = nullptr);
 
   /**
-   * Calls the callback of make_pending
+   * Calls the callbacks of make_pending
    */
   void fire_callback();
 
@@ -49,9 +74,14 @@ class CommitContext : private Noncopyable {
   bool try_set_next(const std::shared_ptr<CommitContext>& next);
 
  private:
+  static constexpr auto SEALED_FLAG = uint64_t{1} << 63;
+  static constexpr auto JOINED_FLAG = uint64_t{1} << 62;
+
   const CommitID _commit_id;
-  std::atomic<bool> _pending;  // true if context is waiting to be committed
+  // Flags whether the context has been sealed and whether a transaction has joined it. The remaining bits count the
+  // transactions that joined but are not pending yet.
+  std::atomic<uint64_t> _state;
   std::shared_ptr<CommitContext> _next;
-  std::function<void()> _callback;
+  tbb::concurrent_vector<std::function<void()>> _callbacks;
 };
 }  // namespace opossum
@@ -13,10 +13,9 @@ namespace opossum {
 TransactionContext::TransactionContext(const TransactionID transaction_id, const CommitID snapshot_commit_id)
     : _transaction_id{transaction_id},
       _snapshot_commit_id{snapshot_commit_id},
+      _snapshot_slot{TransactionManager::get()._register_transaction(snapshot_commit_id)},
       _phase{TransactionPhase::Active},
-      _num_active_operators{0} {
-  TransactionManager::get()._register_transaction(snapshot_commit_id);
-}
+      _num_active_operators{0} {}
 
 TransactionContext::~TransactionContext() {
   DebugAssert(([this]() {
@@ -46,7 +45,7 @@ TransactionContext::~TransactionContext() {
    * Tell the TransactionManager, which keeps track of active snapshot-commit-ids,
    * that this transaction has finished.
    */
-  TransactionManager::get()._deregister_transaction(_snapshot_commit_id);
+  TransactionManager::get()._deregister_transaction(*_snapshot_slot);
 }
 
 TransactionID TransactionContext::transaction_id() const { return _transaction_id; }
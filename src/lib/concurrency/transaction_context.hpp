@@ -134,7 +134,7 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
 
   /**
    * Sets transaction phase to Committing.
-   * Creates a new commit context and assigns a new commit id.
+   * Joins the youngest commit context and thereby gets a commit id, which it might share with other transactions.
    * All operators within this context must be finished and
    * none of the registered operators should have failed when
    * calling this function.
@@ -164,6 +164,8 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
  private:
   const TransactionID _transaction_id;
   const CommitID _snapshot_commit_id;
+  // The slot in which the TransactionManager tracks the snapshot commit id while the transaction is active
+  std::atomic<CommitID>* const _snapshot_slot;
 
   std::vector<std::shared_ptr<AbstractReadWriteOperator>> _rw_operators;
 
@@ -1,5 +1,8 @@
 #include "transaction_manager.hpp"
 
+#include <algorithm>
+#include <memory>
+
 #include "commit_context.hpp"
 #include "storage/mvcc_data.hpp"
 #include "transaction_context.hpp"
@@ -11,15 +14,15 @@ void TransactionManager::reset() {
   auto& manager = get();
   manager._next_transaction_id = INITIAL_TRANSACTION_ID;
   manager._last_commit_id = INITIAL_COMMIT_ID;
-  manager._last_commit_context = std::make_shared<CommitContext>(INITIAL_COMMIT_ID);
-  Assert(manager._active_snapshot_commit_ids.empty(),
+  manager._last_commit_context = std::make_shared<CommitContext>(INITIAL_COMMIT_ID, true);
+  Assert(!manager.get_lowest_active_snapshot_commit_id(),
          "Some transactions do not seem to have finished yet as they are still registered as active.");
 }
 
 TransactionManager::TransactionManager()
     : _next_transaction_id{INITIAL_TRANSACTION_ID},
       _last_commit_id{INITIAL_COMMIT_ID},
-      _last_commit_context{std::make_shared<CommitContext>(INITIAL_COMMIT_ID)} {}
+      _last_commit_context{std::make_shared<CommitContext>(INITIAL_COMMIT_ID, true)} {}
 
 CommitID TransactionManager::last_commit_id() const { return _last_commit_id; }
 
@@ -28,76 +31,98 @@ std::shared_ptr<TransactionContext> TransactionManager::new_transaction_context(
   return std::make_shared<TransactionContext>(_next_transaction_id++, snapshot_commit_id);
 }
 
-void TransactionManager::_register_transaction(const CommitID snapshot_commit_id) {
-  std::unique_lock<std::mutex> lock(_mutex_active_snapshot_commit_ids);
-  _active_snapshot_commit_ids.insert(snapshot_commit_id);
-}
-
-void TransactionManager::_deregister_transaction(const CommitID snapshot_commit_id) {
-  std::unique_lock<std::mutex> lock(_mutex_active_snapshot_commit_ids);
-
-  auto it = std::find(_active_snapshot_commit_ids.begin(), _active_snapshot_commit_ids.end(), snapshot_commit_id);
+std::atomic<CommitID>* TransactionManager::_register_transaction(const CommitID snapshot_commit_id) {
+  const auto try_claim = [&](std::atomic<CommitID>& snapshot_slot) {
+    auto expected_snapshot_commit_id = UNUSED_SNAPSHOT_SLOT;
+    return snapshot_slot == UNUSED_SNAPSHOT_SLOT &&
+           snapshot_slot.compare_exchange_strong(expected_snapshot_commit_id, snapshot_commit_id);
+  };
+
+  // Threads usually run one transaction after the other, so that the slot they used last is free again. Thus, slots
+  // are effectively per thread and only contended for when there are more active transactions than threads.
+  thread_local auto* preferred_snapshot_slot = static_cast<std::atomic<CommitID>*>(nullptr);
+  if (preferred_snapshot_slot && try_claim(*preferred_snapshot_slot)) return preferred_snapshot_slot;
+
+  auto* block = &_first_snapshot_slot_block;
+  while (true) {
+    for (auto& slot : block->slots) {
+      if (try_claim(slot.snapshot_commit_id)) {
+        preferred_snapshot_slot = &slot.snapshot_commit_id;
+        return preferred_snapshot_slot;
+      }
+    }
 
-  if (it != _active_snapshot_commit_ids.end()) {
-    _active_snapshot_commit_ids.erase(it);
-    return;
+    auto* next_block = block->next.load();
+    if (!next_block) {
+      auto new_block = std::make_unique<SnapshotSlotBlock>();
+      // If another thread appended a block in the meantime, next_block points to it and ours is discarded
+      if (block->next.compare_exchange_strong(next_block, new_block.get())) next_block = new_block.release();
+    }
+    block = next_block;
   }
+}
 
-  Assert(
-      it == _active_snapshot_commit_ids.end(),
-      "Could not find snapshot_commit_id in TransactionManager's _active_snapshot_commit_ids. Therefore, the removal "
-      "failed and the function should not have been called.");
+void TransactionManager::_deregister_transaction(std::atomic<CommitID>& snapshot_slot) {
+  Assert(snapshot_slot != UNUSED_SNAPSHOT_SLOT,
+         "The snapshot slot is not in use. Therefore, the removal failed and the function should not have been "
+         "called.");
+  snapshot_slot = UNUSED_SNAPSHOT_SLOT;
 }
 
 std::optional<CommitID> TransactionManager::get_lowest_active_snapshot_commit_id() const {
-  std::unique_lock<std::mutex> lock(_mutex_active_snapshot_commit_ids);
+  auto lowest_snapshot_commit_id = UNUSED_SNAPSHOT_SLOT;
+  for (const auto* block = &_first_snapshot_slot_block; block; block = block->next.load()) {
+    for (const auto& slot : block->slots) {
+      lowest_snapshot_commit_id = std::min(lowest_snapshot_commit_id, slot.snapshot_commit_id.load());
+    }
+  }
 
-  if (_active_snapshot_commit_ids.empty()) {
+  if (lowest_snapshot_commit_id == UNUSED_SNAPSHOT_SLOT) {
     return std::nullopt;
   }
 
-  auto it = std::min_element(_active_snapshot_commit_ids.begin(), _active_snapshot_commit_ids.end());
-  return *it;
+  return lowest_snapshot_commit_id;
 }
 
 /**
  * Logic of the lock-free algorithm
  *
- * Let’s say n threads call this method simultaneously. They all enter the main while-loop.
- * Eventually they reach the point where they try to set the successor of _last_commit_context
- * (pointed to by current_context). Only one of them will succeed and will be able to pass the
- * following if statement. The rest continues with the loop and will now try to get the latest
- * context, which does not have a successor. As long as the thread that succeeded setting
- * the next commit context has not finished updating _last_commit_context, they are stuck in
- * the small while-loop. As soon as it is done, _last_commit_context will point to a commit
- * context with no successor and they will be able to leave this loop.
+ * Transactions join the youngest commit context (_last_commit_context) until it is sealed. If it has been sealed, the
+ * n threads that fail to join it try to set its successor. Only one of them succeeds, and all of them continue with
+ * the successor, which they can reach via next() even before _last_commit_context has been advanced.
+ *
+ * A commit context is sealed as soon as its predecessor has been committed (see _try_increment_last_commit_id).
+ * If the predecessor has already been committed when a transaction joins, there is nobody to seal the context but the
+ * transaction itself. Both sides first modify their own atomic (the state of the context or _last_commit_id) and then
+ * read the other one, so that at least one of them sees the other and seals the context.
  */
 std::shared_ptr<CommitContext> TransactionManager::_new_commit_context() {
   auto current_context = std::atomic_load(&_last_commit_context);
-  auto next_context = std::shared_ptr<CommitContext>();
 
-  auto success = false;
-  while (!success) {
-    while (current_context->has_next()) {
-      current_context = std::atomic_load(&_last_commit_context);
+  while (!current_context->try_join()) {
+    if (!current_context->has_next()) {
+      auto next_context = std::make_shared<CommitContext>(current_context->commit_id() + 1u);
+
+      if (current_context->try_set_next(next_context)) {
+        /**
+         * Only one thread per context ever reaches this code. However, as the successors can be reached via next(),
+         * the threads of younger contexts might get here first, which is why _last_commit_context is never moved back.
+         */
+        auto last_commit_context = std::atomic_load(&_last_commit_context);
+        while (last_commit_context->commit_id() < next_context->commit_id() &&
+               !std::atomic_compare_exchange_weak(&_last_commit_context, &last_commit_context, next_context)) {
+        }
+      }
     }
 
-    next_context = std::make_shared<CommitContext>(current_context->commit_id() + 1u);
-
-    success = current_context->try_set_next(next_context);
-
-    if (!success) continue;
-
-    /**
-     * Only one thread at a time can ever reach this code since only one thread
-     * succeeds to set _last_commit_context’s successor.
-     */
-    success = std::atomic_compare_exchange_strong(&_last_commit_context, &current_context, next_context);
+    current_context = current_context->next();
+  }
 
-    Assert(success, "Invariant violated.");
+  if (_last_commit_id == current_context->commit_id() - 1) {
+    current_context->try_seal();
   }
 
-  return next_context;
+  return current_context;
 }
 
 void TransactionManager::_try_increment_last_commit_id(const std::shared_ptr<CommitContext>& context) {
@@ -113,6 +138,9 @@ void TransactionManager::_try_increment_last_commit_id(const std::shared_ptr<Com
     if (!current_context->has_next()) return;
 
     current_context = current_context->next();
+
+    // The transactions that joined the next context while this one was committed form the next group
+    current_context->try_seal();
   }
 }
 
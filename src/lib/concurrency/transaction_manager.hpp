@@ -1,10 +1,11 @@
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <functional>
+#include <limits>
 #include <memory>
-#include <mutex>
-#include <unordered_set>
+#include <optional>
 
 #include "types.hpp"
 #include "utils/singleton.hpp"
@@ -34,7 +35,8 @@
  *
  * TransactionContext contains data used by a transaction, mainly its ID, the snapshot commit ID explained above, and,
  * when it enters the commit phase, the TransactionManager gives it a CommitContext, which contains
- * a new commit ID that is used to make its changes visible to others.
+ * a new commit ID that is used to make its changes visible to others. Transactions that enter the commit phase while
+ * the previous commit ID is still being committed share a CommitContext and thus a commit ID (group commit).
  */
 
 namespace opossum {
@@ -78,11 +80,12 @@ class TransactionManager : public Singleton<TransactionManager> {
   /**
    * The TransactionManager keeps track of issued snapshot-commit-ids,
    * which are in use by unfinished transactions.
-   * The following two functions are used to keep the multiset of active
-   * snapshot-commit-ids up to date.
+   * The following two functions are used to keep the slots of active
+   * snapshot-commit-ids up to date. A transaction occupies a slot from
+   * its registration until its deregistration.
    */
-  void _register_transaction(CommitID snapshot_commit_id);
-  void _deregister_transaction(CommitID snapshot_commit_id);
+  std::atomic<CommitID>* _register_transaction(CommitID snapshot_commit_id);
+  void _deregister_transaction(std::atomic<CommitID>& snapshot_slot);
 
   std::atomic<TransactionID> _next_transaction_id;
 
@@ -91,9 +94,27 @@ class TransactionManager : public Singleton<TransactionManager> {
   // been there "from the beginning of time".
   static constexpr auto INITIAL_COMMIT_ID = CommitID{1};
 
+  // The youngest CommitContext, which transactions join until it is sealed
   std::shared_ptr<CommitContext> _last_commit_context;
 
-  mutable std::mutex _mutex_active_snapshot_commit_ids;
-  std::unordered_multiset<CommitID> _active_snapshot_commit_ids;
+  static constexpr auto UNUSED_SNAPSHOT_SLOT = std::numeric_limits<CommitID>::max();
+
+  // Each slot fills a cache line of its own, so that transactions of different threads do not contend for it
+  struct alignas(64) SnapshotSlot {
+    std::atomic<CommitID> snapshot_commit_id{UNUSED_SNAPSHOT_SLOT};
+  };
+
+  /**
+   * Slots are claimed and released without locks. When all slots are in use, another block is appended. Blocks are
+   * never removed, so that the number of slots is the highest number of concurrently active transactions so far.
+   */
+  struct SnapshotSlotBlock {
+    ~SnapshotSlotBlock() { delete next.load(); }
+
+    std::array<SnapshotSlot, 64> slots;
+    std::atomic<SnapshotSlotBlock*> next{nullptr};
+  };
+
+  SnapshotSlotBlock _first_snapshot_slot_block;
 };
 }  // namespace opossum
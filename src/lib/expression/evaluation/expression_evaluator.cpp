@@ -1,5 +1,7 @@
 #include "expression_evaluator.hpp"
 
+#include <algorithm>
+#include <functional>
 #include <iterator>
 #include <type_traits>
 
@@ -30,6 +32,8 @@
 #include "resolve_type.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "storage/base_encoded_segment.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
 #include "utils/assert.hpp"
@@ -133,6 +137,44 @@ std::shared_ptr<AbstractExpression> rewrite_in_list_expression(const InExpressio
   return rewritten_expression;
 }
 
+// The batches of a Chunk are evaluated by independent ExpressionEvaluators, each of which advances the segment
+// iterators to the beginning of its batch. Most encodings can only advance their iterators one row at a time, so that
+// a segment would be decoded from its beginning for every batch.
+bool can_advance_in_constant_time(const BaseSegment& segment) {
+  if (dynamic_cast<const BaseValueSegment*>(&segment)) return true;
+
+  // ReferenceSegments advance in their PosList and access the referenced segments by position
+  if (dynamic_cast<const ReferenceSegment*>(&segment)) return true;
+
+  const auto* encoded_segment = dynamic_cast<const BaseEncodedSegment*>(&segment);
+  if (!encoded_segment) return false;
+
+  switch (encoded_segment->encoding_type()) {
+    case EncodingType::Dictionary:
+    case EncodingType::FixedStringDictionary:
+      return encoded_segment->compressed_vector_type() != CompressedVectorType::SimdBp128;
+    default:
+      return false;
+  }
+}
+
+bool can_be_evaluated_batched(const Chunk& chunk, const AbstractExpression& expression) {
+  if (expression.type == ExpressionType::PQPColumn) {
+    const auto column_id = static_cast<const PQPColumnExpression&>(expression).column_id;
+    return can_advance_in_constant_time(*chunk.get_segment(column_id));
+  }
+
+  if (expression.type == ExpressionType::PQPSubquery) {
+    const auto& parameters = static_cast<const PQPSubqueryExpression&>(expression).parameters;
+    return std::all_of(parameters.begin(), parameters.end(), [&](const auto& parameter) {
+      return can_advance_in_constant_time(*chunk.get_segment(parameter.second));
+    });
+  }
+
+  return std::all_of(expression.arguments.begin(), expression.arguments.end(),
+                     [&](const auto& argument) { return can_be_evaluated_batched(chunk, *argument); });
+}
+
 }  // namespace
 
 namespace opossum {
@@ -148,9 +190,52 @@ ExpressionEvaluator::ExpressionEvaluator(
   _segment_materializations.resize(_chunk->column_count());
 }
 
+ExpressionEvaluator::ExpressionEvaluator(
+    const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
+    const std::shared_ptr<const UncorrelatedSubqueryResults>& uncorrelated_subquery_results,
+    const ChunkOffset begin_offset, const ChunkOffset end_offset)
+    : ExpressionEvaluator(table, chunk_id, uncorrelated_subquery_results) {
+  DebugAssert(begin_offset <= end_offset && end_offset <= _chunk->size(), "Invalid batch");
+  _begin_offset = begin_offset;
+  _output_row_count = end_offset - begin_offset;
+}
+
+ExpressionEvaluator::ExpressionEvaluator(
+    const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
+    const std::shared_ptr<const UncorrelatedSubqueryResults>& uncorrelated_subquery_results,
+    const std::shared_ptr<const PosList>& position_filter)
+    : ExpressionEvaluator(table, chunk_id, uncorrelated_subquery_results) {
+  DebugAssert(position_filter->references_single_chunk(), "Expected PosList to reference single chunk");
+  _position_filter = position_filter;
+  _output_row_count = position_filter->size();
+}
+
 template <typename Result>
 std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::evaluate_expression_to_result(
     const AbstractExpression& expression) {
+  if (_common_subexpression_results.empty() || !expression.requires_computation()) {
+    return _evaluate_expression_to_result<Result>(expression);
+  }
+
+  const auto iter = _common_subexpression_results.find(&expression);
+  if (iter == _common_subexpression_results.end()) return _evaluate_expression_to_result<Result>(expression);
+
+  if (iter->second) {
+    // A sub-expression might be requested with a different type than it was first evaluated with (e.g., the THEN of a
+    // CaseExpression), in which case it is evaluated again
+    if (const auto result = std::dynamic_pointer_cast<ExpressionResult<Result>>(iter->second)) return result;
+    return _evaluate_expression_to_result<Result>(expression);
+  }
+
+  // The keys are fixed during the evaluation, so the iterator stays valid
+  const auto result = _evaluate_expression_to_result<Result>(expression);
+  iter->second = result;
+  return result;
+}
+
+template <typename Result>
+std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_expression_to_result(
+    const AbstractExpression& expression) {
   switch (expression.type) {
     case ExpressionType::Arithmetic:
       return _evaluate_arithmetic_expression<Result>(static_cast<const ArithmeticExpression&>(expression));
@@ -982,6 +1067,132 @@ std::shared_ptr<BaseValueSegment> ExpressionEvaluator::evaluate_expression_to_se
 }
 
 PosList ExpressionEvaluator::evaluate_expression_to_pos_list(const AbstractExpression& expression) {
+  auto pos_list = _evaluate_expression_to_pos_list(expression);
+
+  if (_position_filter || _begin_offset != 0) {
+    for (auto& row_id : pos_list) {
+      row_id = _row_id(row_id.chunk_offset);
+    }
+  }
+
+  return pos_list;
+}
+
+std::vector<std::shared_ptr<BaseValueSegment>> ExpressionEvaluator::evaluate_expressions_to_segments_batched(
+    const std::vector<std::shared_ptr<AbstractExpression>>& expressions, const ChunkOffset batch_size) {
+  Assert(_chunk && !_position_filter && _begin_offset == 0, "Can only evaluate entire Chunks batch-at-a-time");
+  Assert(batch_size > 0, "Invalid batch size");
+
+  auto segments = std::vector<std::shared_ptr<BaseValueSegment>>(expressions.size());
+
+  auto expression_references = std::vector<std::reference_wrapper<const AbstractExpression>>{};
+  for (const auto& expression : expressions) {
+    expression_references.emplace_back(*expression);
+  }
+  _common_subexpression_results = _find_common_subexpressions(expression_references);
+
+  const auto batched = _output_row_count > batch_size &&
+                       std::all_of(expressions.begin(), expressions.end(), [&](const auto& expression) {
+                         return can_be_evaluated_batched(*_chunk, *expression);
+                       });
+
+  if (!batched) {
+    for (auto expression_idx = size_t{0}; expression_idx < expressions.size(); ++expression_idx) {
+      segments[expression_idx] = evaluate_expression_to_segment(*expressions[expression_idx]);
+    }
+    _common_subexpression_results.clear();
+    return segments;
+  }
+
+  // The values of the entire Chunk, one type-erased ExpressionResult per expression. The nulls are only allocated once
+  // a batch of the expression turns out to be nullable.
+  auto results = std::vector<std::shared_ptr<BaseExpressionResult>>(expressions.size());
+
+  for (auto begin_offset = ChunkOffset{0}; begin_offset < _output_row_count; begin_offset += batch_size) {
+    const auto end_offset = static_cast<ChunkOffset>(std::min(_output_row_count, size_t{begin_offset + batch_size}));
+    auto batch_evaluator =
+        ExpressionEvaluator{_table, _chunk_id, _uncorrelated_subquery_results, begin_offset, end_offset};
+    _share_common_subexpressions(batch_evaluator);
+
+    for (auto expression_idx = size_t{0}; expression_idx < expressions.size(); ++expression_idx) {
+      batch_evaluator._resolve_to_expression_result_view(*expressions[expression_idx], [&](const auto& view) {
+        using ColumnDataType = typename std::decay_t<decltype(view)>::Type;
+
+        // clang-format off
+        if constexpr (std::is_same_v<ColumnDataType, NullValue>) {
+          Fail("Can't create a Segment from a NULL");
+        } else {
+          if (!results[expression_idx]) {
+            results[expression_idx] = std::make_shared<ExpressionResult<ColumnDataType>>(
+                std::vector<ColumnDataType>(_output_row_count));
+          }
+          auto& result = static_cast<ExpressionResult<ColumnDataType>&>(*results[expression_idx]);
+
+          for (auto row_idx = ChunkOffset{0}; row_idx < batch_evaluator._output_row_count; ++row_idx) {
+            result.values[begin_offset + row_idx] = std::move(view.value(row_idx));
+          }
+
+          if (view.is_nullable()) {
+            result.nulls.resize(_output_row_count);
+            for (auto row_idx = ChunkOffset{0}; row_idx < batch_evaluator._output_row_count; ++row_idx) {
+              result.nulls[begin_offset + row_idx] = view.is_null(row_idx);
+            }
+          }
+        }
+        // clang-format on
+      });
+    }
+  }
+
+  _common_subexpression_results.clear();
+
+  for (auto expression_idx = size_t{0}; expression_idx < expressions.size(); ++expression_idx) {
+    resolve_data_type(expressions[expression_idx]->data_type(), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      auto& result = static_cast<ExpressionResult<ColumnDataType>&>(*results[expression_idx]);
+      if (result.is_nullable()) {
+        segments[expression_idx] =
+            std::make_shared<ValueSegment<ColumnDataType>>(std::move(result.values), std::move(result.nulls));
+      } else {
+        segments[expression_idx] = std::make_shared<ValueSegment<ColumnDataType>>(std::move(result.values));
+      }
+    });
+  }
+
+  return segments;
+}
+
+PosList ExpressionEvaluator::evaluate_expression_to_pos_list_batched(const AbstractExpression& expression,
+                                                                     const ChunkOffset batch_size) {
+  Assert(_chunk && !_position_filter && _begin_offset == 0, "Can only evaluate entire Chunks batch-at-a-time");
+  Assert(batch_size > 0, "Invalid batch size");
+
+  _common_subexpression_results = _find_common_subexpressions({expression});
+
+  if (_output_row_count <= batch_size || !can_be_evaluated_batched(*_chunk, expression)) {
+    auto pos_list = evaluate_expression_to_pos_list(expression);
+    _common_subexpression_results.clear();
+    return pos_list;
+  }
+
+  auto pos_list = PosList{};
+
+  for (auto begin_offset = ChunkOffset{0}; begin_offset < _output_row_count; begin_offset += batch_size) {
+    const auto end_offset = static_cast<ChunkOffset>(std::min(_output_row_count, size_t{begin_offset + batch_size}));
+    auto batch_evaluator =
+        ExpressionEvaluator{_table, _chunk_id, _uncorrelated_subquery_results, begin_offset, end_offset};
+    _share_common_subexpressions(batch_evaluator);
+
+    const auto batch_pos_list = batch_evaluator.evaluate_expression_to_pos_list(expression);
+    pos_list.insert(pos_list.end(), batch_pos_list.begin(), batch_pos_list.end());
+  }
+
+  _common_subexpression_results.clear();
+  return pos_list;
+}
+
+PosList ExpressionEvaluator::_evaluate_expression_to_pos_list(const AbstractExpression& expression) {
   /**
    * Only Expressions returning a Bool can be evaluated to a PosList of matches.
    *
@@ -1044,7 +1255,7 @@ PosList ExpressionEvaluator::evaluate_expression_to_pos_list(const AbstractExpre
         case PredicateCondition::BetweenLowerExclusive:
         case PredicateCondition::BetweenUpperExclusive:
         case PredicateCondition::BetweenExclusive:
-          return evaluate_expression_to_pos_list(*rewrite_between_expression(expression));
+          return _evaluate_expression_to_pos_list(*rewrite_between_expression(expression));
 
         case PredicateCondition::IsNull:
         case PredicateCondition::IsNotNull: {
@@ -1088,8 +1299,35 @@ PosList ExpressionEvaluator::evaluate_expression_to_pos_list(const AbstractExpre
     case ExpressionType::Logical: {
       const auto& logical_expression = static_cast<const LogicalExpression&>(expression);
 
-      const auto left_pos_list = evaluate_expression_to_pos_list(*logical_expression.arguments[0]);
-      const auto right_pos_list = evaluate_expression_to_pos_list(*logical_expression.arguments[1]);
+      const auto left_pos_list = _evaluate_expression_to_pos_list(*logical_expression.arguments[0]);
+
+      // Selection vector: If only few rows match the left operand of a conjunction, the right operand is only
+      // evaluated for these rows. Otherwise, evaluating all rows sequentially is cheaper than the random accesses.
+      if (_chunk && logical_expression.logical_operator == LogicalOperator::And &&
+          static_cast<double>(left_pos_list.size()) <=
+              static_cast<double>(_output_row_count) * MAX_SELECTIVITY_FOR_SELECTION_VECTOR) {
+        if (left_pos_list.empty()) break;
+
+        auto selection = std::make_shared<PosList>();
+        selection->reserve(left_pos_list.size());
+        for (const auto& row_id : left_pos_list) {
+          selection->emplace_back(_row_id(row_id.chunk_offset));
+        }
+        selection->guarantee_single_chunk();
+
+        auto selection_evaluator = ExpressionEvaluator{_table, _chunk_id, _uncorrelated_subquery_results, selection};
+        _share_common_subexpressions(selection_evaluator);
+        const auto selected_pos_list =
+            selection_evaluator._evaluate_expression_to_pos_list(*logical_expression.arguments[1]);
+
+        result_pos_list.reserve(selected_pos_list.size());
+        for (const auto& row_id : selected_pos_list) {
+          result_pos_list.emplace_back(left_pos_list[row_id.chunk_offset]);
+        }
+        break;
+      }
+
+      const auto right_pos_list = _evaluate_expression_to_pos_list(*logical_expression.arguments[1]);
 
       switch (logical_expression.logical_operator) {
         case LogicalOperator::And:
@@ -1341,29 +1579,29 @@ void ExpressionEvaluator::_materialize_segment_if_not_yet_materialized(const Col
   resolve_data_type(segment.data_type(), [&](const auto column_data_type_t) {
     using ColumnDataType = typename decltype(column_data_type_t)::type;
 
-    std::vector<ColumnDataType> values(segment.size());
+    std::vector<ColumnDataType> values(_output_row_count);
 
-    auto chunk_offset = ChunkOffset{0};
+    auto row_idx = ChunkOffset{0};
 
     if (_table->column_is_nullable(column_id)) {
-      std::vector<bool> nulls(segment.size());
+      std::vector<bool> nulls(_output_row_count);
 
-      segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+      _iterate_evaluated_rows<ColumnDataType>(segment, [&](const auto& position) {
         if (position.is_null()) {
-          nulls[chunk_offset] = true;
+          nulls[row_idx] = true;
         } else {
-          values[chunk_offset] = position.value();
+          values[row_idx] = position.value();
         }
-        ++chunk_offset;
+        ++row_idx;
       });
 
       _segment_materializations[column_id] =
           std::make_shared<ExpressionResult<ColumnDataType>>(std::move(values), std::move(nulls));
 
     } else {
-      segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
-        values[chunk_offset] = position.value();
-        ++chunk_offset;
+      _iterate_evaluated_rows<ColumnDataType>(segment, [&](const auto& position) {
+        values[row_idx] = position.value();
+        ++row_idx;
       });
 
       _segment_materializations[column_id] = std::make_shared<ExpressionResult<ColumnDataType>>(std::move(values));
@@ -1371,6 +1609,84 @@ void ExpressionEvaluator::_materialize_segment_if_not_yet_materialized(const Col
   });
 }
 
+template <typename T, typename Functor>
+void ExpressionEvaluator::_iterate_evaluated_rows(const BaseSegment& segment, const Functor& functor) const {
+  if (!_position_filter) {
+    segment_with_iterators<T>(segment, [&](auto iter, [[maybe_unused]] const auto end) {
+      iter += static_cast<std::ptrdiff_t>(_begin_offset);
+      for (auto row_idx = size_t{0}; row_idx < _output_row_count; ++row_idx, ++iter) {
+        functor(*iter);
+      }
+    });
+    return;
+  }
+
+  if (const auto* reference_segment = dynamic_cast<const ReferenceSegment*>(&segment)) {
+    // ReferenceSegments cannot be iterated with a position filter, so we iterate over the referenced positions instead
+    const auto& referenced_pos_list = *reference_segment->pos_list();
+    auto pos_list = std::make_shared<PosList>();
+    pos_list->reserve(_position_filter->size());
+    for (const auto& row_id : *_position_filter) {
+      pos_list->emplace_back(referenced_pos_list[row_id.chunk_offset]);
+    }
+    if (referenced_pos_list.references_single_chunk()) pos_list->guarantee_single_chunk();
+
+    segment_iterate<T>(
+        ReferenceSegment{reference_segment->referenced_table(), reference_segment->referenced_column_id(), pos_list},
+        functor);
+  } else {
+    segment_iterate_filtered<T>(segment, _position_filter, functor);
+  }
+}
+
+size_t ExpressionEvaluator::ExpressionPtrHash::operator()(const AbstractExpression* expression) const {
+  return expression->hash();
+}
+
+bool ExpressionEvaluator::ExpressionPtrEqual::operator()(const AbstractExpression* expression_a,
+                                                         const AbstractExpression* expression_b) const {
+  return *expression_a == *expression_b;
+}
+
+ExpressionEvaluator::CommonSubexpressionResults ExpressionEvaluator::_find_common_subexpressions(
+    const std::vector<std::reference_wrapper<const AbstractExpression>>& expressions) {
+  auto occurrence_counts =
+      std::unordered_map<const AbstractExpression*, size_t, ExpressionPtrHash, ExpressionPtrEqual>{};
+  auto common_subexpression_results = CommonSubexpressionResults{};
+
+  // The arguments of a repeated occurrence are not counted again, as they are not evaluated again either
+  std::function<void(const AbstractExpression&)> count_occurrences = [&](const AbstractExpression& expression) {
+    if (!expression.requires_computation()) return;
+
+    const auto occurrence_count = ++occurrence_counts[&expression];
+    if (occurrence_count > 1) {
+      common_subexpression_results.emplace(&expression, nullptr);
+      return;
+    }
+
+    for (const auto& argument : expression.arguments) {
+      count_occurrences(*argument);
+    }
+  };
+
+  for (const auto& expression : expressions) {
+    count_occurrences(expression);
+  }
+
+  return common_subexpression_results;
+}
+
+void ExpressionEvaluator::_share_common_subexpressions(ExpressionEvaluator& evaluator) const {
+  for (const auto& [expression, result] : _common_subexpression_results) {
+    evaluator._common_subexpression_results.emplace(expression, nullptr);
+  }
+}
+
+RowID ExpressionEvaluator::_row_id(const ChunkOffset row_idx) const {
+  if (_position_filter) return (*_position_filter)[row_idx];
+  return {_chunk_id, ChunkOffset{_begin_offset + row_idx}};
+}
+
 std::shared_ptr<ExpressionResult<pmr_string>> ExpressionEvaluator::_evaluate_substring(
     const std::vector<std::shared_ptr<AbstractExpression>>& arguments) {
   DebugAssert(arguments.size() == 3, "SUBSTR expects three arguments");
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "boost/variant.hpp"
@@ -41,6 +43,17 @@ class PQPColumnExpression;
  * Operates either
  *      - ...on a Chunk, thus returning a value for each row in it
  *      - ...without a Chunk, thus returning a single value (and failing if Columns are encountered in the Expression)
+ *
+ * The *_batched() variants evaluate a Chunk batch-at-a-time, i.e., in ranges of `batch_size` rows. Each batch uses
+ * its own ExpressionEvaluator, so that the materialized segments and intermediate results stay small enough to remain
+ * in the CPU caches while they are passed between the sub-expressions. Chunks with segments that cannot be positioned
+ * at the beginning of a batch in constant time (e.g., RunLength-encoded ones) are evaluated at once.
+ *
+ * When evaluating a conjunction to a PosList, the rows matched by the left operand are passed to the evaluation of the
+ * right operand as a selection vector, so that the right operand is only evaluated for the rows that can still match.
+ *
+ * The *_batched() variants also evaluate sub-expressions that occur more than once in the passed expressions (e.g.,
+ * `a * (1 - b)` in `a * (1 - b)` and `a * (1 - b) * (1 + c)`) only once per batch and reuse the result.
  */
 class ExpressionEvaluator final {
  public:
@@ -49,6 +62,9 @@ class ExpressionEvaluator final {
   using Bool = int32_t;
   static constexpr auto DataTypeBool = DataType::Int;
 
+  // About 2K rows, so that the intermediate results of an expression fit into the L1/L2 caches
+  static constexpr auto DEFAULT_BATCH_SIZE = ChunkOffset{2'048};
+
   // Performance Hack:
   //   For PQPSubqueryExpressions that are not correlated (i.e., that have no parameters), we pass previously
   //   calculated results into the per-chunk evaluator so that they are only evaluated once, not per-chunk.
@@ -69,6 +85,14 @@ class ExpressionEvaluator final {
   std::shared_ptr<BaseValueSegment> evaluate_expression_to_segment(const AbstractExpression& expression);
   PosList evaluate_expression_to_pos_list(const AbstractExpression& expression);
 
+  // Batch-at-a-time variants of the above, see the class comment. The segments are returned in the order of the
+  // expressions. Expressions that share inputs should be passed together, as their materializations are shared.
+  std::vector<std::shared_ptr<BaseValueSegment>> evaluate_expressions_to_segments_batched(
+      const std::vector<std::shared_ptr<AbstractExpression>>& expressions,
+      const ChunkOffset batch_size = DEFAULT_BATCH_SIZE);
+  PosList evaluate_expression_to_pos_list_batched(const AbstractExpression& expression,
+                                                  const ChunkOffset batch_size = DEFAULT_BATCH_SIZE);
+
   template <typename Result>
   std::shared_ptr<ExpressionResult<Result>> evaluate_expression_to_result(const AbstractExpression& expression);
 
@@ -77,6 +101,49 @@ class ExpressionEvaluator final {
       const std::vector<std::shared_ptr<AbstractExpression>>& expressions);
 
  private:
+  // Up to this share of matching rows, the left operand of a conjunction passes its matches to the right operand as a
+  // selection vector (see _evaluate_expression_to_pos_list())
+  static constexpr auto MAX_SELECTIVITY_FOR_SELECTION_VECTOR = 0.5;
+
+  // For the batches of the *_batched() methods, evaluates the rows [begin_offset, end_offset) of the Chunk
+  ExpressionEvaluator(const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
+                      const std::shared_ptr<const UncorrelatedSubqueryResults>& uncorrelated_subquery_results,
+                      const ChunkOffset begin_offset, const ChunkOffset end_offset);
+
+  // For selection vectors, evaluates only the rows of the Chunk that are in @param position_filter
+  ExpressionEvaluator(const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
+                      const std::shared_ptr<const UncorrelatedSubqueryResults>& uncorrelated_subquery_results,
+                      const std::shared_ptr<const PosList>& position_filter);
+
+  // Wrappers around AbstractExpression::hash() and operator==(), so that sub-expressions can be looked up by reference
+  struct ExpressionPtrHash final {
+    size_t operator()(const AbstractExpression* expression) const;
+  };
+  struct ExpressionPtrEqual final {
+    bool operator()(const AbstractExpression* expression_a, const AbstractExpression* expression_b) const;
+  };
+
+  // Results of the sub-expressions that occur more than once, nullptr until they were first evaluated
+  using CommonSubexpressionResults =
+      std::unordered_map<const AbstractExpression*, std::shared_ptr<BaseExpressionResult>, ExpressionPtrHash,
+                         ExpressionPtrEqual>;
+
+  // Returns the sub-expressions that need to be computed and occur more than once in @param expressions
+  static CommonSubexpressionResults _find_common_subexpressions(
+      const std::vector<std::reference_wrapper<const AbstractExpression>>& expressions);
+
+  // Evaluates the common sub-expressions of this evaluator in @param evaluator as well, which evaluates other rows
+  void _share_common_subexpressions(ExpressionEvaluator& evaluator) const;
+
+  template <typename Result>
+  std::shared_ptr<ExpressionResult<Result>> _evaluate_expression_to_result(const AbstractExpression& expression);
+
+  // Returns the matches with ChunkOffsets relative to the evaluated rows, see _row_id()
+  PosList _evaluate_expression_to_pos_list(const AbstractExpression& expression);
+
+  // Maps the index of an evaluated row to its RowID in the Chunk
+  RowID _row_id(const ChunkOffset row_idx) const;
+
   template <typename Result>
   std::shared_ptr<ExpressionResult<Result>> _evaluate_arithmetic_expression(const ArithmeticExpression& expression);
 
@@ -180,6 +247,10 @@ class ExpressionEvaluator final {
 
   void _materialize_segment_if_not_yet_materialized(const ColumnID column_id);
 
+  // Calls @param functor for the position of each evaluated row in @param segment
+  template <typename T, typename Functor>
+  void _iterate_evaluated_rows(const BaseSegment& segment, const Functor& functor) const;
+
   std::shared_ptr<ExpressionResult<pmr_string>> _evaluate_substring(
       const std::vector<std::shared_ptr<AbstractExpression>>& arguments);
   std::shared_ptr<ExpressionResult<pmr_string>> _evaluate_concatenate(
@@ -194,9 +265,17 @@ class ExpressionEvaluator final {
   const ChunkID _chunk_id;
   size_t _output_row_count{1};
 
+  // The rows of the Chunk that are evaluated: either those in _position_filter, if it is set, or _output_row_count
+  // rows starting at _begin_offset
+  ChunkOffset _begin_offset{0};
+  std::shared_ptr<const PosList> _position_filter;
+
   // One entry for each segment in the _chunk, may be nullptr if the segment hasn't been materialized
   std::vector<std::shared_ptr<BaseExpressionResult>> _segment_materializations;
 
+  // Only set while a *_batched() method is running, as the keys reference the expressions passed to it
+  CommonSubexpressionResults _common_subexpression_results;
+
   const std::shared_ptr<const UncorrelatedSubqueryResults> _uncorrelated_subquery_results;
 };
 
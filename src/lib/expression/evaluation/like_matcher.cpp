@@ -1,12 +1,12 @@
 #include "like_matcher.hpp"
 
-#include "boost/algorithm/string/replace.hpp"
+#include <algorithm>
 
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-LikeMatcher::LikeMatcher(const pmr_string& pattern) { _pattern_variant = pattern_string_to_pattern_variant(pattern); }
+LikeMatcher::LikeMatcher(const pmr_string& pattern) : _pattern_variant(pattern_string_to_pattern_variant(pattern)) {}
 
 size_t LikeMatcher::get_index_of_next_wildcard(const pmr_string& pattern, const size_t offset) {
   return pattern.find_first_of("_%", offset);
@@ -88,37 +88,97 @@ LikeMatcher::AllPatternVariant LikeMatcher::pattern_string_to_pattern_variant(co
       expect_any_chars = !expect_any_chars;
     }
 
+    // The pattern also has to end with '%' (after which a string is expected) and must not be empty
+    pattern_is_contains_multiple &= !tokens.empty() && !expect_any_chars;
+
     if (pattern_is_contains_multiple) {
       return MultipleContainsPattern{strings};
     } else {
-      return std::regex(sql_like_to_regex(pattern));
+      return GenericPattern{tokens};
     }
   }
 }
 
-std::string LikeMatcher::sql_like_to_regex(pmr_string sql_like) {
-  // Do substitution of <backslash> with <backslash><backslash> FIRST, because otherwise it will also replace
-  // backslashes introduced by the other substitutions
-  constexpr auto REPLACE_BY = std::array<std::pair<const char*, const char*>, 14u>{{{"\\", "\\\\"},
-                                                                                    {".", "\\."},
-                                                                                    {"^", "\\^"},
-                                                                                    {"$", "\\$"},
-                                                                                    {"+", "\\+"},
-                                                                                    {"?", "\\?"},
-                                                                                    {"(", "\\("},
-                                                                                    {")", "\\)"},
-                                                                                    {"{", "\\{"},
-                                                                                    {"}", "\\}"},
-                                                                                    {"|", "\\|"},
-                                                                                    {"*", "\\*"},
-                                                                                    {"%", ".*"},
-                                                                                    {"_", "."}}};
-
-  for (const auto& pair : REPLACE_BY) {
-    boost::replace_all(sql_like, pair.first, pair.second);
+LikeMatcher::GenericPattern::Block::Block(const pmr_string& init_pattern) : pattern(init_pattern) {
+  auto run_begin = size_t{0};
+  while (run_begin < pattern.size()) {
+    const auto run_end = std::min(pattern.find('_', run_begin), pattern.size());
+    if (run_end - run_begin > search_string_length) {
+      search_string_offset = run_begin;
+      search_string_length = run_end - run_begin;
+    }
+    run_begin = run_end + 1;
+  }
+}
+
+bool LikeMatcher::GenericPattern::Block::matches_at(const std::string_view& string, const size_t position) const {
+  DebugAssert(position + pattern.size() <= string.size(), "Block does not fit into string");
+
+  for (auto pattern_idx = size_t{0}; pattern_idx < pattern.size(); ++pattern_idx) {
+    if (pattern[pattern_idx] != '_' && pattern[pattern_idx] != string[position + pattern_idx]) return false;
+  }
+  return true;
+}
+
+size_t LikeMatcher::GenericPattern::Block::find(const std::string_view& string, const size_t position) const {
+  if (position + pattern.size() > string.size()) return std::string_view::npos;
+  if (search_string_length == 0) return position;  // Only '_'s
+
+  const auto search_string = std::string_view{pattern.data() + search_string_offset, search_string_length};
+
+  // The search string, and thus the block, can only begin at positions where the block fits into the string
+  for (auto block_position = position; block_position + pattern.size() <= string.size(); ++block_position) {
+    const auto search_string_position = string.find(search_string, block_position + search_string_offset);
+    if (search_string_position == std::string_view::npos) return std::string_view::npos;
+
+    block_position = search_string_position - search_string_offset;
+    if (block_position + pattern.size() > string.size()) return std::string_view::npos;
+    if (matches_at(string, block_position)) return block_position;
+  }
+
+  return std::string_view::npos;
+}
+
+LikeMatcher::GenericPattern::GenericPattern(const PatternTokens& tokens) {
+  auto block_pattern = pmr_string{};
+
+  for (const auto& token : tokens) {
+    if (token == PatternToken{Wildcard::AnyChars}) {
+      blocks.emplace_back(block_pattern);
+      block_pattern.clear();
+    } else if (token == PatternToken{Wildcard::SingleChar}) {
+      block_pattern += '_';
+    } else {
+      block_pattern += std::get<pmr_string>(token);
+    }
+  }
+
+  blocks.emplace_back(block_pattern);
+}
+
+bool LikeMatcher::GenericPattern::matches(const std::string_view& string) const {
+  const auto& first_block = blocks.front();
+
+  // No '%', the pattern has to match the entire string
+  if (blocks.size() == 1) return string.size() == first_block.pattern.size() && first_block.matches_at(string, 0);
+
+  const auto& last_block = blocks.back();
+  if (first_block.pattern.size() + last_block.pattern.size() > string.size()) return false;
+
+  if (!first_block.matches_at(string, 0)) return false;
+  if (!last_block.matches_at(string, string.size() - last_block.pattern.size())) return false;
+
+  // The blocks in between have to be found in the remaining characters
+  const auto remaining_string = string.substr(0, string.size() - last_block.pattern.size());
+  auto position = first_block.pattern.size();
+  for (auto block_idx = size_t{1}; block_idx + 1 < blocks.size(); ++block_idx) {
+    const auto& block = blocks[block_idx];
+    position = block.find(remaining_string, position);
+    if (position == std::string_view::npos) return false;
+    position += block.pattern.size();
   }
 
-  return std::string{"^" + sql_like + "$"};
+  return true;
 }
 
 std::ostream& operator<<(std::ostream& stream, const LikeMatcher::Wildcard& wildcard) {
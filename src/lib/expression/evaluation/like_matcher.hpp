@@ -1,7 +1,7 @@
 #pragma once
 
-#include <regex>
 #include <string>
+#include <string_view>
 #include <variant>
 #include <vector>
 
@@ -18,11 +18,6 @@ namespace opossum {
  */
 class LikeMatcher {
  public:
-  /**
-   * Turn SQL LIKE-pattern into a C++ regex.
-   */
-  static std::string sql_like_to_regex(pmr_string sql_like);
-
   static size_t get_index_of_next_wildcard(const pmr_string& pattern, const size_t offset = 0);
   static bool contains_wildcard(const pmr_string& pattern);
 
@@ -40,7 +35,7 @@ class LikeMatcher {
 
   /**
    * To speed up LIKE there are special implementations available for simple, common patterns.
-   * Any other pattern will fall back to regex.
+   * Any other pattern is matched by a GenericPattern.
    */
   // 'hello%'
   struct StartsWithPattern final {
@@ -58,13 +53,45 @@ class LikeMatcher {
   struct MultipleContainsPattern final {
     std::vector<pmr_string> strings;
   };
+  // Any pattern, e.g., 'H_llo%W%d'
+  struct GenericPattern final {
+    /**
+     * The pattern is split at its '%'s into blocks of characters and '_'s. The first block has to match at the
+     * beginning of a string and the last block at its end (unless the pattern has no '%' at all, in which case the
+     * only block has to match the entire string). The blocks in between are matched at their leftmost occurrence after
+     * the previous block. As any number of characters may separate them, this is always correct, so that, other than in
+     * a regex engine, no backtracking is needed.
+     */
+    struct Block {
+      explicit Block(const pmr_string& init_pattern);
+
+      // Returns true if the block matches @param string at @param position, which must leave enough characters
+      bool matches_at(const std::string_view& string, const size_t position) const;
+
+      // Returns the leftmost position at or after @param position where the block matches, or npos
+      size_t find(const std::string_view& string, const size_t position) const;
+
+      // Contains '_' for any character
+      pmr_string pattern;
+
+      // The longest run of characters (without '_') in the pattern. It is searched using std::string_view::find(),
+      // which relies on the vectorized memchr() and memcmp() of the standard library.
+      size_t search_string_offset{0};
+      size_t search_string_length{0};
+    };
+
+    explicit GenericPattern(const PatternTokens& tokens);
+
+    bool matches(const std::string_view& string) const;
+
+    std::vector<Block> blocks;
+  };
 
   /**
-   * Contains one of the specialised patterns from above (StartsWithPattern, ...) or falls back to std::regex for a
-   * general pattern.
+   * Contains one of the specialised patterns from above (StartsWithPattern, ...) or a GenericPattern
    */
   using AllPatternVariant =
-      std::variant<std::regex, StartsWithPattern, EndsWithPattern, ContainsPattern, MultipleContainsPattern>;
+      std::variant<GenericPattern, StartsWithPattern, EndsWithPattern, ContainsPattern, MultipleContainsPattern>;
 
   static AllPatternVariant pattern_string_to_pattern_variant(const pmr_string& pattern);
 
@@ -110,10 +137,12 @@ class LikeMatcher {
         return !invert_results;
       });
 
-    } else if (std::holds_alternative<std::regex>(_pattern_variant)) {
-      const auto& regex = std::get<std::regex>(_pattern_variant);
+    } else if (std::holds_alternative<GenericPattern>(_pattern_variant)) {
+      const auto& generic_pattern = std::get<GenericPattern>(_pattern_variant);
 
-      functor([&](const pmr_string& string) -> bool { return std::regex_match(string, regex) ^ invert_results; });
+      functor([&](const pmr_string& string) -> bool {
+        return generic_pattern.matches(std::string_view{string.data(), string.size()}) ^ invert_results;
+      });
 
     } else {
       Fail("Pattern not implemented. Probably a bug.");
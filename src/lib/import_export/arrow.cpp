@@ -0,0 +1,382 @@
+#include "arrow.hpp"
+
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+struct SchemaPrivateData {
+  std::string format;
+  std::string name;
+  std::vector<ArrowSchema> children;
+  std::vector<ArrowSchema*> child_pointers;
+  std::unique_ptr<ArrowSchema> dictionary;
+};
+
+struct ArrayPrivateData {
+  // Keeps the segment alive, with which the array shares buffers
+  std::shared_ptr<const BaseSegment> segment;
+  // Buffers created for the export, e.g., validity bitmaps or the offsets of strings
+  std::vector<std::shared_ptr<const void>> owned_buffers;
+  std::vector<const void*> buffers;
+  std::vector<ArrowArray> children;
+  std::vector<ArrowArray*> child_pointers;
+  std::unique_ptr<ArrowArray> dictionary;
+};
+
+// The consumer may move children out of their parent, in which case it marks them as released
+void release_schema(ArrowSchema* schema) {
+  auto* private_data = static_cast<SchemaPrivateData*>(schema->private_data);
+  for (auto& child : private_data->children) {
+    if (child.release) child.release(&child);
+  }
+  if (private_data->dictionary && private_data->dictionary->release) {
+    private_data->dictionary->release(private_data->dictionary.get());
+  }
+  delete private_data;
+  schema->release = nullptr;
+}
+
+void release_array(ArrowArray* array) {
+  auto* private_data = static_cast<ArrayPrivateData*>(array->private_data);
+  for (auto& child : private_data->children) {
+    if (child.release) child.release(&child);
+  }
+  if (private_data->dictionary && private_data->dictionary->release) {
+    private_data->dictionary->release(private_data->dictionary.get());
+  }
+  delete private_data;
+  array->release = nullptr;
+}
+
+SchemaPrivateData& init_schema(ArrowSchema& schema, const std::string& format, const std::string& name,
+                               const int64_t flags) {
+  auto* private_data = new SchemaPrivateData{format, name, {}, {}, nullptr};
+  schema = ArrowSchema{private_data->format.c_str(), private_data->name.c_str(), nullptr, flags, 0, nullptr, nullptr,
+                       &release_schema, private_data};
+  return *private_data;
+}
+
+ArrayPrivateData& init_array(ArrowArray& array, const int64_t length, const int64_t null_count,
+                             const std::shared_ptr<const BaseSegment>& segment) {
+  auto* private_data = new ArrayPrivateData{segment, {}, {}, {}, {}, nullptr};
+  array = ArrowArray{length, null_count, 0, 0, 0, nullptr, nullptr, nullptr, &release_array, private_data};
+  return *private_data;
+}
+
+// Points the schema to its children, once all of them have been added
+void publish_children(ArrowSchema& schema, SchemaPrivateData& private_data) {
+  for (auto& child : private_data.children) {
+    private_data.child_pointers.emplace_back(&child);
+  }
+  schema.n_children = static_cast<int64_t>(private_data.children.size());
+  schema.children = private_data.child_pointers.data();
+  schema.dictionary = private_data.dictionary.get();
+}
+
+// Points the array to its buffers and children, once all of them have been added
+void publish_buffers(ArrowArray& array, ArrayPrivateData& private_data) {
+  for (auto& child : private_data.children) {
+    private_data.child_pointers.emplace_back(&child);
+  }
+  array.n_buffers = static_cast<int64_t>(private_data.buffers.size());
+  array.buffers = private_data.buffers.data();
+  array.n_children = static_cast<int64_t>(private_data.children.size());
+  array.children = private_data.child_pointers.data();
+  array.dictionary = private_data.dictionary.get();
+}
+
+template <typename Buffer>
+const void* own_buffer(ArrayPrivateData& private_data, Buffer&& buffer) {
+  const auto owned_buffer = std::make_shared<const std::decay_t<Buffer>>(std::forward<Buffer>(buffer));
+  private_data.owned_buffers.emplace_back(owned_buffer);
+  return owned_buffer->data();
+}
+
+/**
+ * Creates the validity bitmap, in which the bit of each value that is not NULL is set (least significant bit first).
+ * If there are no NULLs, Arrow does not need a bitmap and nullptr is returned.
+ */
+template <typename IsNull>
+const void* create_validity_bitmap(ArrayPrivateData& private_data, const ChunkOffset length, const IsNull& is_null,
+                                   int64_t& null_count) {
+  auto bitmap = std::vector<uint8_t>((length + 7) / 8, 0);
+  null_count = 0;
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < length; ++chunk_offset) {
+    if (is_null(chunk_offset)) {
+      ++null_count;
+    } else {
+      bitmap[chunk_offset / 8] |= static_cast<uint8_t>(1u << (chunk_offset % 8));
+    }
+  }
+  if (null_count == 0) return nullptr;
+  return own_buffer(private_data, std::move(bitmap));
+}
+
+template <typename T>
+std::string arrow_format() {
+  if constexpr (std::is_same_v<T, int32_t>) return "i";
+  if constexpr (std::is_same_v<T, int64_t>) return "l";
+  if constexpr (std::is_same_v<T, float>) return "f";
+  if constexpr (std::is_same_v<T, double>) return "g";
+  if constexpr (std::is_same_v<T, pmr_string>) return "u";
+  Fail("Data type cannot be exported to Arrow");
+}
+
+/**
+ * Strings are materialized into an offset and a data buffer. If the data exceeds the 2 GB that 32 bit offsets can
+ * address, 64 bit offsets (i.e., Arrow's large_utf8) are used. Returns the format.
+ */
+template <typename GetString>
+std::string add_string_buffers(ArrayPrivateData& private_data, const size_t length, const GetString& get_string) {
+  auto offsets = std::vector<int64_t>{};
+  offsets.reserve(length + 1);
+  offsets.emplace_back(0);
+  auto data = std::vector<char>{};
+  for (auto index = size_t{0}; index < length; ++index) {
+    const auto& string = get_string(index);
+    data.insert(data.end(), string.begin(), string.end());
+    offsets.emplace_back(static_cast<int64_t>(data.size()));
+  }
+
+  if (data.size() <= static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+    private_data.buffers.emplace_back(own_buffer(private_data, std::vector<int32_t>(offsets.begin(), offsets.end())));
+    private_data.buffers.emplace_back(own_buffer(private_data, std::move(data)));
+    return "u";
+  }
+  private_data.buffers.emplace_back(own_buffer(private_data, std::move(offsets)));
+  private_data.buffers.emplace_back(own_buffer(private_data, std::move(data)));
+  return "U";
+}
+
+/**
+ * A concurrent_vector allocates its storage in segments, which are contiguous when the size was known on creation or
+ * reserved (e.g., for ValueSegments created by operators or mutable chunks appended by Insert). Segment k starts at
+ * index 2^k (k > 0), so only the elements at the powers of two have to be checked.
+ */
+template <typename T>
+bool is_contiguous(const pmr_concurrent_vector<T>& values, const size_t length) {
+  if (length == 0) return true;
+  const auto* const first = &values[0];
+  for (auto index = size_t{2}; index < length; index *= 2) {
+    if (&values[index] != first + index) return false;
+  }
+  return true;
+}
+
+template <typename T>
+std::string export_value_segment(const std::shared_ptr<const ValueSegment<T>>& segment, const ChunkOffset length,
+                                 ArrowArray& array) {
+  auto& private_data = init_array(array, length, 0, segment);
+
+  if (segment->is_nullable()) {
+    const auto& null_values = segment->null_values();
+    private_data.buffers.emplace_back(create_validity_bitmap(
+        private_data, length, [&](const auto chunk_offset) { return null_values[chunk_offset]; }, array.null_count));
+  } else {
+    private_data.buffers.emplace_back(nullptr);
+  }
+
+  const auto& values = segment->values();
+  auto format = arrow_format<T>();
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    format = add_string_buffers(private_data, length, [&](const auto index) -> const pmr_string& {
+      return values[index];
+    });
+  } else {
+    if (is_contiguous(values, length)) {
+      private_data.buffers.emplace_back(length > 0 ? &values[0] : nullptr);
+    } else {
+      auto copied_values = std::vector<T>(values.begin(), values.begin() + length);
+      private_data.buffers.emplace_back(own_buffer(private_data, std::move(copied_values)));
+    }
+  }
+
+  publish_buffers(array, private_data);
+  return format;
+}
+
+/**
+ * Exports a dictionary-encoded segment as a dictionary array, whose indices are the attribute vector if it stores the
+ * value ids as uint8, uint16, or uint32. Hyrise's dictionaries are sorted, so that the order of the indices matches the
+ * order of the values. NULLs have the value id null_value_id(), which lies outside of the dictionary and is masked by
+ * the validity bitmap. Returns the formats of the indices and the dictionary, or nothing if the attribute vector is
+ * compressed otherwise.
+ */
+template <typename T>
+std::optional<std::pair<std::string, std::string>> export_dictionary_segment(
+    const std::shared_ptr<const BaseDictionarySegment>& segment, const ChunkOffset length, ArrowArray& array) {
+  const auto compressed_vector_type = segment->compressed_vector_type();
+  if (!compressed_vector_type) return std::nullopt;
+
+  auto index_format = std::string{};
+  switch (*compressed_vector_type) {
+    case CompressedVectorType::FixedSize1ByteAligned:
+      index_format = "C";
+      break;
+    case CompressedVectorType::FixedSize2ByteAligned:
+      index_format = "S";
+      break;
+    case CompressedVectorType::FixedSize4ByteAligned:
+      index_format = "I";
+      break;
+    default:
+      return std::nullopt;
+  }
+
+  auto& private_data = init_array(array, length, 0, segment);
+  const auto null_value_id = static_cast<ValueID::base_type>(segment->null_value_id());
+  resolve_compressed_vector_type(*segment->attribute_vector(), [&](const auto& attribute_vector) {
+    using AttributeVectorType = std::decay_t<decltype(attribute_vector)>;
+    // clang-format off
+    if constexpr (std::is_same_v<AttributeVectorType, FixedSizeByteAlignedVector<uint8_t>> ||
+                  std::is_same_v<AttributeVectorType, FixedSizeByteAlignedVector<uint16_t>> ||
+                  std::is_same_v<AttributeVectorType, FixedSizeByteAlignedVector<uint32_t>>) {
+      // clang-format on
+      const auto& value_ids = attribute_vector.data();
+      private_data.buffers.emplace_back(create_validity_bitmap(
+          private_data, length, [&](const auto chunk_offset) { return value_ids[chunk_offset] == null_value_id; },
+          array.null_count));
+      private_data.buffers.emplace_back(value_ids.data());
+    }
+  });
+
+  const auto dictionary_size = segment->unique_values_count();
+  private_data.dictionary = std::make_unique<ArrowArray>();
+  auto& dictionary_private_data = init_array(*private_data.dictionary, dictionary_size, 0, segment);
+  dictionary_private_data.buffers.emplace_back(nullptr);
+
+  auto dictionary_format = arrow_format<T>();
+  const auto typed_segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(segment);
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    if (typed_segment) {
+      const auto& dictionary = *typed_segment->dictionary();
+      dictionary_format = add_string_buffers(dictionary_private_data, dictionary_size,
+                                             [&](const auto index) -> const pmr_string& { return dictionary[index]; });
+    } else {
+      // FixedStringDictionarySegments store their dictionary as fixed-size strings
+      dictionary_format = add_string_buffers(dictionary_private_data, dictionary_size, [&](const auto index) {
+        return boost::get<pmr_string>(segment->value_of_value_id(ValueID{static_cast<ValueID::base_type>(index)}));
+      });
+    }
+  } else {
+    Assert(typed_segment, "Unexpected dictionary-encoded segment");
+    dictionary_private_data.buffers.emplace_back(typed_segment->dictionary()->data());
+  }
+  publish_buffers(*private_data.dictionary, dictionary_private_data);
+
+  publish_buffers(array, private_data);
+  return std::pair{index_format, dictionary_format};
+}
+
+// Materializes the values of any segment, e.g., encoded or ReferenceSegments
+template <typename T>
+std::string export_materialized_segment(const std::shared_ptr<const BaseSegment>& segment, const ChunkOffset length,
+                                        ArrowArray& array) {
+  auto& private_data = init_array(array, length, 0, segment);
+
+  auto values = std::vector<T>{};
+  auto null_values = std::vector<bool>{};
+  values.reserve(length);
+  null_values.reserve(length);
+  segment_iterate<T>(*segment, [&](const auto& position) {
+    null_values.emplace_back(position.is_null());
+    values.emplace_back(position.is_null() ? T{} : position.value());
+  });
+
+  private_data.buffers.emplace_back(create_validity_bitmap(
+      private_data, length, [&](const auto chunk_offset) { return null_values[chunk_offset]; }, array.null_count));
+
+  auto format = arrow_format<T>();
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    format = add_string_buffers(private_data, length, [&](const auto index) -> const pmr_string& {
+      return values[index];
+    });
+  } else {
+    private_data.buffers.emplace_back(own_buffer(private_data, std::move(values)));
+  }
+
+  publish_buffers(array, private_data);
+  return format;
+}
+
+template <typename T>
+void export_segment(const std::shared_ptr<const BaseSegment>& segment, const ChunkOffset length,
+                    const std::string& name, const bool nullable, ArrowSchema& schema, ArrowArray& array) {
+  const auto flags = nullable ? int64_t{ARROW_FLAG_NULLABLE} : int64_t{0};
+
+  if (const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<T>>(segment)) {
+    init_schema(schema, export_value_segment<T>(value_segment, length, array), name, flags);
+    return;
+  }
+
+  if (const auto dictionary_segment = std::dynamic_pointer_cast<const BaseDictionarySegment>(segment)) {
+    if (const auto formats = export_dictionary_segment<T>(dictionary_segment, length, array)) {
+      auto& private_data = init_schema(schema, formats->first, name, flags | ARROW_FLAG_DICTIONARY_ORDERED);
+      private_data.dictionary = std::make_unique<ArrowSchema>();
+      init_schema(*private_data.dictionary, formats->second, "", 0);
+      publish_children(schema, private_data);
+      return;
+    }
+  }
+
+  init_schema(schema, export_materialized_segment<T>(segment, length, array), name, flags);
+}
+
+}  // namespace
+
+namespace opossum {
+
+void export_chunk_to_arrow(const Table& table, const ChunkID chunk_id, ArrowSchema* out_schema,
+                           ArrowArray* out_array) {
+  const auto chunk = table.get_chunk(chunk_id);
+  const auto column_count = table.column_count();
+  // The rows of a chunk that are visible now, later appends are not exported
+  const auto length = chunk->size();
+
+  auto& schema_private_data = init_schema(*out_schema, "+s", "", 0);
+  auto& array_private_data = init_array(*out_array, length, 0, nullptr);
+  array_private_data.buffers.emplace_back(nullptr);
+
+  // The parents point to their children, so the children are created up front and never moved
+  schema_private_data.children.resize(column_count);
+  array_private_data.children.resize(column_count);
+
+  try {
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        export_segment<ColumnDataType>(chunk->get_segment(column_id), length, table.column_name(column_id),
+                                       table.column_is_nullable(column_id), schema_private_data.children[column_id],
+                                       array_private_data.children[column_id]);
+      });
+    }
+  } catch (...) {
+    // Releases the children that were already exported
+    out_schema->release(out_schema);
+    out_array->release(out_array);
+    throw;
+  }
+
+  publish_children(*out_schema, schema_private_data);
+  publish_buffers(*out_array, array_private_data);
+}
+
+}  // namespace opossum
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+
+#include "types.hpp"
+
+/**
+ * The structures of the Arrow C data interface (https://arrow.apache.org/docs/format/CDataInterface.html), which are
+ * ABI-stable and meant to be copied verbatim. Any Arrow implementation (e.g., pyarrow's RecordBatch._import_from_c or
+ * arrow::ImportRecordBatch) can import them without Hyrise and Arrow linking against each other.
+ */
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+  // Array type description
+  const char* format;
+  const char* name;
+  const char* metadata;
+  int64_t flags;
+  int64_t n_children;
+  struct ArrowSchema** children;
+  struct ArrowSchema* dictionary;
+
+  // Release callback
+  void (*release)(struct ArrowSchema*);
+  // Opaque producer-specific data
+  void* private_data;
+};
+
+struct ArrowArray {
+  // Array data description
+  int64_t length;
+  int64_t null_count;
+  int64_t offset;
+  int64_t n_buffers;
+  int64_t n_children;
+  const void** buffers;
+  struct ArrowArray** children;
+  struct ArrowArray* dictionary;
+
+  // Release callback
+  void (*release)(struct ArrowArray*);
+  // Opaque producer-specific data
+  void* private_data;
+};
+
+#endif  // ARROW_C_DATA_INTERFACE
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Exports a chunk of a table as an Arrow record batch, i.e., a struct array with one child array per column, and its
+ * schema. Each column is exported according to the segment that stores it:
+ *
+ *  - ValueSegments of numbers share their values with the Arrow array. Only the validity bitmap of nullable segments is
+ *    created, as Hyrise stores a byte per NULL flag.
+ *  - DictionarySegments and FixedStringDictionarySegments with a fixed-size byte-aligned attribute vector become
+ *    Arrow dictionary arrays, whose indices (uint8, uint16, or uint32) share the attribute vector. Numeric
+ *    dictionaries are shared as well.
+ *  - Strings (utf8 or, if they exceed 2 GB, large_utf8) and all other segments, including ReferenceSegments, are
+ *    materialized.
+ *
+ * As the encoding of a column can differ between chunks, each chunk comes with its own schema. The exported arrays
+ * keep the segments that they share buffers with alive until they are released by the consumer, even if the table is
+ * deleted or its segments are replaced. Values of exported segments must not be modified, which Hyrise does not do
+ * anyway: rows are only appended to ValueSegments, which does not move the existing values.
+ *
+ * Both out_schema and out_array are owned by the caller, who has to call their release callbacks.
+ */
+void export_chunk_to_arrow(const Table& table, ChunkID chunk_id, ArrowSchema* out_schema, ArrowArray* out_array);
+
+}  // namespace opossum
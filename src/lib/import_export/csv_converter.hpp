@@ -3,10 +3,11 @@
 #include <boost/algorithm/string.hpp>
 
 #include <algorithm>
+#include <charconv>  // NOLINT - cpplint does not know this C++17 header
 #include <cstdlib>
-#include <functional>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
 
 #include "csv_meta.hpp"
@@ -18,8 +19,8 @@
 namespace opossum {
 
 /*
- * CsvConverter is a helper class that creates a ValueSegment by converting the given null terminated strings and placing
- * them at the given position.
+ * CsvConverter is a helper class that creates a ValueSegment by converting the given strings and placing them at the
+ * given position.
  * The base class BaseCsvConverter allows us to handle different types of columns uniformly.
  */
 
@@ -28,7 +29,7 @@ class BaseCsvConverter {
   virtual ~BaseCsvConverter() = default;
 
   // Converts value to the underlying data type and saves it at the given position.
-  virtual void insert(std::string& value, ChunkOffset position) = 0;
+  virtual void insert(std::string_view value, ChunkOffset position) = 0;
 
   // Returns the segment that contains the previously converted values.
   // After the call of finish, no other operation should be called.
@@ -49,13 +50,13 @@ class CsvConverter : public BaseCsvConverter {
   explicit CsvConverter(ChunkOffset size, const ParseConfig& config = {}, bool is_nullable = false)
       : _parsed_values(size), _null_values(size, false), _is_nullable(is_nullable), _config(config) {}
 
-  void insert(std::string& value, ChunkOffset position) override {
+  void insert(std::string_view value, ChunkOffset position) override {
     if (_is_nullable && value.length() == 0) {
       _null_values[position] = true;
       return;
     }
 
-    if (boost::to_lower_copy(value) == ParseConfig::NULL_STRING) {
+    if (boost::iequals(value, ParseConfig::NULL_STRING)) {
       Assert(!_config.reject_null_strings,
              "Unquoted null found in CSV file. Quote it for string literal \"null\", leave field empty for null value, "
              "or set 'reject_null_strings' to false in parse config.");
@@ -65,20 +66,21 @@ class CsvConverter : public BaseCsvConverter {
       }
     }
 
-    // clang-format off
-    if constexpr(std::is_same_v<T, pmr_string>) {
-      unescape(value, _config);
-    } else {  // NOLINT
-      // clang-format on
-      if (_config.reject_quoted_nonstrings) {
-        Assert(value == unescape_copy(value, _config),
-               "Unexpected quoted string " + value + " encountered in non-string column");
-      } else {
-        unescape(value, _config);
+    // Only quoted fields contain escaping. Other fields are converted without copying them first.
+    if (!value.empty() && value.front() == _config.quote) {
+      // clang-format off
+      if constexpr(!std::is_same_v<T, pmr_string>) {
+        // clang-format on
+        Assert(!_config.reject_quoted_nonstrings,
+               "Unexpected quoted string " + std::string{value} + " encountered in non-string column");
       }
+
+      _buffer.assign(value);
+      unescape(_buffer, _config);
+      value = _buffer;
     }
 
-    _parsed_values[position] = _get_conversion_function()(value);
+    _parsed_values[position] = _convert(value);
   }
 
   std::unique_ptr<BaseSegment> finish() override {
@@ -91,61 +93,69 @@ class CsvConverter : public BaseCsvConverter {
 
  private:
   /*
-   * Returns a conversion function that converts from a string to type T.
+   * Converts from a string to type T.
    * This function is defined for each type that can be stored in a ValueSegment.
    * The assumption is that only csv fields of type string must be unescaped because other types cannot contain special
    * csv characters.
    */
-  std::function<T(const std::string&)> _get_conversion_function();
+  T _convert(std::string_view value);
+
+  /*
+   * Integers are converted directly from the field. As std::from_chars accepts neither leading whitespace nor a plus
+   * sign, such values fall back to the conversion function, e.g., std::stoi, that accepts them.
+   */
+  template <typename ConversionFunction>
+  T _convert_integer(std::string_view value, const ConversionFunction& conversion_function, const std::string& type) {
+    auto converted = T{};
+    const auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), converted);
+    if (error == std::errc{} && end == value.data() + value.size()) return converted;
+
+    return _convert_with(value, conversion_function, type);
+  }
+
+  // Converts the value with a function that needs a null-terminated string, e.g., std::stof
+  template <typename ConversionFunction>
+  T _convert_with(std::string_view value, const ConversionFunction& conversion_function, const std::string& type) {
+    // The buffer is reused for all values, so that the copy does not allocate
+    _buffer.assign(value);
+
+    size_t pos;
+    const auto converted = static_cast<T>(conversion_function(_buffer, &pos));
+    Assert(pos == _buffer.size(), "Unprocessed characters found while converting to " + type + ": " + _buffer);
+    return converted;
+  }
+
   tbb::concurrent_vector<T> _parsed_values;
   tbb::concurrent_vector<bool> _null_values;
   const bool _is_nullable;
   ParseConfig _config;
+  std::string _buffer;
 };
 
 template <>
-inline std::function<int32_t(const std::string&)> CsvConverter<int32_t>::_get_conversion_function() {
-  return [](const std::string& str) {
-    size_t pos;
-    auto converted = std::stoi(str, &pos);
-    Assert(pos == str.size(), "Unprocessed characters found while converting to int: " + str);
-    return converted;
-  };
+inline int32_t CsvConverter<int32_t>::_convert(std::string_view value) {
+  return _convert_integer(value, [](const std::string& str, size_t* pos) { return std::stoi(str, pos); }, "int");
 }
 
 template <>
-inline std::function<int64_t(const std::string&)> CsvConverter<int64_t>::_get_conversion_function() {
-  return [](const std::string& str) {
-    size_t pos;
-    auto converted = static_cast<int64_t>(std::stoll(str, &pos));
-    Assert(pos == str.size(), "Unprocessed characters found while converting to long: " + str);
-    return converted;
-  };
+inline int64_t CsvConverter<int64_t>::_convert(std::string_view value) {
+  return _convert_integer(value, [](const std::string& str, size_t* pos) { return std::stoll(str, pos); }, "long");
 }
 
 template <>
-inline std::function<float(const std::string&)> CsvConverter<float>::_get_conversion_function() {
-  return [](const std::string& str) {
-    size_t pos;
-    auto converted = std::stof(str, &pos);
-    Assert(pos == str.size(), "Unprocessed characters found while converting to float: " + str);
-    return converted;
-  };
+inline float CsvConverter<float>::_convert(std::string_view value) {
+  // Not all of our compilers support std::from_chars for floating point numbers
+  return _convert_with(value, [](const std::string& str, size_t* pos) { return std::stof(str, pos); }, "float");
 }
 
 template <>
-inline std::function<double(const std::string&)> CsvConverter<double>::_get_conversion_function() {
-  return [](const std::string& str) {
-    size_t pos;
-    auto converted = std::stod(str, &pos);
-    Assert(pos == str.size(), "Unprocessed characters found while converting to double: " + str);
-    return converted;
-  };
+inline double CsvConverter<double>::_convert(std::string_view value) {
+  return _convert_with(value, [](const std::string& str, size_t* pos) { return std::stod(str, pos); }, "double");
 }
 
 template <>
-inline std::function<pmr_string(const std::string&)> CsvConverter<pmr_string>::_get_conversion_function() {
-  return [](const std::string& str) { return pmr_string{str}; };
+inline pmr_string CsvConverter<pmr_string>::_convert(std::string_view value) {
+  return pmr_string{value};
 }
 
 }  // namespace opossum
@@ -1,7 +1,19 @@
 #include "csv_parser.hpp"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include <boost/algorithm/string/trim.hpp>
-#include <fstream>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <functional>
 #include <list>
 #include <memory>
@@ -23,6 +35,44 @@
 #include "utils/assert.hpp"
 #include "utils/load_table.hpp"
 
+namespace {
+
+constexpr auto BLOCK_SIZE = size_t{64};
+
+// Returns a mask in which bit i is set if the i-th character of the block is the given character
+uint64_t character_mask(const char* block, const char character) {
+#if defined(__SSE2__)
+  const auto characters = _mm_set1_epi8(character);
+  auto mask = uint64_t{0};
+  for (auto offset = size_t{0}; offset < BLOCK_SIZE; offset += sizeof(__m128i)) {
+    const auto data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + offset));
+    const auto matches = static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(data, characters)));
+    mask |= static_cast<uint64_t>(matches) << offset;
+  }
+  return mask;
+#else
+  auto mask = uint64_t{0};
+  for (auto offset = size_t{0}; offset < BLOCK_SIZE; ++offset) {
+    mask |= static_cast<uint64_t>(block[offset] == character) << offset;
+  }
+  return mask;
+#endif
+}
+
+// Returns a mask in which bit i is the XOR of the bits 0 to i of the given mask. Applied to the positions of the
+// quotes, it sets the bits from each opening quote up to the character before the closing quote.
+uint64_t prefix_xor(uint64_t bits) {
+  bits ^= bits << 1;
+  bits ^= bits << 2;
+  bits ^= bits << 4;
+  bits ^= bits << 8;
+  bits ^= bits << 16;
+  bits ^= bits << 32;
+  return bits;
+}
+
+}  // namespace
+
 namespace opossum {
 
 std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const std::optional<CsvMeta>& csv_meta,
@@ -38,26 +88,37 @@ std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const std::
 
   auto table = _create_table_from_meta(chunk_size);
 
-  std::ifstream csvfile{filename};
-
-  // return empty table if input file is empty
-  if (!csvfile || csvfile.peek() == EOF || csvfile.peek() == '\r' || csvfile.peek() == '\n') return table;
-
   /**
-   * Load the whole file(!) into a std::string using the, hopefully, fastest method to do so.
-   * TODO(anybody) Maybe use mmap() in the future. The current approach needs to have the entire file in RAM, mmap might
-   *               be cleverer, dunno.
+   * Map the file into memory instead of reading it into a string. This way, the file does not have to fit into RAM and
+   * the OS reads ahead while the chunks are being parsed.
    */
-  csvfile.seekg(0, std::ios::end);
-  const auto csvfile_size = csvfile.tellg();
-  std::string content(csvfile_size, ' ');
-  csvfile.seekg(0);
-  csvfile.read(content.data(), csvfile_size);
+  const auto file_descriptor = open(filename.c_str(), O_RDONLY);
+
+  // return empty table if input file cannot be opened or is empty
+  if (file_descriptor < 0) return table;
+
+  struct stat file_status {};
+  const auto stat_result = fstat(file_descriptor, &file_status);
+  const auto file_size = static_cast<size_t>(file_status.st_size);
+  if (stat_result != 0 || file_size == 0) {
+    close(file_descriptor);
+    Assert(stat_result == 0, "Could not determine size of CSV file " + filename);
+    return table;
+  }
+
+  auto* const mapped_file = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+  // The mapping stays valid after the file is closed
+  close(file_descriptor);
+  Assert(mapped_file != MAP_FAILED, "Could not map CSV file " + filename);
+  madvise(mapped_file, file_size, MADV_SEQUENTIAL);
 
-  // make sure content ends with a delimiter for better row processing later
-  if (content.back() != _meta.config.delimiter) content.push_back(_meta.config.delimiter);
+  auto unmap_file = [file_size](void* mapped_memory) { munmap(mapped_memory, file_size); };
+  const auto mapped_file_guard = std::unique_ptr<void, decltype(unmap_file)>{mapped_file, unmap_file};
 
-  std::string_view content_view{content.c_str(), content.size()};
+  std::string_view content_view{static_cast<const char*>(mapped_file), file_size};
+
+  // also return empty table if input file starts with an empty line
+  if (content_view.front() == '\r' || content_view.front() == '\n') return table;
 
   // Save chunks in list to avoid memory relocation
   std::list<Segments> segments_by_chunks;
@@ -71,13 +132,14 @@ std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const std::
     // Only pass the part of the string that is actually needed to the parsing task
     std::string_view relevant_content = content_view.substr(0, field_ends.back());
 
-    // Remove processed part of the csv content
-    content_view = content_view.substr(field_ends.back() + 1);
+    // Remove processed part of the csv content. The last row of the file might not be followed by a delimiter.
+    content_view.remove_prefix(std::min(field_ends.back() + 1, content_view.size()));
 
     // create and start parsing task to fill chunk
-    tasks.emplace_back(std::make_shared<JobTask>([this, relevant_content, field_ends, &table, &segments]() {
-      _parse_into_chunk(relevant_content, field_ends, *table, segments);
-    }));
+    tasks.emplace_back(
+        std::make_shared<JobTask>([this, relevant_content, field_ends = std::move(field_ends), &table, &segments]() {
+          _parse_into_chunk(relevant_content, field_ends, *table, segments);
+        }));
     tasks.back()->schedule();
   }
 
@@ -122,45 +184,70 @@ bool CsvParser::_find_fields_in_chunk(std::string_view csv_content, const Table&
     return false;
   }
 
-  std::string search_for{_meta.config.separator, _meta.config.delimiter, _meta.config.quote};
+  /**
+   * Instead of searching for the next special character one by one, the content is processed in blocks of 64
+   * characters, for which bitmasks of the special characters are built (see character_mask). Which characters are
+   * quoted is derived from the quote mask without branches (see prefix_xor). This is the structural indexing of simdcsv
+   * (https://github.com/geofflangdale/simdcsv).
+   */
+  const auto& config = _meta.config;
+  const auto max_rows = table.max_chunk_size();
+  const auto check_escaped_quotes = config.quote != config.escape;
+
+  size_t rows = 0;
+  size_t field_count = 1;
+  size_t row_begin = 0;
+  auto in_quotes = false;
+  auto previous_block_ends_with_escape = false;
+
+  // The last block is padded with zeros, which are not special characters
+  auto padded_block = std::array<char, BLOCK_SIZE>{};
+
+  for (auto block_begin = size_t{0}; block_begin < csv_content.size(); block_begin += BLOCK_SIZE) {
+    auto block = csv_content.data() + block_begin;
+    if (csv_content.size() - block_begin < BLOCK_SIZE) {
+      std::copy(block, csv_content.data() + csv_content.size(), padded_block.begin());
+      block = padded_block.data();
+    }
 
-  size_t pos, from = 0;
-  unsigned int rows = 0, field_count = 1;
-  bool in_quotes = false;
-  while (rows < table.max_chunk_size() || 0 == table.max_chunk_size()) {
-    // Find either of row separator, column delimiter, quote identifier
-    pos = csv_content.find_first_of(search_for, from);
-    if (std::string::npos == pos) {
-      break;
+    // Make sure to "toggle" quotes ONLY if the quotes are not part of the string (i.e. escaped)
+    auto quote_bits = character_mask(block, config.quote);
+    if (check_escaped_quotes) {
+      const auto escape_bits = character_mask(block, config.escape);
+      quote_bits &= ~((escape_bits << 1) | static_cast<uint64_t>(previous_block_ends_with_escape));
+      previous_block_ends_with_escape = escape_bits >> (BLOCK_SIZE - 1);
     }
-    from = pos + 1;
-    const char elem = csv_content[pos];
-
-    // Make sure to "toggle" in_quotes ONLY if the quotes are not part of the string (i.e. escaped)
-    if (elem == _meta.config.quote) {
-      bool quote_is_escaped = false;
-      if (_meta.config.quote != _meta.config.escape) {
-        quote_is_escaped = pos != 0 && csv_content[pos - 1] == _meta.config.escape;
-      }
-      if (!quote_is_escaped) {
-        in_quotes = !in_quotes;
+
+    // Bits of all characters between an opening and a closing quote
+    const auto quoted_bits = prefix_xor(quote_bits) ^ (in_quotes ? ~uint64_t{0} : uint64_t{0});
+    in_quotes = quoted_bits >> (BLOCK_SIZE - 1);
+
+    // Separators and delimiters that mark the end of a field or row and are not part of a (string) value
+    auto field_end_bits = (character_mask(block, config.separator) | character_mask(block, config.delimiter)) &
+                          ~quoted_bits;
+
+    while (field_end_bits != 0) {
+      const auto pos = block_begin + static_cast<size_t>(__builtin_ctzll(field_end_bits));
+      field_end_bits &= field_end_bits - 1;
+
+      if (csv_content[pos] == config.delimiter) {
+        DebugAssert(field_count == table.column_count(), "Number of CSV fields does not match number of columns.");
+        ++rows;
+        field_count = 0;
+        row_begin = pos + 1;
       }
-    }
 
-    // Determine if delimiter marks end of row or is part of the (string) value
-    if (elem == _meta.config.delimiter && !in_quotes) {
-      DebugAssert(field_count == table.column_count(), "Number of CSV fields does not match number of columns.");
-      ++rows;
-      field_count = 0;
-    }
+      ++field_count;
+      field_ends.push_back(pos);
 
-    // Determine if separator marks end of field or is part of the (string) value
-    if (in_quotes || elem == _meta.config.quote) {
-      continue;
+      if (rows == max_rows && max_rows != 0) return true;
     }
+  }
 
-    ++field_count;
-    field_ends.push_back(pos);
+  // The last row of the file does not need to be followed by a delimiter, unless it ends within quotes
+  if (row_begin < csv_content.size() && !in_quotes) {
+    DebugAssert(field_count == table.column_count(), "Number of CSV fields does not match number of columns.");
+    field_ends.push_back(csv_content.size());
   }
 
   return true;
@@ -192,12 +279,16 @@ size_t CsvParser::_parse_into_chunk(std::string_view csv_chunk, const std::vecto
     for (; row_id < row_count; ++row_id) {
       for (column_id = ColumnID{0}; column_id < column_count; ++column_id, ++field_idx) {
         const auto end = field_ends[field_idx];
-        auto field = std::string{csv_chunk.substr(start, end - start)};
+        auto field = csv_chunk.substr(start, end - start);
         start = end + 1;
 
-        if (!_meta.config.rfc_mode) {
-          // CSV fields not following RFC 4810 might need some preprocessing
-          _sanitize_field(field);
+        // CSV fields not following RFC 4810 might need some preprocessing. Only these fields are copied, all others are
+        // converted directly from the file content.
+        if (!_meta.config.rfc_mode && field.find(_escaped_linebreak) != std::string_view::npos) {
+          auto sanitized_field = std::string{field};
+          _sanitize_field(sanitized_field);
+          converters[column_id]->insert(sanitized_field, static_cast<ChunkOffset>(row_id));
+          continue;
         }
 
         converters[column_id]->insert(field, static_cast<ChunkOffset>(row_id));
@@ -21,8 +21,8 @@ class Chunk;
  * For non-RFC 4180, all linebreaks within quoted strings are further escaped with an escape character.
  * For the structure of the meta csv file see export_csv.hpp
  *
- * This parser reads the whole csv file and iterates over it to separate the data into chunks that are aligned with the
- * csv rows.
+ * This parser maps the csv file into memory and iterates over it to separate the data into chunks that are aligned with
+ * the csv rows.
  * Each data chunk is parsed and converted into a opossum chunk. In the end all chunks are combined to the final table.
  */
 class CsvParser {
@@ -0,0 +1,228 @@
+#include "parquet.hpp"
+
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+// Integers are stored as variable-length integers in zigzag encoding, so that small negative numbers are short, too
+uint64_t zigzag_encode(const int64_t value) {
+  return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+int64_t zigzag_decode(const uint64_t value) {
+  return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+void append_varint(std::string& buffer, uint64_t value) {
+  while (value >= 0x80) {
+    buffer.push_back(static_cast<char>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  buffer.push_back(static_cast<char>(value));
+}
+
+uint64_t read_varint(const std::string_view data, size_t& position) {
+  auto value = uint64_t{0};
+  for (auto shift = 0; shift < 64; shift += 7) {
+    Assert(position < data.size(), "Unexpected end of data");
+    const auto byte = static_cast<uint8_t>(data[position++]);
+    value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0) return value;
+  }
+  Fail("Invalid variable-length integer");
+}
+
+}  // namespace
+
+namespace opossum {
+
+void ThriftCompactWriter::write_i32(const int16_t field_id, const int32_t value) {
+  _write_field_header(field_id, ThriftType::I32);
+  write_i32(value);
+}
+
+void ThriftCompactWriter::write_i64(const int16_t field_id, const int64_t value) {
+  _write_field_header(field_id, ThriftType::I64);
+  _write_varint(zigzag_encode(value));
+}
+
+void ThriftCompactWriter::write_binary(const int16_t field_id, const std::string_view value) {
+  _write_field_header(field_id, ThriftType::Binary);
+  write_binary(value);
+}
+
+void ThriftCompactWriter::begin_struct(const int16_t field_id) {
+  _write_field_header(field_id, ThriftType::Struct);
+  begin_struct();
+}
+
+void ThriftCompactWriter::begin_list(const int16_t field_id, const ThriftType element_type, const size_t size) {
+  _write_field_header(field_id, ThriftType::List);
+
+  // Short lists store their size in the header
+  if (size < 15) {
+    _buffer.push_back(static_cast<char>((size << 4) | static_cast<uint8_t>(element_type)));
+  } else {
+    _buffer.push_back(static_cast<char>(0xF0 | static_cast<uint8_t>(element_type)));
+    _write_varint(size);
+  }
+}
+
+void ThriftCompactWriter::write_i32(const int32_t value) { _write_varint(zigzag_encode(value)); }
+
+void ThriftCompactWriter::write_binary(const std::string_view value) {
+  _write_varint(value.size());
+  _buffer.append(value);
+}
+
+void ThriftCompactWriter::begin_struct() { _last_field_ids.emplace_back(0); }
+
+void ThriftCompactWriter::end_struct() {
+  DebugAssert(!_last_field_ids.empty(), "No structure to end");
+  _buffer.push_back(static_cast<char>(ThriftType::Stop));
+  _last_field_ids.pop_back();
+}
+
+const std::string& ThriftCompactWriter::buffer() const { return _buffer; }
+
+void ThriftCompactWriter::_write_field_header(const int16_t field_id, const ThriftType type) {
+  DebugAssert(!_last_field_ids.empty(), "Fields can only be written within a structure");
+  auto& last_field_id = _last_field_ids.back();
+
+  // If the field id is at most 15 larger than that of the previous field, only the difference is stored
+  const auto field_id_delta = field_id - last_field_id;
+  if (field_id_delta > 0 && field_id_delta <= 15) {
+    _buffer.push_back(static_cast<char>((field_id_delta << 4) | static_cast<uint8_t>(type)));
+  } else {
+    _buffer.push_back(static_cast<char>(type));
+    _write_varint(zigzag_encode(field_id));
+  }
+  last_field_id = field_id;
+}
+
+void ThriftCompactWriter::_write_varint(const uint64_t value) { append_varint(_buffer, value); }
+
+ThriftCompactReader::ThriftCompactReader(const std::string_view data) : _data(data) {}
+
+int32_t ThriftCompactReader::read_i32() { return static_cast<int32_t>(zigzag_decode(_read_varint())); }
+
+int64_t ThriftCompactReader::read_i64() { return zigzag_decode(_read_varint()); }
+
+std::string_view ThriftCompactReader::read_binary() {
+  const auto size = _read_varint();
+  Assert(size <= _data.size() - _position, "Unexpected end of Thrift data");
+  const auto value = _data.substr(_position, size);
+  _position += size;
+  return value;
+}
+
+void ThriftCompactReader::skip(const ThriftType type) {
+  switch (type) {
+    case ThriftType::BooleanTrue:
+    case ThriftType::BooleanFalse:
+      // The value of a boolean field is stored in its type
+      return;
+    case ThriftType::Byte:
+      _read_byte();
+      return;
+    case ThriftType::I16:
+    case ThriftType::I32:
+    case ThriftType::I64:
+      _read_varint();
+      return;
+    case ThriftType::Double:
+      for (auto index = 0; index < 8; ++index) _read_byte();
+      return;
+    case ThriftType::Binary:
+      read_binary();
+      return;
+    case ThriftType::List:
+    case ThriftType::Set:
+      read_list([&](const ThriftType element_type) { skip(element_type); });
+      return;
+    case ThriftType::Map: {
+      const auto size = _read_varint();
+      if (size == 0) return;
+      const auto types = _read_byte();
+      for (auto index = uint64_t{0}; index < size; ++index) {
+        skip(static_cast<ThriftType>(types >> 4));
+        skip(static_cast<ThriftType>(types & 0x0F));
+      }
+      return;
+    }
+    case ThriftType::Struct:
+      read_struct([&](const int16_t, const ThriftType field_type) { skip(field_type); });
+      return;
+    case ThriftType::Stop:
+      break;
+  }
+  Fail("Invalid Thrift type " + std::to_string(static_cast<int>(type)));
+}
+
+size_t ThriftCompactReader::position() const { return _position; }
+
+uint8_t ThriftCompactReader::_read_byte() {
+  Assert(_position < _data.size(), "Unexpected end of Thrift data");
+  return static_cast<uint8_t>(_data[_position++]);
+}
+
+uint64_t ThriftCompactReader::_read_varint() { return read_varint(_data, _position); }
+
+void append_parquet_definition_levels(std::string& buffer, const std::vector<bool>& null_values) {
+  auto levels = std::string{};
+  for (auto run_begin = size_t{0}; run_begin < null_values.size();) {
+    auto run_end = run_begin + 1;
+    while (run_end < null_values.size() && null_values[run_end] == null_values[run_begin]) ++run_end;
+
+    // A run consists of its length, shifted by one bit to mark it as a run, and the level in one byte
+    append_varint(levels, (run_end - run_begin) << 1);
+    levels.push_back(null_values[run_begin] ? 0 : 1);
+    run_begin = run_end;
+  }
+
+  const auto size = static_cast<uint32_t>(levels.size());
+  buffer.append(reinterpret_cast<const char*>(&size), sizeof(size));
+  buffer.append(levels);
+}
+
+std::vector<bool> read_parquet_definition_levels(const std::string_view data, size_t& position, const size_t count) {
+  auto size = uint32_t{};
+  Assert(position + sizeof(size) <= data.size(), "Unexpected end of Parquet page");
+  std::memcpy(&size, data.data() + position, sizeof(size));
+  position += sizeof(size);
+  Assert(position + size <= data.size(), "Unexpected end of Parquet page");
+
+  const auto levels = data.substr(position, size);
+  position += size;
+
+  auto null_values = std::vector<bool>{};
+  null_values.reserve(count);
+  auto levels_position = size_t{0};
+  while (null_values.size() < count) {
+    const auto header = read_varint(levels, levels_position);
+    if (header & 1) {
+      // Groups of eight bit-packed levels, starting with the least significant bit
+      const auto group_count = header >> 1;
+      Assert(levels_position + group_count <= levels.size(), "Unexpected end of Parquet definition levels");
+      for (auto group_index = uint64_t{0}; group_index < group_count; ++group_index) {
+        const auto group = static_cast<uint8_t>(levels[levels_position++]);
+        for (auto bit = 0; bit < 8; ++bit) null_values.push_back(((group >> bit) & 1) == 0);
+      }
+    } else {
+      Assert(levels_position < levels.size(), "Unexpected end of Parquet definition levels");
+      const auto is_null = levels[levels_position++] == 0;
+      null_values.insert(null_values.end(), header >> 1, is_null);
+    }
+  }
+
+  // Bit-packed levels are padded to groups of eight
+  null_values.resize(count);
+  return null_values;
+}
+
+}  // namespace opossum
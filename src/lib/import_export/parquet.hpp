@@ -0,0 +1,289 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * Definitions for the subset of Apache Parquet (https://github.com/apache/parquet-format) that ImportParquet and
+ * ExportParquet support. A Parquet file stores a table in row groups, each of which contains one column chunk per
+ * column. ExportParquet writes each chunk of a table as a row group, ImportParquet creates a chunk from each row group.
+ *
+ * A file is laid out as follows:
+ *
+ * Description           | Format
+ * -----------------------------------------------------------------------------------------
+ * Magic number          | "PAR1"
+ * Column chunks         | Pages, each consisting of a PageHeader and the page data
+ * File metadata         | FileMetaData, encoded with the Thrift compact protocol
+ * Metadata length       | uint32_t, little endian
+ * Magic number          | "PAR1"
+ *
+ * Supported are flat schemas of REQUIRED and OPTIONAL columns, uncompressed data pages (version 1) with PLAIN encoded
+ * values, and definition levels in the RLE/bit-packing hybrid encoding. The column chunk statistics (min and max value,
+ * null count) are used to prune row groups.
+ */
+
+constexpr auto PARQUET_MAGIC_NUMBER = std::string_view{"PAR1"};
+
+// The enums use the values of parquet.thrift
+enum class ParquetType : int32_t {
+  Boolean = 0,
+  Int32 = 1,
+  Int64 = 2,
+  Int96 = 3,
+  Float = 4,
+  Double = 5,
+  ByteArray = 6,
+  FixedLenByteArray = 7
+};
+
+enum class ParquetRepetitionType : int32_t { Required = 0, Optional = 1, Repeated = 2 };
+
+enum class ParquetConvertedType : int32_t { Utf8 = 0 };
+
+enum class ParquetEncoding : int32_t { Plain = 0, PlainDictionary = 2, Rle = 3, BitPacked = 4, RleDictionary = 8 };
+
+enum class ParquetCompressionCodec : int32_t { Uncompressed = 0 };
+
+enum class ParquetPageType : int32_t { DataPage = 0, IndexPage = 1, DictionaryPage = 2, DataPageV2 = 3 };
+
+// Ids of the fields of the Thrift structures in parquet.thrift that are written or read
+namespace parquet_fields {
+
+struct FileMetaData {
+  static constexpr int16_t VERSION = 1, SCHEMA = 2, NUM_ROWS = 3, ROW_GROUPS = 4, CREATED_BY = 6, COLUMN_ORDERS = 7;
+};
+
+struct SchemaElement {
+  static constexpr int16_t TYPE = 1, REPETITION_TYPE = 3, NAME = 4, NUM_CHILDREN = 5, CONVERTED_TYPE = 6;
+};
+
+struct RowGroup {
+  static constexpr int16_t COLUMNS = 1, TOTAL_BYTE_SIZE = 2, NUM_ROWS = 3;
+};
+
+struct ColumnChunk {
+  static constexpr int16_t FILE_OFFSET = 2, META_DATA = 3;
+};
+
+struct ColumnMetaData {
+  static constexpr int16_t TYPE = 1, ENCODINGS = 2, PATH_IN_SCHEMA = 3, CODEC = 4, NUM_VALUES = 5,
+                           TOTAL_UNCOMPRESSED_SIZE = 6, TOTAL_COMPRESSED_SIZE = 7, DATA_PAGE_OFFSET = 9,
+                           DICTIONARY_PAGE_OFFSET = 11, STATISTICS = 12;
+};
+
+struct Statistics {
+  static constexpr int16_t MAX = 1, MIN = 2, NULL_COUNT = 3, MAX_VALUE = 5, MIN_VALUE = 6;
+};
+
+// ColumnOrder is a union, of which only TypeDefinedOrder, an empty structure, exists
+struct ColumnOrder {
+  static constexpr int16_t TYPE_ORDER = 1;
+};
+
+struct PageHeader {
+  static constexpr int16_t TYPE = 1, UNCOMPRESSED_PAGE_SIZE = 2, COMPRESSED_PAGE_SIZE = 3, DATA_PAGE_HEADER = 5;
+};
+
+struct DataPageHeader {
+  static constexpr int16_t NUM_VALUES = 1, ENCODING = 2, DEFINITION_LEVEL_ENCODING = 3, REPETITION_LEVEL_ENCODING = 4;
+};
+
+}  // namespace parquet_fields
+
+// Types of the Thrift compact protocol, see
+// https://github.com/apache/thrift/blob/master/doc/specs/thrift-compact-protocol.md
+enum class ThriftType : uint8_t {
+  Stop = 0,
+  BooleanTrue = 1,
+  BooleanFalse = 2,
+  Byte = 3,
+  I16 = 4,
+  I32 = 5,
+  I64 = 6,
+  Double = 7,
+  Binary = 8,
+  List = 9,
+  Set = 10,
+  Map = 11,
+  Struct = 12
+};
+
+/**
+ * Writes Thrift structures in the compact protocol. Fields are written by their id, structures and lists are opened
+ * and closed explicitly, e.g.,
+ *
+ *   writer.begin_struct();
+ *   writer.write_i32(1, 42);
+ *   writer.begin_list(2, ThriftType::Binary, 1);
+ *   writer.write_binary("a");
+ *   writer.end_struct();
+ */
+class ThriftCompactWriter {
+ public:
+  // Write a field of the current structure
+  void write_i32(int16_t field_id, int32_t value);
+  void write_i64(int16_t field_id, int64_t value);
+  void write_binary(int16_t field_id, std::string_view value);
+  void begin_struct(int16_t field_id);
+  void begin_list(int16_t field_id, ThriftType element_type, size_t size);
+
+  // Write an element of a list or the top-level structure
+  void write_i32(int32_t value);
+  void write_binary(std::string_view value);
+  void begin_struct();
+
+  void end_struct();
+
+  const std::string& buffer() const;
+
+ protected:
+  void _write_field_header(int16_t field_id, ThriftType type);
+  void _write_varint(uint64_t value);
+
+  std::string _buffer;
+  // The id of the last field written in each of the open structures
+  std::vector<int16_t> _last_field_ids;
+};
+
+/**
+ * Reads Thrift structures in the compact protocol. The caller is called back for each field of a structure or each
+ * element of a list and has to either read or skip its value. Fails if the data is incomplete.
+ */
+class ThriftCompactReader {
+ public:
+  explicit ThriftCompactReader(std::string_view data);
+
+  // Calls handle_field(field_id, type) for each field of the structure
+  template <typename FieldHandler>
+  void read_struct(const FieldHandler& handle_field) {
+    auto last_field_id = int16_t{0};
+    while (true) {
+      const auto header = _read_byte();
+      const auto type = static_cast<ThriftType>(header & 0x0F);
+      if (type == ThriftType::Stop) return;
+
+      const auto field_id_delta = static_cast<int16_t>(header >> 4);
+      const auto field_id =
+          field_id_delta != 0 ? static_cast<int16_t>(last_field_id + field_id_delta) : static_cast<int16_t>(read_i64());
+      last_field_id = field_id;
+
+      handle_field(field_id, type);
+    }
+  }
+
+  // Calls handle_element(type) for each element of the list. Lists of booleans, which Parquet does not use, are not
+  // supported.
+  template <typename ElementHandler>
+  void read_list(const ElementHandler& handle_element) {
+    const auto header = _read_byte();
+    const auto type = static_cast<ThriftType>(header & 0x0F);
+    const auto size = (header >> 4) == 0x0F ? _read_varint() : static_cast<uint64_t>(header >> 4);
+    Assert(type != ThriftType::BooleanTrue && type != ThriftType::BooleanFalse, "Lists of booleans are not supported");
+
+    for (auto index = uint64_t{0}; index < size; ++index) {
+      handle_element(type);
+    }
+  }
+
+  int32_t read_i32();
+  int64_t read_i64();
+  std::string_view read_binary();
+
+  // Skips the value of a field or list element of the given type
+  void skip(ThriftType type);
+
+  // The number of bytes read so far
+  size_t position() const;
+
+ protected:
+  uint8_t _read_byte();
+  uint64_t _read_varint();
+
+  std::string_view _data;
+  size_t _position = 0;
+};
+
+/**
+ * The PLAIN encoding stores numbers in little endian and strings prefixed with their length as uint32_t. In the
+ * statistics, the length of strings is omitted. As the encoding matches the memory layout of numbers on the platforms
+ * that we support, numbers are copied as they are.
+ */
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "Parquet import and export require a little endian platform");
+
+template <typename T>
+void append_parquet_plain_value(std::string& buffer, const T& value) {
+  // clang-format off
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    const auto size = static_cast<uint32_t>(value.size());
+    buffer.append(reinterpret_cast<const char*>(&size), sizeof(size));
+    buffer.append(value.data(), value.size());
+  } else {  // NOLINT
+    // clang-format on
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+  }
+}
+
+template <typename T>
+std::string encode_parquet_statistics_value(const T& value) {
+  // clang-format off
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    return std::string{value};
+  } else {  // NOLINT
+    // clang-format on
+    return std::string{reinterpret_cast<const char*>(&value), sizeof(value)};
+  }
+}
+
+template <typename T>
+T decode_parquet_statistics_value(const std::string_view value) {
+  // clang-format off
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    return pmr_string{value};
+  } else {  // NOLINT
+    // clang-format on
+    Assert(value.size() == sizeof(T), "Unexpected size of Parquet value");
+    auto decoded = T{};
+    std::memcpy(&decoded, value.data(), sizeof(T));
+    return decoded;
+  }
+}
+
+template <typename T>
+T read_parquet_plain_value(const std::string_view data, size_t& position) {
+  auto size = sizeof(T);
+  // clang-format off
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    auto string_size = uint32_t{};
+    Assert(position + sizeof(string_size) <= data.size(), "Unexpected end of Parquet page");
+    std::memcpy(&string_size, data.data() + position, sizeof(string_size));
+    position += sizeof(string_size);
+    size = string_size;
+  }
+  // clang-format on
+  Assert(position + size <= data.size(), "Unexpected end of Parquet page");
+  const auto value = decode_parquet_statistics_value<T>(data.substr(position, size));
+  position += size;
+  return value;
+}
+
+/**
+ * Definition levels state for each row whether the value is defined (1) or NULL (0). They are stored in the
+ * RLE/bit-packing hybrid encoding with a bit width of 1, prefixed with their size in bytes as uint32_t. When writing,
+ * only runs of equal levels are used, reading also supports bit-packed levels.
+ */
+void append_parquet_definition_levels(std::string& buffer, const std::vector<bool>& null_values);
+
+// Returns whether each of the count values is NULL
+std::vector<bool> read_parquet_definition_levels(std::string_view data, size_t& position, size_t count);
+
+}  // namespace opossum
@@ -3,8 +3,11 @@
 #include <algorithm>
 #include <unordered_map>
 
+#include "boost/functional/hash.hpp"
+
 #include "expression/abstract_expression.hpp"
 #include "expression/expression_utils.hpp"
+#include "expression/lqp_column_expression.hpp"
 #include "expression/lqp_subquery_expression.hpp"
 #include "join_node.hpp"
 #include "lqp_utils.hpp"
@@ -236,6 +239,31 @@ bool AbstractLQPNode::operator==(const AbstractLQPNode& rhs) const {
 
 bool AbstractLQPNode::operator!=(const AbstractLQPNode& rhs) const { return !operator==(rhs); }
 
+size_t AbstractLQPNode::hash() const {
+  auto hash = boost::hash_value(static_cast<size_t>(type));
+  boost::hash_combine(hash, _on_shallow_hash());
+
+  for (const auto& node_expression : node_expressions) {
+    visit_expression(node_expression, [&](const auto& expression) {
+      boost::hash_combine(hash, static_cast<size_t>(expression->type));
+      if (expression->type == ExpressionType::LQPColumn) {
+        const auto& column_reference = static_cast<const LQPColumnExpression&>(*expression).column_reference;
+        boost::hash_combine(hash, static_cast<size_t>(column_reference.original_column_id()));
+      } else if (expression->type == ExpressionType::Value) {
+        boost::hash_combine(hash, expression->hash());
+      }
+      return ExpressionVisitation::VisitArguments;
+    });
+  }
+
+  if (left_input()) boost::hash_combine(hash, left_input()->hash());
+  if (right_input()) boost::hash_combine(hash, right_input()->hash());
+
+  return hash;
+}
+
+size_t AbstractLQPNode::_on_shallow_hash() const { return 0; }
+
 std::shared_ptr<AbstractLQPNode> AbstractLQPNode::_deep_copy_impl(LQPNodeMapping& node_mapping) const {
   std::shared_ptr<AbstractLQPNode> copied_left_input, copied_right_input;
 
@@ -23,6 +23,7 @@ enum class LQPNodeType {
   DropTable,
   DummyTable,
   Insert,
+  IntermediateTable,
   Join,
   Limit,
   Predicate,
@@ -164,6 +165,12 @@ class AbstractLQPNode : public std::enable_shared_from_this<AbstractLQPNode>, pu
   bool operator==(const AbstractLQPNode& rhs) const;
   bool operator!=(const AbstractLQPNode& rhs) const;
 
+  /**
+   * Hash of the LQP that is consistent with operator==, i.e., equal LQPs have equal hashes. The LQPColumnExpressions of
+   * equal LQPs reference different nodes, so only their ColumnIDs contribute to the hash.
+   */
+  size_t hash() const;
+
   const LQPNodeType type;
 
   /**
@@ -180,6 +187,9 @@ class AbstractLQPNode : public std::enable_shared_from_this<AbstractLQPNode>, pu
   virtual std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const = 0;
   virtual bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const = 0;
 
+  // Hashes the node-specific members that are compared in _on_shallow_equals(). Collisions are resolved by operator==.
+  virtual size_t _on_shallow_hash() const;
+
  private:
   std::shared_ptr<AbstractLQPNode> _deep_copy_impl(LQPNodeMapping& node_mapping) const;
   std::shared_ptr<AbstractLQPNode> _shallow_copy(LQPNodeMapping& node_mapping) const;
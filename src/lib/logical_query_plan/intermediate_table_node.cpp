@@ -0,0 +1,66 @@
+#include "intermediate_table_node.hpp"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "statistics/table_statistics.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+std::shared_ptr<TableStatistics> correct_row_count(const TableStatistics& estimated_statistics, const Table& table) {
+  return std::make_shared<TableStatistics>(table.type(), static_cast<float>(table.row_count()),
+                                           estimated_statistics.column_statistics());
+}
+
+}  // namespace
+
+namespace opossum {
+
+IntermediateTableNode::IntermediateTableNode(const std::shared_ptr<AbstractLQPNode>& replaced_lqp,
+                                             const std::shared_ptr<const Table>& table)
+    : AbstractLQPNode(LQPNodeType::IntermediateTable),
+      replaced_lqp(replaced_lqp),
+      table(table),
+      _column_expressions(replaced_lqp->column_expressions()),
+      _statistics(correct_row_count(*replaced_lqp->get_statistics(), *table)) {
+  Assert(_column_expressions.size() == table->column_count(),
+         "Materialized table does not match the columns of the replaced LQP");
+}
+
+std::string IntermediateTableNode::description() const {
+  std::ostringstream stream;
+  stream << "[IntermediateTable] " << table->row_count() << " row(s), estimated ";
+  stream << replaced_lqp->get_statistics()->row_count() << " row(s)";
+  return stream.str();
+}
+
+const std::vector<std::shared_ptr<AbstractExpression>>& IntermediateTableNode::column_expressions() const {
+  return _column_expressions;
+}
+
+bool IntermediateTableNode::is_column_nullable(const ColumnID column_id) const {
+  return table->column_is_nullable(column_id);
+}
+
+std::shared_ptr<TableStatistics> IntermediateTableNode::derive_statistics_from(
+    const std::shared_ptr<AbstractLQPNode>& left_input, const std::shared_ptr<AbstractLQPNode>& right_input) const {
+  DebugAssert(!left_input && !right_input, "IntermediateTableNode must be leaf");
+  return _statistics;
+}
+
+std::shared_ptr<AbstractLQPNode> IntermediateTableNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
+  // The replaced LQP is not part of the plan anymore, so the copy can share it as well as the column expressions
+  return IntermediateTableNode::make(replaced_lqp, table);
+}
+
+bool IntermediateTableNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
+  const auto& intermediate_table_node = static_cast<const IntermediateTableNode&>(rhs);
+  return table == intermediate_table_node.table && replaced_lqp == intermediate_table_node.replaced_lqp;
+}
+
+}  // namespace opossum
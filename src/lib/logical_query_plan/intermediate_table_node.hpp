@@ -0,0 +1,49 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_lqp_node.hpp"
+
+namespace opossum {
+
+class Table;
+class TableStatistics;
+
+/**
+ * This node type represents the already materialized result of a sub-LQP. It is used by the adaptive re-optimization
+ * in the SQLPipelineStatement to replace those parts of an LQP that have already been executed.
+ *
+ * The node takes over the column expressions of the sub-LQP it replaces, so that nodes further up in the LQP can still
+ * reference them. It also keeps the replaced sub-LQP alive, since LQPColumnReferences only hold weak pointers to the
+ * nodes that created the columns.
+ * Its statistics are the estimated statistics of the replaced sub-LQP, corrected to the actual row count.
+ */
+class IntermediateTableNode : public EnableMakeForLQPNode<IntermediateTableNode>, public AbstractLQPNode {
+ public:
+  IntermediateTableNode(const std::shared_ptr<AbstractLQPNode>& replaced_lqp,
+                        const std::shared_ptr<const Table>& table);
+
+  std::string description() const override;
+
+  const std::vector<std::shared_ptr<AbstractExpression>>& column_expressions() const override;
+  bool is_column_nullable(const ColumnID column_id) const override;
+
+  std::shared_ptr<TableStatistics> derive_statistics_from(
+      const std::shared_ptr<AbstractLQPNode>& left_input,
+      const std::shared_ptr<AbstractLQPNode>& right_input = nullptr) const override;
+
+  const std::shared_ptr<AbstractLQPNode> replaced_lqp;
+  const std::shared_ptr<const Table> table;
+
+ protected:
+  std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
+  bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const override;
+
+ private:
+  const std::vector<std::shared_ptr<AbstractExpression>> _column_expressions;
+  const std::shared_ptr<TableStatistics> _statistics;
+};
+
+}  // namespace opossum
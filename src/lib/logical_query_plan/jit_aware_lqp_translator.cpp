@@ -5,18 +5,21 @@
 #include <boost/range/adaptors.hpp>
 #include <boost/range/combine.hpp>
 
+#include <algorithm>
 #include <queue>
 #include <unordered_set>
 
 #include "constant_mappings.hpp"
 #include "expression/abstract_predicate_expression.hpp"
 #include "expression/arithmetic_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
 #include "expression/correlated_parameter_expression.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/logical_expression.hpp"
 #include "expression/lqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
 #include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
 #include "logical_query_plan/limit_node.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/predicate_node.hpp"
@@ -25,6 +28,8 @@
 #include "operators/jit_operator/operators/jit_aggregate.hpp"
 #include "operators/jit_operator/operators/jit_compute.hpp"
 #include "operators/jit_operator/operators/jit_filter.hpp"
+#include "operators/jit_operator/operators/jit_hash_join_build.hpp"
+#include "operators/jit_operator/operators/jit_hash_join_probe.hpp"
 #include "operators/jit_operator/operators/jit_limit.hpp"
 #include "operators/jit_operator/operators/jit_read_tuples.hpp"
 #include "operators/jit_operator/operators/jit_validate.hpp"
@@ -78,6 +83,28 @@ bool requires_computation(const std::shared_ptr<AbstractLQPNode>& node) {
   return true;
 }
 
+// Returns whether a JoinNode can be computed by a JitHashJoinProbe, i.e., whether it is an inner equi-join with each
+// predicate comparing a column of its right input to a value of the same data type computed from its left input.
+bool is_jittable_join(const std::shared_ptr<AbstractLQPNode>& node) {
+  const auto join_node = std::dynamic_pointer_cast<JoinNode>(node);
+  if (!join_node || join_node->join_mode != JoinMode::Inner || join_node->join_predicates().empty()) return false;
+
+  for (const auto& join_predicate : join_node->join_predicates()) {
+    const auto predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(join_predicate);
+    if (!predicate || predicate->predicate_condition != PredicateCondition::Equals) return false;
+
+    // TODO(anybody) Operands with differing types not supported by JIT, see #1606
+    if (predicate->left_operand()->data_type() != predicate->right_operand()->data_type()) return false;
+
+    const auto& build_node = join_node->right_input();
+    if (!build_node->find_column_id(*predicate->left_operand()) &&
+        !build_node->find_column_id(*predicate->right_operand())) {
+      return false;
+    }
+  }
+  return true;
+}
+
 bool can_use_value_ids_in_expression(const std::shared_ptr<AbstractExpression>& expression) {
   // Value ids can only be used in predicate expressions
   const auto predicate_expression = std::dynamic_pointer_cast<const AbstractPredicateExpression>(expression);
@@ -123,6 +150,13 @@ bool can_use_value_ids_in_expression(const std::shared_ptr<AbstractExpression>&
 
 namespace opossum {
 
+std::shared_ptr<JitPipelineCache> JitAwareLQPTranslator::default_pipeline_cache{};
+JitExecutionMode JitAwareLQPTranslator::default_execution_mode{JitExecutionMode::Compile};
+
+JitAwareLQPTranslator::JitAwareLQPTranslator(const std::shared_ptr<JitPipelineCache>& pipeline_cache,
+                                             const JitExecutionMode execution_mode)
+    : pipeline_cache(pipeline_cache), execution_mode(execution_mode) {}
+
 std::shared_ptr<AbstractOperator> JitAwareLQPTranslator::translate_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   // Jit operators materialize their output table and cannot be used in non-select queries
@@ -130,7 +164,23 @@ std::shared_ptr<AbstractOperator> JitAwareLQPTranslator::translate_node(
     return LQPTranslator{}.translate_node(node);
   }
   const auto jit_operator = _try_translate_sub_plan_to_jit_operators(node);
-  return jit_operator ? jit_operator : LQPTranslator::translate_node(node);
+  if (!jit_operator) return LQPTranslator::translate_node(node);
+  if (!pipeline_cache) return jit_operator;
+
+  // Translating the subplan is cheap compared to specializing the pipeline, so the cache is only checked afterwards.
+  // On a hit, the new operator pipeline is discarded and the cached one is used with the newly translated inputs.
+  const auto cached_specialized_function_wrapper = pipeline_cache->try_get(node, execution_mode);
+  if (!cached_specialized_function_wrapper) {
+    pipeline_cache->set(node, execution_mode, jit_operator->specialized_function_wrapper());
+    return jit_operator;
+  }
+
+  if (jit_operator->input_right()) {
+    return std::make_shared<JitOperatorWrapper>(jit_operator->input_left(), jit_operator->input_right(),
+                                                execution_mode, cached_specialized_function_wrapper);
+  }
+  return std::make_shared<JitOperatorWrapper>(jit_operator->input_left(), execution_mode,
+                                              cached_specialized_function_wrapper);
 }
 
 std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_plan_to_jit_operators(
@@ -142,10 +192,19 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
   bool use_validate = false;
   bool validate_after_filter = false;
 
+  // At most one join is jitted. Its right input is the build input of the JitOperatorWrapper.
+  auto join_node = std::shared_ptr<AbstractLQPNode>{};
+
   // Traverse query tree until a non-jittable nodes is found in each branch
   visit_lqp(node, [&](auto& current_node) {
+    if (join_node && current_node == join_node->right_input()) return LQPVisitation::DoNotVisitInputs;
+
     const auto is_root_node = current_node == node;
-    if (_node_is_jittable(current_node, is_root_node)) {
+    if (!join_node && is_jittable_join(current_node)) {
+      join_node = current_node;
+      ++jittable_node_count;
+      return LQPVisitation::VisitInputs;
+    } else if (_node_is_jittable(current_node, is_root_node)) {
       use_validate |= current_node->type == LQPNodeType::Validate;
       validate_after_filter |= use_validate && current_node->type == LQPNodeType::Predicate;
       if (requires_computation(current_node)) ++jittable_node_count;
@@ -161,7 +220,8 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
   //   - Always JIT AggregateNodes, as the JitAggregate is significantly faster than the Aggregate operator
   //   - Otherwise, JIT if there are two or more jittable nodes
   if (input_nodes.size() != 1 || jittable_node_count < 1) return nullptr;
-  if (jittable_node_count == 1 && (node->type == LQPNodeType::Projection || node->type == LQPNodeType::Validate)) {
+  if (jittable_node_count == 1 && (node->type == LQPNodeType::Projection || node->type == LQPNodeType::Validate ||
+                                   node->type == LQPNodeType::Join)) {
     return nullptr;
   }
 
@@ -175,12 +235,37 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
   // The input_node is not being integrated into the operator chain, but instead serves as the input to the JitOperators
   const auto input_node = *input_nodes.begin();
 
-  const auto jit_operator = std::make_shared<JitOperatorWrapper>(translate_node(input_node));
+  if (join_node) {
+    // JitValidate operates on the tuples of the probe side only and cannot be placed after the JitHashJoinProbe.
+    // UnionNodes above the join are not supported, as their inputs might not both contain the join.
+    auto nodes_above_join_are_jittable = true;
+    visit_lqp(node, [&](const auto& current_node) {
+      if (current_node == join_node) return LQPVisitation::DoNotVisitInputs;
+      nodes_above_join_are_jittable &=
+          current_node->type != LQPNodeType::Validate && current_node->type != LQPNodeType::Union;
+      return LQPVisitation::VisitInputs;
+    });
+    if (!nodes_above_join_are_jittable) return nullptr;
+
+    // The build input must not be shared with the probe side
+    auto build_node_is_shared = false;
+    visit_lqp(join_node->left_input(), [&](const auto& current_node) {
+      build_node_is_shared |= current_node == join_node->right_input();
+      return current_node == input_node ? LQPVisitation::DoNotVisitInputs : LQPVisitation::VisitInputs;
+    });
+    if (build_node_is_shared) return nullptr;
+  }
+
+  const auto jit_operator =
+      join_node ? std::make_shared<JitOperatorWrapper>(translate_node(input_node),
+                                                       translate_node(join_node->right_input()), execution_mode)
+                : std::make_shared<JitOperatorWrapper>(translate_node(input_node), execution_mode);
   const auto read_tuples = std::make_shared<JitReadTuples>(use_validate, row_count_expression);
   jit_operator->add_jit_operator(read_tuples);
 
-  // "filter_node". The root node of the subplan computed by a JitFilter.
-  auto filter_node = node;
+  // "filter_node". The root node of the subplan computed by a JitFilter. If the subplan contains a join, this filter
+  // is placed before the JitHashJoinProbe and predicates above the join are evaluated by a second JitFilter.
+  auto filter_node = join_node ? join_node->left_input() : node;
   while (filter_node != input_node && filter_node->type != LQPNodeType::Predicate &&
          filter_node->type != LQPNodeType::Union) {
     filter_node = filter_node->left_input();
@@ -203,6 +288,57 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
 
   if (use_validate && validate_after_filter) jit_operator->add_jit_operator(std::make_shared<JitValidate>());
 
+  auto hash_join = JitHashJoinTranslation{};
+  auto* const hash_join_ptr = join_node ? &hash_join : nullptr;
+  if (join_node) {
+    hash_join.build_node = join_node->right_input();
+    hash_join.build_read_tuples = std::make_shared<JitReadTuples>();
+    hash_join.build = std::make_shared<JitHashJoinBuild>();
+    hash_join.probe = std::make_shared<JitHashJoinProbe>(hash_join.build);
+
+    for (const auto& join_predicate : std::static_pointer_cast<JoinNode>(join_node)->join_predicates()) {
+      const auto predicate = std::static_pointer_cast<BinaryPredicateExpression>(join_predicate);
+
+      // Either operand might reference the build node, see is_jittable_join()
+      auto build_operand = predicate->right_operand();
+      auto probe_operand = predicate->left_operand();
+      if (!hash_join.build_node->find_column_id(*build_operand)) std::swap(build_operand, probe_operand);
+      const auto build_column_id = hash_join.build_node->find_column_id(*build_operand);
+
+      const auto probe_key = _try_translate_expression_to_jit_expression(probe_operand, *read_tuples, input_node);
+      if (!probe_key) return nullptr;
+      if (probe_key->expression_type != JitExpressionType::Column) {
+        jit_operator->add_jit_operator(std::make_shared<JitCompute>(probe_key));
+      }
+
+      // The correct nullable information is set when the JitOperatorWrapper is executed with access to the input table.
+      const auto build_key = hash_join.build_read_tuples->add_input_column(build_operand->data_type(), false,
+                                                                          *build_column_id);
+      hash_join.build->add_key_column(build_key);
+      hash_join.probe->add_key_column(probe_key->result_entry);
+    }
+
+    jit_operator->add_build_jit_operator(hash_join.build_read_tuples);
+    jit_operator->add_build_jit_operator(hash_join.build);
+    jit_operator->add_jit_operator(hash_join.probe);
+
+    auto join_filter_node = node;
+    while (join_filter_node != join_node && join_filter_node->type != LQPNodeType::Predicate) {
+      join_filter_node = join_filter_node->left_input();
+    }
+
+    if (join_filter_node != join_node) {
+      const auto boolean_expression = lqp_subplan_to_boolean_expression(join_filter_node, join_node);
+      if (!boolean_expression) return nullptr;
+
+      const auto jit_boolean_expression = _try_translate_expression_to_jit_expression(
+          boolean_expression, *read_tuples, input_node, true, hash_join_ptr);
+      if (!jit_boolean_expression) return nullptr;
+
+      jit_operator->add_jit_operator(std::make_shared<JitFilter>(jit_boolean_expression));
+    }
+  }
+
   if (node->type == LQPNodeType::Aggregate) {
     // Since aggregate nodes cause materialization, there is at most one JitAggregate operator in each operator chain
     // and it must be the last operator of the chain. The _node_is_jittable function takes care of this by rejecting
@@ -215,7 +351,8 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
          ++expression_idx) {
       const auto& groupby_expression = aggregate_node->node_expressions[expression_idx];
       const auto jit_expression =
-          _try_translate_expression_to_jit_expression(groupby_expression, *read_tuples, input_node);
+          _try_translate_expression_to_jit_expression(groupby_expression, *read_tuples, input_node, true,
+                                                                              hash_join_ptr);
       if (!jit_expression) return nullptr;
       // Create a JitCompute operator for each computed groupby column ...
       if (jit_expression->expression_type != JitExpressionType::Column) {
@@ -241,8 +378,8 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
         aggregate->add_aggregate_column(aggregate_expression->as_column_name(), {DataType::Long, false, tuple_index},
                                         aggregate_expression->aggregate_function);
       } else {
-        const auto jit_expression =
-            _try_translate_expression_to_jit_expression(aggregate_expression->arguments[0], *read_tuples, input_node);
+        const auto jit_expression = _try_translate_expression_to_jit_expression(
+            aggregate_expression->arguments[0], *read_tuples, input_node, true, hash_join_ptr);
         if (!jit_expression) return nullptr;
         // Create a JitCompute operator for each aggregate expression on a computed value ...
         if (jit_expression->expression_type != JitExpressionType::Column) {
@@ -270,8 +407,8 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
       auto write_table = std::make_shared<JitWriteTuples>();
 
       for (const auto& column_expression : node->column_expressions()) {
-        const auto jit_expression =
-            _try_translate_expression_to_jit_expression(column_expression, *read_tuples, input_node);
+        const auto jit_expression = _try_translate_expression_to_jit_expression(column_expression, *read_tuples,
+                                                                                input_node, true, hash_join_ptr);
         if (!jit_expression) return nullptr;
         // Add a compute operator for each computed output column (i.e., a column that is not from a stored table).
         if (jit_expression->expression_type != JitExpressionType::Column) {
@@ -311,7 +448,8 @@ bool is_between_jit_expression_type_upper_inclusive(JitExpressionType jit_expres
 
 std::shared_ptr<JitExpression> JitAwareLQPTranslator::_try_translate_expression_to_jit_expression(
     const std::shared_ptr<AbstractExpression>& expression, JitReadTuples& jit_source,
-    const std::shared_ptr<AbstractLQPNode>& input_node, const bool use_actual_value) const {
+    const std::shared_ptr<AbstractLQPNode>& input_node, const bool use_actual_value,
+    JitHashJoinTranslation* hash_join) const {
   const auto input_node_column_id = input_node->find_column_id(*expression);
   if (input_node_column_id) {
     // The correct nullable information is set when the JitOperatorWrapper is executed with access to the input table.
@@ -321,6 +459,26 @@ std::shared_ptr<JitExpression> JitAwareLQPTranslator::_try_translate_expression_
     return std::make_shared<JitExpression>(tuple_entry);
   }
 
+  if (hash_join) {
+    const auto build_node_column_id = hash_join->build_node->find_column_id(*expression);
+    if (build_node_column_id) {
+      // Columns of the build node are read by the build pipeline, stored in the hash table and written to a tuple
+      // entry of the probe pipeline by the JitHashJoinProbe
+      auto iter = hash_join->probe_entries_by_build_column_id.find(*build_node_column_id);
+      if (iter == hash_join->probe_entries_by_build_column_id.end()) {
+        const auto data_type = expression->data_type();
+        const auto build_entry =
+            hash_join->build_read_tuples->add_input_column(data_type, false, *build_node_column_id);
+        hash_join->build->add_value_column(build_entry);
+
+        const auto probe_entry = JitTupleEntry{data_type, false, jit_source.add_temporary_value()};
+        hash_join->probe->add_value_column(probe_entry);
+        iter = hash_join->probe_entries_by_build_column_id.emplace(*build_node_column_id, probe_entry).first;
+      }
+      return std::make_shared<JitExpression>(iter->second);
+    }
+  }
+
   std::shared_ptr<const JitExpression> left, right;
   switch (expression->type) {
     case ExpressionType::Value: {
@@ -342,7 +500,12 @@ std::shared_ptr<JitExpression> JitAwareLQPTranslator::_try_translate_expression_
     case ExpressionType::Predicate:
     case ExpressionType::Arithmetic:
     case ExpressionType::Logical: {
-      const bool use_value_ids = can_use_value_ids_in_expression(expression);
+      // Value ids are only available for columns of the input node, not for those of a join's build node
+      const bool use_value_ids =
+          can_use_value_ids_in_expression(expression) &&
+          std::all_of(expression->arguments.begin(), expression->arguments.end(), [&](const auto& argument) {
+            return argument->type != ExpressionType::LQPColumn || input_node->find_column_id(*argument);
+          });
 
       // TODO(anybody) Operands with differing types not supported by JIT, see #1606
       for (size_t argument_idx{1}; argument_idx < expression->arguments.size(); ++argument_idx) {
@@ -354,7 +517,7 @@ std::shared_ptr<JitExpression> JitAwareLQPTranslator::_try_translate_expression_
       std::vector<std::shared_ptr<JitExpression>> jit_expression_arguments;
       for (const auto& argument : expression->arguments) {
         const auto jit_expression =
-            _try_translate_expression_to_jit_expression(argument, jit_source, input_node, !use_value_ids);
+            _try_translate_expression_to_jit_expression(argument, jit_source, input_node, !use_value_ids, hash_join);
         if (!jit_expression) return nullptr;
         jit_expression_arguments.emplace_back(jit_expression);
       }
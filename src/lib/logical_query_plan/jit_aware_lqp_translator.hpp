@@ -4,7 +4,13 @@
 
 #if HYRISE_JIT_SUPPORT
 
+#include <unordered_map>
+
+#include "operators/jit_operator/jit_pipeline_cache.hpp"
 #include "operators/jit_operator/operators/jit_expression.hpp"
+#include "operators/jit_operator/operators/jit_hash_join_build.hpp"
+#include "operators/jit_operator/operators/jit_hash_join_probe.hpp"
+#include "operators/jit_operator/operators/jit_read_tuples.hpp"
 #include "operators/jit_operator_wrapper.hpp"
 
 namespace opossum {
@@ -36,12 +42,46 @@ namespace opossum {
  *    can in turn reference a LQPExpression in a ProjectionNode) is encountered, it is converted to an JitExpression
  *    by a helper method first. We then add a JitCompute operator to our chain and use its result value instead of the
  *    original non-primitive value.
+ *
+ * An inner equi-join can be part of the jitted subplan as well, as long as no other join, no ValidateNode and no
+ * UnionNode is placed above it. Its right input is not traversed, but becomes the build input of the
+ * JitOperatorWrapper: A second pipeline (JitReadTuples -> JitHashJoinBuild) builds a hash table on it, which the
+ * JitHashJoinProbe operator in the main pipeline probes. Columns of the build input that are accessed above the join
+ * are stored in the hash table and written to the runtime tuple of the main pipeline for each match.
+ *
+ * If a JitPipelineCache is set, JitOperatorWrappers translated from equal subplans share their pipeline, so that it is
+ * only specialized once (see jit_pipeline_cache.hpp).
  */
 class JitAwareLQPTranslator final : public LQPTranslator {
  public:
+  // The cache used by JitAwareLQPTranslators constructed without an explicit cache. Not set by default.
+  static std::shared_ptr<JitPipelineCache> default_pipeline_cache;
+
+  // The execution mode of the JitOperatorWrappers created by JitAwareLQPTranslators constructed without an explicit
+  // mode. JitExecutionMode::Tiered is most useful in combination with a JitPipelineCache, so that the executions of
+  // equal subplans count towards the same pipeline. The BenchmarkRunner sets it for the --jit_tiered option.
+  static JitExecutionMode default_execution_mode;
+
+  explicit JitAwareLQPTranslator(const std::shared_ptr<JitPipelineCache>& pipeline_cache = default_pipeline_cache,
+                                 const JitExecutionMode execution_mode = default_execution_mode);
+
   std::shared_ptr<AbstractOperator> translate_node(const std::shared_ptr<AbstractLQPNode>& node) const final;
 
+  const std::shared_ptr<JitPipelineCache> pipeline_cache;
+  const JitExecutionMode execution_mode;
+
  private:
+  // The operators and tuple entries created for a hash join within the jitted subplan
+  struct JitHashJoinTranslation {
+    std::shared_ptr<AbstractLQPNode> build_node;
+    std::shared_ptr<JitReadTuples> build_read_tuples;
+    std::shared_ptr<JitHashJoinBuild> build;
+    std::shared_ptr<JitHashJoinProbe> probe;
+
+    // Tuple entries in the probe pipeline that hold the values of the build node's columns
+    std::unordered_map<ColumnID, JitTupleEntry> probe_entries_by_build_column_id;
+  };
+
   std::shared_ptr<JitOperatorWrapper> _try_translate_sub_plan_to_jit_operators(
       const std::shared_ptr<AbstractLQPNode>& node) const;
 
@@ -50,11 +90,14 @@ class JitAwareLQPTranslator final : public LQPTranslator {
    * @param jit_source        JitReadTuples operator used to add input columns, literals or parameters
    * @param input_node        Input node to check for input columns
    * @param use_actual_value  Specifies whether a column should either load an actual value or a value id
+   * @param hash_join         Hash join to resolve columns of its build node with, if the expression is evaluated
+   *                          after a JitHashJoinProbe
    * @return                  Translated expression
    */
   std::shared_ptr<JitExpression> _try_translate_expression_to_jit_expression(
       const std::shared_ptr<AbstractExpression>& expression, JitReadTuples& jit_source,
-      const std::shared_ptr<AbstractLQPNode>& input_node, const bool use_actual_value = true) const;
+      const std::shared_ptr<AbstractLQPNode>& input_node, const bool use_actual_value = true,
+      JitHashJoinTranslation* hash_join = nullptr) const;
 
   // Returns whether an LQP node with its current configuration can be part of an operator pipeline.
   bool _node_is_jittable(const std::shared_ptr<AbstractLQPNode>& node, const bool is_root_node) const;
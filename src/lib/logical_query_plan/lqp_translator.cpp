@@ -31,8 +31,10 @@
 #include "expression/pqp_subquery_expression.hpp"
 #include "expression/value_expression.hpp"
 #include "insert_node.hpp"
+#include "intermediate_table_node.hpp"
 #include "join_node.hpp"
 #include "limit_node.hpp"
+#include "lqp_utils.hpp"
 #include "operators/aggregate_hash.hpp"
 #include "operators/alias_operator.hpp"
 #include "operators/delete.hpp"
@@ -57,9 +59,11 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_positions.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
+#include "statistics/table_statistics.hpp"
 #include "predicate_node.hpp"
 #include "projection_node.hpp"
 #include "show_columns_node.hpp"
@@ -117,6 +121,7 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_by_node_type(
     case LQPNodeType::Insert:             return _translate_insert_node(node);
     case LQPNodeType::Delete:             return _translate_delete_node(node);
     case LQPNodeType::DummyTable:         return _translate_dummy_table_node(node);
+    case LQPNodeType::IntermediateTable:  return _translate_intermediate_table_node(node);
     case LQPNodeType::Update:             return _translate_update_node(node);
     case LQPNodeType::Validate:           return _translate_validate_node(node);
     case LQPNodeType::Union:              return _translate_union_node(node);
@@ -257,31 +262,26 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
   const auto sort_node = std::dynamic_pointer_cast<SortNode>(node);
   auto input_operator = translate_node(node->left_input());
 
-  /**
-   * Go through all the order descriptions and create a sort operator for each of them.
-   * Iterate in reverse because the sort operator does not support multiple columns, and instead relies on stable sort.
-   * We therefore sort by the n+1-th column before sorting by the n-th column.
-   */
+  return std::make_shared<Sort>(input_operator, _translate_sort_definitions(sort_node));
+}
 
-  std::shared_ptr<AbstractOperator> current_pqp = input_operator;
-  const auto& pqp_expressions = _translate_expressions(sort_node->node_expressions, node->left_input());
-  if (pqp_expressions.size() > 1) {
-    PerformanceWarning("Multiple ORDER BYs are executed one-by-one");
-  }
+std::vector<SortColumnDefinition> LQPTranslator::_translate_sort_definitions(
+    const std::shared_ptr<SortNode>& sort_node) const {
+  const auto& pqp_expressions = _translate_expressions(sort_node->node_expressions, sort_node->left_input());
 
-  auto pqp_expression_iter = pqp_expressions.rbegin();
-  auto order_by_mode_iter = sort_node->order_by_modes.rbegin();
+  auto sort_definitions = std::vector<SortColumnDefinition>{};
+  sort_definitions.reserve(pqp_expressions.size());
 
-  for (; pqp_expression_iter != pqp_expressions.rend(); ++pqp_expression_iter, ++order_by_mode_iter) {
-    const auto& pqp_expression = *pqp_expression_iter;
+  for (auto expression_idx = size_t{0}; expression_idx < pqp_expressions.size(); ++expression_idx) {
+    const auto& pqp_expression = pqp_expressions[expression_idx];
     const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(pqp_expression);
     Assert(pqp_column_expression,
            "Sort Expression '"s + pqp_expression->as_column_name() + "' must be available as column, LQP is invalid");
 
-    current_pqp = std::make_shared<Sort>(current_pqp, pqp_column_expression->column_id, *order_by_mode_iter);
+    sort_definitions.emplace_back(pqp_column_expression->column_id, sort_node->order_by_modes[expression_idx]);
   }
 
-  return current_pqp;
+  return sort_definitions;
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
@@ -311,6 +311,8 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
   }
 
   const auto& primary_join_predicate = join_predicates.front();
+  _add_runtime_chunk_pruning(join_node, primary_join_predicate);
+
   std::vector<OperatorJoinPredicate> secondary_join_predicates(join_predicates.cbegin() + 1, join_predicates.cend());
 
   auto join_operator = std::shared_ptr<AbstractOperator>{};
@@ -340,6 +342,76 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
   return join_operator;
 }
 
+void LQPTranslator::_add_runtime_chunk_pruning(const std::shared_ptr<JoinNode>& join_node,
+                                               const OperatorJoinPredicate& primary_join_predicate) const {
+  /**
+   * Sideways information passing: If one input of an inner or semi equi-join is a chain of filters on top of a
+   * StoredTableNode, the keys found in the other input at runtime can be used to skip stored Chunks whose statistics
+   * rule out a match (see GetTable::set_runtime_pruning()). This pays off when the other input is the smaller one,
+   * e.g., a selective dimension table that determines which parts of a fact table are relevant.
+   */
+  if (join_node->join_mode != JoinMode::Inner && join_node->join_mode != JoinMode::Semi) return;
+  if (primary_join_predicate.predicate_condition != PredicateCondition::Equals) return;
+
+  // Returns the StoredTableNode at the bottom of a chain of Predicate- and ValidateNodes, which forward the stored
+  // columns unchanged. If any node in the chain is used by other nodes as well, they would observe the pruning.
+  const auto find_stored_table_node = [](const std::shared_ptr<AbstractLQPNode>& input) {
+    auto current_node = input;
+    while (current_node->type == LQPNodeType::Predicate || current_node->type == LQPNodeType::Validate) {
+      if (current_node->output_count() > 1) return std::shared_ptr<StoredTableNode>{};
+      current_node = current_node->left_input();
+    }
+    if (current_node->type != LQPNodeType::StoredTable || current_node->output_count() > 1) {
+      return std::shared_ptr<StoredTableNode>{};
+    }
+    return std::static_pointer_cast<StoredTableNode>(current_node);
+  };
+
+  // Estimating the cardinality of an input requires all its leaves to provide statistics
+  const auto has_statistics = [](const std::shared_ptr<AbstractLQPNode>& input) {
+    auto statistics_available = true;
+    visit_lqp(input, [&](const auto& node) {
+      if (node->type == LQPNodeType::DummyTable) statistics_available = false;
+      return statistics_available ? LQPVisitation::VisitInputs : LQPVisitation::DoNotVisitInputs;
+    });
+    return statistics_available;
+  };
+
+  const auto left_stored_table_node = find_stored_table_node(join_node->left_input());
+  const auto right_stored_table_node = find_stored_table_node(join_node->right_input());
+  if (!left_stored_table_node && !right_stored_table_node) return;
+  if (!has_statistics(join_node->left_input()) || !has_statistics(join_node->right_input())) return;
+
+  // Prune the input that is expected to be larger, the keys of the other one are cheaper to collect
+  const auto left_row_count = join_node->left_input()->get_statistics()->row_count();
+  const auto right_row_count = join_node->right_input()->get_statistics()->row_count();
+  if (left_row_count == right_row_count) return;
+
+  const auto prune_left_input = left_row_count > right_row_count;
+  const auto& stored_table_node = prune_left_input ? left_stored_table_node : right_stored_table_node;
+  if (!stored_table_node) return;
+
+  const auto& pruned_input = prune_left_input ? join_node->left_input() : join_node->right_input();
+  const auto& key_input = prune_left_input ? join_node->right_input() : join_node->left_input();
+  const auto pruned_input_column_id =
+      prune_left_input ? primary_join_predicate.column_ids.first : primary_join_predicate.column_ids.second;
+  const auto key_column_id =
+      prune_left_input ? primary_join_predicate.column_ids.second : primary_join_predicate.column_ids.first;
+
+  const auto column_expression =
+      std::dynamic_pointer_cast<LQPColumnExpression>(pruned_input->column_expressions()[pruned_input_column_id]);
+  if (!column_expression || column_expression->column_reference.original_node() != stored_table_node) return;
+
+  // ChunkStatistics are queried with the keys as they are, avoid lossy conversions between different data types
+  if (column_expression->data_type() != key_input->column_expressions()[key_column_id]->data_type()) return;
+
+  const auto get_table = std::dynamic_pointer_cast<GetTable>(translate_node(stored_table_node));
+  if (!get_table || get_table->runtime_pruning_column_id()) return;
+
+  get_table->set_runtime_pruning(translate_node(key_input), key_column_id,
+                                 column_expression->column_reference.original_column_id());
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto aggregate_node = std::dynamic_pointer_cast<AggregateNode>(node);
@@ -389,10 +461,23 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_limit_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  const auto input_operator = translate_node(node->left_input());
   auto limit_node = std::dynamic_pointer_cast<LimitNode>(node);
-  return std::make_shared<Limit>(
-      input_operator, _translate_expressions({limit_node->num_rows_expression()}, node->left_input()).front());
+  const auto row_count_expression =
+      _translate_expressions({limit_node->num_rows_expression()}, node->left_input()).front();
+
+  /**
+   * A Limit on top of a Sort is executed as a TopK, which does not sort the entire input. The LimitPushdownRule moves
+   * LimitNodes below ProjectionNodes so that they end up directly on top of the SortNode. If the SortNode has other
+   * outputs, they need the fully sorted table, so it stays a Sort.
+   */
+  const auto sort_node = std::dynamic_pointer_cast<SortNode>(node->left_input());
+  if (sort_node && sort_node->output_count() == 1) {
+    const auto input_operator = translate_node(sort_node->left_input());
+    return std::make_shared<TopK>(input_operator, _translate_sort_definitions(sort_node), row_count_expression);
+  }
+
+  const auto input_operator = translate_node(node->left_input());
+  return std::make_shared<Limit>(input_operator, row_count_expression);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_insert_node(
@@ -490,6 +575,12 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_dummy_table_node(
   return std::make_shared<TableWrapper>(Projection::dummy_table());
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_intermediate_table_node(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto intermediate_table_node = std::static_pointer_cast<IntermediateTableNode>(node);
+  return std::make_shared<TableWrapper>(intermediate_table_node->table);
+}
+
 std::shared_ptr<AbstractExpression> LQPTranslator::_translate_expression(
     const std::shared_ptr<AbstractExpression>& lqp_expression, const std::shared_ptr<AbstractLQPNode>& node) const {
   auto pqp_expression = lqp_expression->deep_copy();
@@ -212,6 +212,7 @@ std::set<std::string> lqp_find_modified_tables(const std::shared_ptr<AbstractLQP
       case LQPNodeType::CreateView:
       case LQPNodeType::DropView:
       case LQPNodeType::DummyTable:
+      case LQPNodeType::IntermediateTable:
       case LQPNodeType::Join:
       case LQPNodeType::Limit:
       case LQPNodeType::Predicate:
@@ -1,5 +1,7 @@
 #include "stored_table_node.hpp"
 
+#include "boost/functional/hash.hpp"
+
 #include "expression/lqp_column_expression.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/storage_manager.hpp"
@@ -137,4 +139,6 @@ bool StoredTableNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNo
          _pruned_column_ids == stored_table_node._pruned_column_ids;
 }
 
+size_t StoredTableNode::_on_shallow_hash() const { return boost::hash_value(table_name); }
+
 }  // namespace opossum
@@ -84,6 +84,11 @@ std::shared_ptr<AbstractOperator> AbstractOperator::deep_copy() const {
   return _deep_copy_impl(copied_ops);
 }
 
+std::shared_ptr<AbstractOperator> AbstractOperator::deep_copy(
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const {
+  return _deep_copy_impl(copied_ops);
+}
+
 std::shared_ptr<const Table> AbstractOperator::input_table_left() const { return _input_left->get_output(); }
 
 std::shared_ptr<const Table> AbstractOperator::input_table_right() const { return _input_right->get_output(); }
@@ -22,9 +22,11 @@ enum class OperatorType {
   Difference,
   ExportBinary,
   ExportCsv,
+  ExportParquet,
   GetTable,
   ImportBinary,
   ImportCsv,
+  ImportParquet,
   IndexScan,
   Insert,
   JitOperatorWrapper,
@@ -41,6 +43,7 @@ enum class OperatorType {
   Sort,
   TableScan,
   TableWrapper,
+  TopK,
   UnionAll,
   UnionPositions,
   Update,
@@ -109,6 +112,11 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // An operator needs to implement this method in order to be cacheable.
   std::shared_ptr<AbstractOperator> deep_copy() const;
 
+  // Like deep_copy(), but uses the operators in @param copied_ops instead of copying the operators they are mapped
+  // from. This allows to instantiate the upper part of a PQP on top of another input.
+  std::shared_ptr<AbstractOperator> deep_copy(
+      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const;
+
   // Get the input operators.
   std::shared_ptr<const AbstractOperator> input_left() const;
   std::shared_ptr<const AbstractOperator> input_right() const;
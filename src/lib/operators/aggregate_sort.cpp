@@ -339,12 +339,17 @@ std::shared_ptr<const Table> AggregateSort::_on_execute() {
    * However, we did not benchmark it, so we cannot prove it.
    */
 
-  // Sort input table consecutively by the group by columns (stable sort)
+  // Sort input table by all group by columns at once
   auto sorted_table = input_table;
-  for (const auto& column_id : _groupby_column_ids) {
-    const auto sorted_wrapper = std::make_shared<TableWrapper>(sorted_table);
-    sorted_wrapper->execute();
-    Sort sort = Sort(sorted_wrapper, column_id);
+  if (!_groupby_column_ids.empty()) {
+    auto sort_definitions = std::vector<SortColumnDefinition>{};
+    for (const auto& column_id : _groupby_column_ids) {
+      sort_definitions.emplace_back(column_id);
+    }
+
+    const auto input_wrapper = std::make_shared<TableWrapper>(input_table);
+    input_wrapper->execute();
+    Sort sort = Sort(input_wrapper, sort_definitions);
     sort.execute();
     sorted_table = sort.get_output();
   }
@@ -107,6 +107,8 @@ void Delete::_on_commit_records(const CommitID cid) {
     if (table_statistics) {
       table_statistics->increase_invalid_row_count(referencing_segment->pos_list()->size());
     }
+
+    referenced_table->update_last_modified_commit_id(cid);
   }
 }
 
@@ -0,0 +1,275 @@
+#include "export_parquet.hpp"
+
+#include <cmath>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "constant_mappings.hpp"
+#include "import_export/parquet.hpp"
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Location and statistics of a column chunk, which are written to the file metadata after all row groups
+struct ColumnChunkMetaData {
+  int64_t data_page_offset;
+  int64_t size;
+  int64_t null_count;
+  // Encoded as in the PLAIN encoding without length, not set if there are no non-NULL values or the column contains NaN
+  std::optional<std::string> min_value;
+  std::optional<std::string> max_value;
+};
+
+ParquetType parquet_type(const DataType data_type) {
+  switch (data_type) {
+    case DataType::Int:
+      return ParquetType::Int32;
+    case DataType::Long:
+      return ParquetType::Int64;
+    case DataType::Float:
+      return ParquetType::Float;
+    case DataType::Double:
+      return ParquetType::Double;
+    case DataType::String:
+      return ParquetType::ByteArray;
+    case DataType::Null:
+    case DataType::Bool:
+      break;
+  }
+  Fail("Cannot export columns of type " + data_type_to_string.left.at(data_type) + " to Parquet");
+}
+
+/**
+ * Encodes a segment as a data page, i.e., the definition levels (if the column is nullable) followed by the PLAIN
+ * encoded non-NULL values, and collects the statistics of the segment.
+ */
+template <typename T>
+std::string encode_data_page(const BaseSegment& segment, const bool is_nullable, ColumnChunkMetaData& meta_data) {
+  auto values = std::string{};
+  auto null_values = std::vector<bool>{};
+  if (is_nullable) null_values.reserve(segment.size());
+
+  auto min = std::optional<T>{};
+  auto max = std::optional<T>{};
+  auto contains_nan = false;
+
+  segment_iterate<T>(segment, [&](const auto& position) {
+    if (is_nullable) null_values.emplace_back(position.is_null());
+    if (position.is_null()) {
+      ++meta_data.null_count;
+      return;
+    }
+
+    const auto& value = position.value();
+    append_parquet_plain_value(values, value);
+
+    // clang-format off
+    if constexpr (std::is_floating_point_v<T>) {
+      if (std::isnan(value)) {
+        contains_nan = true;
+        return;
+      }
+    }
+    // clang-format on
+    if (!min || value < *min) min = value;
+    if (!max || value > *max) max = value;
+  });
+
+  if (min && !contains_nan) {
+    meta_data.min_value = encode_parquet_statistics_value(*min);
+    meta_data.max_value = encode_parquet_statistics_value(*max);
+  }
+
+  auto page = std::string{};
+  if (is_nullable) append_parquet_definition_levels(page, null_values);
+  page.append(values);
+  return page;
+}
+
+std::string encode_page_header(const ChunkOffset row_count, const size_t page_size) {
+  namespace fields = parquet_fields;
+
+  auto writer = ThriftCompactWriter{};
+  writer.begin_struct();
+  writer.write_i32(fields::PageHeader::TYPE, static_cast<int32_t>(ParquetPageType::DataPage));
+  writer.write_i32(fields::PageHeader::UNCOMPRESSED_PAGE_SIZE, static_cast<int32_t>(page_size));
+  writer.write_i32(fields::PageHeader::COMPRESSED_PAGE_SIZE, static_cast<int32_t>(page_size));
+  writer.begin_struct(fields::PageHeader::DATA_PAGE_HEADER);
+  writer.write_i32(fields::DataPageHeader::NUM_VALUES, static_cast<int32_t>(row_count));
+  writer.write_i32(fields::DataPageHeader::ENCODING, static_cast<int32_t>(ParquetEncoding::Plain));
+  writer.write_i32(fields::DataPageHeader::DEFINITION_LEVEL_ENCODING, static_cast<int32_t>(ParquetEncoding::Rle));
+  writer.write_i32(fields::DataPageHeader::REPETITION_LEVEL_ENCODING, static_cast<int32_t>(ParquetEncoding::Rle));
+  writer.end_struct();
+  writer.end_struct();
+  return writer.buffer();
+}
+
+std::string encode_file_meta_data(const Table& table, const std::vector<ChunkID>& row_group_chunk_ids,
+                                  const std::vector<std::vector<ColumnChunkMetaData>>& row_groups) {
+  namespace fields = parquet_fields;
+
+  const auto column_count = table.column_count();
+
+  auto writer = ThriftCompactWriter{};
+  writer.begin_struct();
+  writer.write_i32(fields::FileMetaData::VERSION, 1);
+
+  // The schema is a tree, whose root has a child for each column
+  writer.begin_list(fields::FileMetaData::SCHEMA, ThriftType::Struct, column_count + 1);
+  writer.begin_struct();
+  writer.write_binary(fields::SchemaElement::NAME, "schema");
+  writer.write_i32(fields::SchemaElement::NUM_CHILDREN, column_count);
+  writer.end_struct();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto data_type = table.column_data_type(column_id);
+    const auto repetition_type =
+        table.column_is_nullable(column_id) ? ParquetRepetitionType::Optional : ParquetRepetitionType::Required;
+
+    writer.begin_struct();
+    writer.write_i32(fields::SchemaElement::TYPE, static_cast<int32_t>(parquet_type(data_type)));
+    writer.write_i32(fields::SchemaElement::REPETITION_TYPE, static_cast<int32_t>(repetition_type));
+    writer.write_binary(fields::SchemaElement::NAME, table.column_name(column_id));
+    if (data_type == DataType::String) {
+      writer.write_i32(fields::SchemaElement::CONVERTED_TYPE, static_cast<int32_t>(ParquetConvertedType::Utf8));
+    }
+    writer.end_struct();
+  }
+
+  auto row_count = uint64_t{0};
+  for (const auto chunk_id : row_group_chunk_ids) {
+    row_count += table.get_chunk(chunk_id)->size();
+  }
+  writer.write_i64(fields::FileMetaData::NUM_ROWS, static_cast<int64_t>(row_count));
+
+  writer.begin_list(fields::FileMetaData::ROW_GROUPS, ThriftType::Struct, row_groups.size());
+  for (auto row_group_index = size_t{0}; row_group_index < row_groups.size(); ++row_group_index) {
+    const auto chunk_row_count = table.get_chunk(row_group_chunk_ids[row_group_index])->size();
+    auto total_byte_size = int64_t{0};
+
+    writer.begin_struct();
+    writer.begin_list(fields::RowGroup::COLUMNS, ThriftType::Struct, column_count);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      const auto& column_chunk = row_groups[row_group_index][column_id];
+      total_byte_size += column_chunk.size;
+
+      writer.begin_struct();
+      writer.write_i64(fields::ColumnChunk::FILE_OFFSET, column_chunk.data_page_offset);
+      writer.begin_struct(fields::ColumnChunk::META_DATA);
+      writer.write_i32(fields::ColumnMetaData::TYPE,
+                       static_cast<int32_t>(parquet_type(table.column_data_type(column_id))));
+      writer.begin_list(fields::ColumnMetaData::ENCODINGS, ThriftType::I32, 2);
+      writer.write_i32(static_cast<int32_t>(ParquetEncoding::Plain));
+      writer.write_i32(static_cast<int32_t>(ParquetEncoding::Rle));
+      writer.begin_list(fields::ColumnMetaData::PATH_IN_SCHEMA, ThriftType::Binary, 1);
+      writer.write_binary(table.column_name(column_id));
+      writer.write_i32(fields::ColumnMetaData::CODEC, static_cast<int32_t>(ParquetCompressionCodec::Uncompressed));
+      writer.write_i64(fields::ColumnMetaData::NUM_VALUES, chunk_row_count);
+      writer.write_i64(fields::ColumnMetaData::TOTAL_UNCOMPRESSED_SIZE, column_chunk.size);
+      writer.write_i64(fields::ColumnMetaData::TOTAL_COMPRESSED_SIZE, column_chunk.size);
+      writer.write_i64(fields::ColumnMetaData::DATA_PAGE_OFFSET, column_chunk.data_page_offset);
+      writer.begin_struct(fields::ColumnMetaData::STATISTICS);
+      writer.write_i64(fields::Statistics::NULL_COUNT, column_chunk.null_count);
+      if (column_chunk.min_value) {
+        writer.write_binary(fields::Statistics::MAX_VALUE, *column_chunk.max_value);
+        writer.write_binary(fields::Statistics::MIN_VALUE, *column_chunk.min_value);
+      }
+      writer.end_struct();
+      writer.end_struct();
+      writer.end_struct();
+    }
+    writer.write_i64(fields::RowGroup::TOTAL_BYTE_SIZE, total_byte_size);
+    writer.write_i64(fields::RowGroup::NUM_ROWS, chunk_row_count);
+    writer.end_struct();
+  }
+
+  writer.write_binary(fields::FileMetaData::CREATED_BY, "hyrise");
+
+  // Without column orders, readers must not rely on the min and max values
+  writer.begin_list(fields::FileMetaData::COLUMN_ORDERS, ThriftType::Struct, column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    writer.begin_struct();
+    writer.begin_struct(fields::ColumnOrder::TYPE_ORDER);
+    writer.end_struct();
+    writer.end_struct();
+  }
+
+  writer.end_struct();
+  return writer.buffer();
+}
+
+}  // namespace
+
+namespace opossum {
+
+ExportParquet::ExportParquet(const std::shared_ptr<const AbstractOperator>& in, const std::string& filename)
+    : AbstractReadOnlyOperator(OperatorType::ExportParquet, in), _filename(filename) {}
+
+void ExportParquet::write_parquet(const Table& table, const std::string& filename) {
+  std::ofstream ofstream;
+  ofstream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+  ofstream.open(filename, std::ios::binary);
+
+  ofstream << PARQUET_MAGIC_NUMBER;
+  auto offset = static_cast<int64_t>(PARQUET_MAGIC_NUMBER.size());
+
+  auto row_group_chunk_ids = std::vector<ChunkID>{};
+  auto row_groups = std::vector<std::vector<ColumnChunkMetaData>>{};
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    // Empty chunks, e.g., those of which all rows were deleted, are not written
+    if (chunk->size() == 0) continue;
+
+    auto& column_chunks = row_groups.emplace_back();
+    row_group_chunk_ids.emplace_back(chunk_id);
+
+    for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+      auto column_chunk = ColumnChunkMetaData{offset, 0, 0, std::nullopt, std::nullopt};
+
+      auto page = std::string{};
+      resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        page = encode_data_page<ColumnDataType>(*chunk->get_segment(column_id), table.column_is_nullable(column_id),
+                                                column_chunk);
+      });
+      const auto page_header = encode_page_header(chunk->size(), page.size());
+
+      ofstream << page_header << page;
+      column_chunk.size = static_cast<int64_t>(page_header.size() + page.size());
+      offset += column_chunk.size;
+      column_chunks.emplace_back(std::move(column_chunk));
+    }
+  }
+
+  const auto file_meta_data = encode_file_meta_data(table, row_group_chunk_ids, row_groups);
+  const auto file_meta_data_size = static_cast<uint32_t>(file_meta_data.size());
+  ofstream << file_meta_data;
+  ofstream.write(reinterpret_cast<const char*>(&file_meta_data_size), sizeof(file_meta_data_size));
+  ofstream << PARQUET_MAGIC_NUMBER;
+}
+
+const std::string ExportParquet::name() const { return "ExportParquet"; }
+
+std::shared_ptr<const Table> ExportParquet::_on_execute() {
+  write_parquet(*input_table_left(), _filename);
+  return _input_left->get_output();
+}
+
+std::shared_ptr<AbstractOperator> ExportParquet::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<ExportParquet>(copied_input_left, _filename);
+}
+
+void ExportParquet::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+}  // namespace opossum
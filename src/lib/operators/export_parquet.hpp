@@ -0,0 +1,42 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "abstract_read_only_operator.hpp"
+
+namespace opossum {
+
+/**
+ * Writes the input table as an Apache Parquet file (see import_export/parquet.hpp for the supported subset). Each
+ * non-empty chunk becomes a row group with one column chunk per column, each of which consists of a single data page.
+ * The min and max value and the null count of each column chunk are stored as statistics, so that readers can skip
+ * row groups.
+ */
+class ExportParquet : public AbstractReadOnlyOperator {
+ public:
+  explicit ExportParquet(const std::shared_ptr<const AbstractOperator>& in, const std::string& filename);
+
+  static void write_parquet(const Table& table, const std::string& filename);
+
+  /**
+   * Executes the export operator
+   * @return The table that was also the input
+   */
+  std::shared_ptr<const Table> _on_execute() final;
+
+  const std::string name() const final;
+
+ protected:
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+ private:
+  // Path of the Parquet file
+  const std::string _filename;
+};
+
+}  // namespace opossum
@@ -1,12 +1,14 @@
 #include "get_table.hpp"
 
 #include <algorithm>
+#include <iterator>
 #include <memory>
 #include <sstream>
 #include <string>
 #include <unordered_set>
 #include <vector>
 
+#include "join_key_filter.hpp"
 #include "storage/storage_manager.hpp"
 #include "types.hpp"
 
@@ -48,6 +50,11 @@ const std::string GetTable::description(DescriptionMode description_mode) const
   if (description_mode == DescriptionMode::SingleLine) stream << ",";
   stream << separator << _pruned_column_ids.size() << "/" << stored_table->column_count() << " column(s)";
 
+  if (_runtime_pruning_column_id) {
+    if (description_mode == DescriptionMode::SingleLine) stream << ",";
+    stream << separator << "runtime pruning on " << stored_table->column_name(*_runtime_pruning_column_id);
+  }
+
   return stream.str();
 }
 
@@ -57,10 +64,28 @@ const std::vector<ChunkID>& GetTable::pruned_chunk_ids() const { return _pruned_
 
 const std::vector<ColumnID>& GetTable::pruned_column_ids() const { return _pruned_column_ids; }
 
+void GetTable::set_runtime_pruning(const std::shared_ptr<const AbstractOperator>& key_source,
+                                   const ColumnID key_column_id, const ColumnID column_id) {
+  Assert(key_source, "Runtime pruning requires an operator providing the join keys");
+  Assert(!_input_left, "GetTable already has a source for runtime pruning");
+
+  _input_left = key_source;
+  _runtime_pruning_key_column_id = key_column_id;
+  _runtime_pruning_column_id = column_id;
+}
+
+const std::optional<ColumnID>& GetTable::runtime_pruning_column_id() const { return _runtime_pruning_column_id; }
+
+const std::vector<ChunkID>& GetTable::runtime_pruned_chunk_ids() const { return _runtime_pruned_chunk_ids; }
+
 std::shared_ptr<AbstractOperator> GetTable::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<GetTable>(_name, _pruned_chunk_ids, _pruned_column_ids);
+  const auto copy = std::make_shared<GetTable>(_name, _pruned_chunk_ids, _pruned_column_ids);
+  if (copied_input_left) {
+    copy->set_runtime_pruning(copied_input_left, *_runtime_pruning_key_column_id, *_runtime_pruning_column_id);
+  }
+  return copy;
 }
 
 void GetTable::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -80,11 +105,34 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
     }
   }
 
+  /**
+   * Determine the Chunks that cannot contain any of the join keys produced by the key source (runtime pruning)
+   */
+  _runtime_pruned_chunk_ids.clear();
+  if (_runtime_pruning_column_id) {
+    const auto join_key_filter = JoinKeyFilter::build(*input_table_left(), *_runtime_pruning_key_column_id);
+
+    for (ChunkID stored_chunk_id{0}; stored_chunk_id < stored_table->chunk_count(); ++stored_chunk_id) {
+      if (std::binary_search(_pruned_chunk_ids.begin(), _pruned_chunk_ids.end(), stored_chunk_id)) continue;
+
+      const auto chunk = stored_table->get_chunk(stored_chunk_id);
+      if (!chunk || !chunk->statistics()) continue;
+
+      if (join_key_filter->can_prune(*chunk->statistics(), *_runtime_pruning_column_id)) {
+        _runtime_pruned_chunk_ids.emplace_back(stored_chunk_id);
+      }
+    }
+  }
+
+  auto pruned_chunk_ids = std::vector<ChunkID>{};
+  std::set_union(_pruned_chunk_ids.begin(), _pruned_chunk_ids.end(), _runtime_pruned_chunk_ids.begin(),
+                 _runtime_pruned_chunk_ids.end(), std::back_inserter(pruned_chunk_ids));
+
   auto excluded_chunk_ids = std::vector<ChunkID>{};
-  auto pruned_chunk_ids_iter = _pruned_chunk_ids.begin();
+  auto pruned_chunk_ids_iter = pruned_chunk_ids.begin();
   for (ChunkID stored_chunk_id{0}; stored_chunk_id < stored_table->chunk_count(); ++stored_chunk_id) {
     // Check whether the Chunk is pruned
-    if (pruned_chunk_ids_iter != _pruned_chunk_ids.end() && *pruned_chunk_ids_iter == stored_chunk_id) {
+    if (pruned_chunk_ids_iter != pruned_chunk_ids.end() && *pruned_chunk_ids_iter == stored_chunk_id) {
       excluded_chunk_ids.emplace_back(stored_chunk_id);
       ++pruned_chunk_ids_iter;
       continue;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -27,6 +28,21 @@ class GetTable : public AbstractReadOnlyOperator {
   const std::vector<ChunkID>& pruned_chunk_ids() const;
   const std::vector<ColumnID>& pruned_column_ids() const;
 
+  /**
+   * Runtime chunk pruning (sideways information passing): Before the GetTable is executed, the join keys in
+   * `key_column_id` of the output of `key_source` are summarized in a JoinKeyFilter. Stored Chunks whose statistics
+   * for `column_id` (a ColumnID of the stored table, regardless of column pruning) rule out all keys are skipped.
+   * This is only correct if the GetTable feeds (via filters only) into an inner or semi equi-join with `key_source`.
+   *
+   * `key_source` becomes the left input of the GetTable, so that the scheduler executes it first.
+   */
+  void set_runtime_pruning(const std::shared_ptr<const AbstractOperator>& key_source, const ColumnID key_column_id,
+                           const ColumnID column_id);
+  const std::optional<ColumnID>& runtime_pruning_column_id() const;
+
+  // Chunks skipped because of the JoinKeyFilter during the last execution
+  const std::vector<ChunkID>& runtime_pruned_chunk_ids() const;
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
@@ -39,5 +55,9 @@ class GetTable : public AbstractReadOnlyOperator {
   const std::string _name;
   const std::vector<ChunkID> _pruned_chunk_ids;
   const std::vector<ColumnID> _pruned_column_ids;
+
+  std::optional<ColumnID> _runtime_pruning_key_column_id;
+  std::optional<ColumnID> _runtime_pruning_column_id;
+  std::vector<ChunkID> _runtime_pruned_chunk_ids;
 };
 }  // namespace opossum
@@ -0,0 +1,416 @@
+#include "import_parquet.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "import_export/parquet.hpp"
+#include "resolve_type.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "statistics/chunk_statistics/min_max_filter.hpp"
+#include "statistics/chunk_statistics/segment_statistics.hpp"
+#include "storage/chunk.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+namespace fields = parquet_fields;
+
+struct ColumnChunkMetaData {
+  int64_t num_values = 0;
+  int64_t data_page_offset = 0;
+  bool has_dictionary_page = false;
+  ParquetCompressionCodec codec = ParquetCompressionCodec::Uncompressed;
+  // Min and max value in the PLAIN encoding without length, as stored in the statistics
+  std::optional<std::string_view> min_value;
+  std::optional<std::string_view> max_value;
+  // Whether min_value and max_value were taken from the deprecated min and max, which compared strings as signed bytes
+  bool has_deprecated_statistics = false;
+};
+
+struct RowGroupMetaData {
+  int64_t num_rows = 0;
+  std::vector<ColumnChunkMetaData> columns;
+};
+
+struct FileMetaData {
+  TableColumnDefinitions column_definitions;
+  std::vector<RowGroupMetaData> row_groups;
+};
+
+DataType data_type_from_parquet(const ParquetType type, const std::string& column_name) {
+  switch (type) {
+    case ParquetType::Int32:
+      return DataType::Int;
+    case ParquetType::Int64:
+      return DataType::Long;
+    case ParquetType::Float:
+      return DataType::Float;
+    case ParquetType::Double:
+      return DataType::Double;
+    case ParquetType::ByteArray:
+      return DataType::String;
+    default:
+      Fail("Parquet type " + std::to_string(static_cast<int32_t>(type)) + " of column '" + column_name +
+           "' is not supported");
+  }
+}
+
+/**
+ * The schema is a tree in depth-first order, whose root has num_children elements. As only flat schemas are supported,
+ * each of these elements is a column.
+ */
+TableColumnDefinitions read_schema(ThriftCompactReader& reader) {
+  auto column_definitions = TableColumnDefinitions{};
+  auto is_root = true;
+
+  reader.read_list([&](const ThriftType) {
+    auto name = std::string{};
+    auto type = std::optional<ParquetType>{};
+    auto repetition_type = ParquetRepetitionType::Required;
+    auto num_children = int32_t{0};
+
+    reader.read_struct([&](const int16_t field_id, const ThriftType field_type) {
+      switch (field_id) {
+        case fields::SchemaElement::TYPE:
+          type = static_cast<ParquetType>(reader.read_i32());
+          break;
+        case fields::SchemaElement::REPETITION_TYPE:
+          repetition_type = static_cast<ParquetRepetitionType>(reader.read_i32());
+          break;
+        case fields::SchemaElement::NAME:
+          name = reader.read_binary();
+          break;
+        case fields::SchemaElement::NUM_CHILDREN:
+          num_children = reader.read_i32();
+          break;
+        default:
+          reader.skip(field_type);
+      }
+    });
+
+    if (is_root) {
+      is_root = false;
+      return;
+    }
+
+    Assert(num_children == 0 && type, "Column '" + name + "' is nested, which is not supported");
+    Assert(repetition_type != ParquetRepetitionType::Repeated,
+           "Column '" + name + "' is repeated, which is not supported");
+    column_definitions.emplace_back(name, data_type_from_parquet(*type, name),
+                                    repetition_type == ParquetRepetitionType::Optional);
+  });
+
+  return column_definitions;
+}
+
+ColumnChunkMetaData read_column_chunk(ThriftCompactReader& reader) {
+  auto column_chunk = ColumnChunkMetaData{};
+  // The deprecated min and max are only used if the file does not contain min_value and max_value
+  auto deprecated_min = std::optional<std::string_view>{};
+  auto deprecated_max = std::optional<std::string_view>{};
+
+  const auto read_statistics = [&]() {
+    reader.read_struct([&](const int16_t field_id, const ThriftType field_type) {
+      switch (field_id) {
+        case fields::Statistics::MAX:
+          deprecated_max = reader.read_binary();
+          break;
+        case fields::Statistics::MIN:
+          deprecated_min = reader.read_binary();
+          break;
+        case fields::Statistics::MAX_VALUE:
+          column_chunk.max_value = reader.read_binary();
+          break;
+        case fields::Statistics::MIN_VALUE:
+          column_chunk.min_value = reader.read_binary();
+          break;
+        default:
+          reader.skip(field_type);
+      }
+    });
+  };
+
+  const auto read_column_meta_data = [&]() {
+    reader.read_struct([&](const int16_t field_id, const ThriftType field_type) {
+      switch (field_id) {
+        case fields::ColumnMetaData::CODEC:
+          column_chunk.codec = static_cast<ParquetCompressionCodec>(reader.read_i32());
+          break;
+        case fields::ColumnMetaData::NUM_VALUES:
+          column_chunk.num_values = reader.read_i64();
+          break;
+        case fields::ColumnMetaData::DATA_PAGE_OFFSET:
+          column_chunk.data_page_offset = reader.read_i64();
+          break;
+        case fields::ColumnMetaData::DICTIONARY_PAGE_OFFSET:
+          reader.skip(field_type);
+          column_chunk.has_dictionary_page = true;
+          break;
+        case fields::ColumnMetaData::STATISTICS:
+          read_statistics();
+          break;
+        default:
+          reader.skip(field_type);
+      }
+    });
+  };
+
+  reader.read_struct([&](const int16_t field_id, const ThriftType field_type) {
+    if (field_id == fields::ColumnChunk::META_DATA) {
+      read_column_meta_data();
+    } else {
+      reader.skip(field_type);
+    }
+  });
+
+  if (!column_chunk.min_value && !column_chunk.max_value && deprecated_min && deprecated_max) {
+    column_chunk.min_value = deprecated_min;
+    column_chunk.max_value = deprecated_max;
+    column_chunk.has_deprecated_statistics = true;
+  }
+
+  return column_chunk;
+}
+
+FileMetaData read_file_meta_data(const std::string_view data) {
+  auto file_meta_data = FileMetaData{};
+  auto reader = ThriftCompactReader{data};
+
+  reader.read_struct([&](const int16_t field_id, const ThriftType field_type) {
+    switch (field_id) {
+      case fields::FileMetaData::SCHEMA:
+        file_meta_data.column_definitions = read_schema(reader);
+        break;
+      case fields::FileMetaData::ROW_GROUPS:
+        reader.read_list([&](const ThriftType) {
+          auto& row_group = file_meta_data.row_groups.emplace_back();
+          reader.read_struct([&](const int16_t row_group_field_id, const ThriftType row_group_field_type) {
+            switch (row_group_field_id) {
+              case fields::RowGroup::COLUMNS:
+                reader.read_list([&](const ThriftType) { row_group.columns.emplace_back(read_column_chunk(reader)); });
+                break;
+              case fields::RowGroup::NUM_ROWS:
+                row_group.num_rows = reader.read_i64();
+                break;
+              default:
+                reader.skip(row_group_field_type);
+            }
+          });
+        });
+        break;
+      default:
+        reader.skip(field_type);
+    }
+  });
+
+  return file_meta_data;
+}
+
+// Reads the data pages of a column chunk, which start at data_page_offset, until all values of the chunk are read
+template <typename T>
+std::shared_ptr<BaseSegment> read_column_chunk_data(const std::string_view file, const ColumnChunkMetaData& meta_data,
+                                                    const bool is_nullable) {
+  Assert(meta_data.codec == ParquetCompressionCodec::Uncompressed, "Compressed Parquet files are not supported");
+  Assert(!meta_data.has_dictionary_page, "Dictionary encoded Parquet files are not supported");
+  Assert(meta_data.data_page_offset >= 0 && static_cast<size_t>(meta_data.data_page_offset) < file.size(),
+         "Invalid offset of Parquet data page");
+
+  auto values = std::vector<T>{};
+  auto null_values = std::vector<bool>{};
+  values.reserve(meta_data.num_values);
+  if (is_nullable) null_values.reserve(meta_data.num_values);
+
+  auto page_header_offset = static_cast<size_t>(meta_data.data_page_offset);
+  while (static_cast<int64_t>(values.size()) < meta_data.num_values) {
+    auto reader = ThriftCompactReader{file.substr(page_header_offset)};
+    auto page_type = ParquetPageType::DataPage;
+    auto page_size = int32_t{0};
+    auto page_value_count = int32_t{0};
+    auto encoding = ParquetEncoding::Plain;
+    auto definition_level_encoding = ParquetEncoding::Rle;
+
+    reader.read_struct([&](const int16_t field_id, const ThriftType field_type) {
+      switch (field_id) {
+        case fields::PageHeader::TYPE:
+          page_type = static_cast<ParquetPageType>(reader.read_i32());
+          break;
+        case fields::PageHeader::COMPRESSED_PAGE_SIZE:
+          page_size = reader.read_i32();
+          break;
+        case fields::PageHeader::DATA_PAGE_HEADER:
+          reader.read_struct([&](const int16_t page_field_id, const ThriftType page_field_type) {
+            switch (page_field_id) {
+              case fields::DataPageHeader::NUM_VALUES:
+                page_value_count = reader.read_i32();
+                break;
+              case fields::DataPageHeader::ENCODING:
+                encoding = static_cast<ParquetEncoding>(reader.read_i32());
+                break;
+              case fields::DataPageHeader::DEFINITION_LEVEL_ENCODING:
+                definition_level_encoding = static_cast<ParquetEncoding>(reader.read_i32());
+                break;
+              default:
+                reader.skip(page_field_type);
+            }
+          });
+          break;
+        default:
+          reader.skip(field_type);
+      }
+    });
+
+    Assert(page_type == ParquetPageType::DataPage, "Only Parquet data pages of version 1 are supported");
+    Assert(encoding == ParquetEncoding::Plain, "Only the PLAIN encoding of Parquet values is supported");
+    Assert(page_size >= 0 && page_value_count > 0, "Invalid Parquet page header");
+
+    const auto page_offset = page_header_offset + reader.position();
+    Assert(page_offset + page_size <= file.size(), "Unexpected end of Parquet file");
+    const auto page = file.substr(page_offset, page_size);
+    auto position = size_t{0};
+
+    if (is_nullable) {
+      Assert(definition_level_encoding == ParquetEncoding::Rle, "Only RLE encoded definition levels are supported");
+      const auto page_null_values = read_parquet_definition_levels(page, position, page_value_count);
+      for (const auto is_null : page_null_values) {
+        values.emplace_back(is_null ? T{} : read_parquet_plain_value<T>(page, position));
+      }
+      null_values.insert(null_values.end(), page_null_values.begin(), page_null_values.end());
+    } else {
+      for (auto value_index = int32_t{0}; value_index < page_value_count; ++value_index) {
+        values.emplace_back(read_parquet_plain_value<T>(page, position));
+      }
+    }
+
+    // The header of the next page follows the data of this one
+    page_header_offset = page_offset + page_size;
+  }
+
+  Assert(static_cast<int64_t>(values.size()) == meta_data.num_values, "Parquet pages contain too many values");
+
+  if (is_nullable) return std::make_shared<ValueSegment<T>>(std::move(values), std::move(null_values));
+  return std::make_shared<ValueSegment<T>>(std::move(values));
+}
+
+}  // namespace
+
+namespace opossum {
+
+ImportParquet::ImportParquet(const std::string& filename, const std::optional<std::string>& tablename)
+    : AbstractReadOnlyOperator(OperatorType::ImportParquet), _filename(filename), _tablename(tablename) {}
+
+const std::string ImportParquet::name() const { return "ImportParquet"; }
+
+std::shared_ptr<Table> ImportParquet::read_parquet(const std::string& filename) {
+  std::ifstream ifstream;
+  ifstream.open(filename, std::ios::binary);
+  Assert(ifstream.is_open(), "ImportParquet: Could not open file " + filename);
+
+  const auto content = std::string{std::istreambuf_iterator<char>{ifstream}, std::istreambuf_iterator<char>{}};
+  const auto file = std::string_view{content};
+
+  // The file ends with the file metadata, its length, and the magic number
+  const auto magic_number_size = PARQUET_MAGIC_NUMBER.size();
+  auto file_meta_data_size = uint32_t{};
+  Assert(file.size() >= 2 * magic_number_size + sizeof(file_meta_data_size) &&
+             file.substr(0, magic_number_size) == PARQUET_MAGIC_NUMBER &&
+             file.substr(file.size() - magic_number_size) == PARQUET_MAGIC_NUMBER,
+         "ImportParquet: " + filename + " is not a Parquet file");
+
+  const auto file_meta_data_size_offset = file.size() - magic_number_size - sizeof(file_meta_data_size);
+  std::memcpy(&file_meta_data_size, file.data() + file_meta_data_size_offset, sizeof(file_meta_data_size));
+  Assert(file_meta_data_size <= file_meta_data_size_offset - magic_number_size, "Invalid size of Parquet metadata");
+  const auto file_meta_data =
+      read_file_meta_data(file.substr(file_meta_data_size_offset - file_meta_data_size, file_meta_data_size));
+
+  const auto& column_definitions = file_meta_data.column_definitions;
+  const auto column_count = static_cast<ColumnID::base_type>(column_definitions.size());
+
+  // Each row group becomes a chunk, so the largest row group determines the chunk size
+  auto max_chunk_size = ChunkOffset{0};
+  for (const auto& row_group : file_meta_data.row_groups) {
+    Assert(row_group.num_rows >= 0 && row_group.num_rows <= Chunk::MAX_SIZE, "Parquet row group is too large");
+    Assert(row_group.columns.size() == column_count, "Parquet row group does not match the schema");
+    max_chunk_size = std::max(max_chunk_size, static_cast<ChunkOffset>(row_group.num_rows));
+  }
+  if (max_chunk_size == 0) max_chunk_size = Chunk::DEFAULT_SIZE;
+
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, max_chunk_size, UseMvcc::Yes);
+
+  for (const auto& row_group : file_meta_data.row_groups) {
+    if (row_group.num_rows == 0) continue;
+
+    auto segments = Segments{};
+    auto segment_statistics = std::vector<std::shared_ptr<SegmentStatistics>>{};
+
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      const auto& column_chunk = row_group.columns[column_id];
+      Assert(column_chunk.num_values == row_group.num_rows, "Parquet column chunk does not match its row group");
+
+      resolve_data_type(column_definitions[column_id].data_type, [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        segments.emplace_back(
+            read_column_chunk_data<ColumnDataType>(file, column_chunk, column_definitions[column_id].nullable));
+
+        // The min and max value of the column chunk let the ChunkPruningRule skip the row group
+        auto statistics = std::make_shared<SegmentStatistics>();
+        const auto has_valid_statistics =
+            column_chunk.min_value && column_chunk.max_value &&
+            !(std::is_same_v<ColumnDataType, pmr_string> && column_chunk.has_deprecated_statistics);
+        if (has_valid_statistics) {
+          statistics->add_filter(std::make_shared<MinMaxFilter<ColumnDataType>>(
+              decode_parquet_statistics_value<ColumnDataType>(*column_chunk.min_value),
+              decode_parquet_statistics_value<ColumnDataType>(*column_chunk.max_value)));
+        }
+        segment_statistics.emplace_back(statistics);
+      });
+    }
+
+    const auto mvcc_data = std::make_shared<MvccData>(row_group.num_rows, CommitID{0});
+    table->append_chunk(segments, mvcc_data);
+
+    const auto chunk = table->get_chunk(ChunkID{table->chunk_count() - 1});
+    chunk->mark_immutable();
+    chunk->set_statistics(std::make_shared<ChunkStatistics>(segment_statistics));
+  }
+
+  return table;
+}
+
+std::shared_ptr<const Table> ImportParquet::_on_execute() {
+  if (_tablename && StorageManager::get().has_table(*_tablename)) {
+    return StorageManager::get().get_table(*_tablename);
+  }
+
+  const auto table = read_parquet(_filename);
+
+  if (_tablename) {
+    StorageManager::get().add_table(*_tablename, table);
+  }
+
+  return table;
+}
+
+std::shared_ptr<AbstractOperator> ImportParquet::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<ImportParquet>(_filename, _tablename);
+}
+
+void ImportParquet::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+}  // namespace opossum
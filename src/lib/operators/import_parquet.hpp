@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "abstract_read_only_operator.hpp"
+
+namespace opossum {
+
+/*
+ * Reads an Apache Parquet file (see import_export/parquet.hpp for the supported subset) and creates a table with a
+ * chunk for each row group. The min and max values that the file stores for each column chunk are attached to the
+ * chunks as ChunkStatistics, so that the ChunkPruningRule skips the row groups that cannot match a predicate.
+ * If parameter tablename provided, the imported table is stored in the StorageManager. If a table with this name
+ * already exists, it is returned and no import is performed.
+ *
+ * Files written by other tools have to be written without compression and dictionary encoding, e.g., with pyarrow's
+ * write_table(..., compression="none", use_dictionary=False).
+ */
+class ImportParquet : public AbstractReadOnlyOperator {
+ public:
+  explicit ImportParquet(const std::string& filename, const std::optional<std::string>& tablename = std::nullopt);
+
+  static std::shared_ptr<Table> read_parquet(const std::string& filename);
+
+  std::shared_ptr<const Table> _on_execute() final;
+
+  const std::string name() const final;
+
+ protected:
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+ private:
+  // Name of the import file
+  const std::string _filename;
+  // Name for adding the table to the StorageManager
+  const std::optional<std::string> _tablename;
+};
+
+}  // namespace opossum
@@ -3,11 +3,14 @@
 #include <algorithm>
 #include <memory>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "concurrency/transaction_context.hpp"
 #include "resolve_type.hpp"
 #include "storage/base_encoded_segment.hpp"
+#include "storage/base_value_segment.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/value_segment.hpp"
@@ -92,75 +95,106 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
   }
 
   /**
-   * 1. Allocate the required rows in the target Table, without actually copying data to them.
-   *    Do so while locking the table to prevent multiple threads modifying the table's size simultaneously.
-   *    Since allocation is expected to be faster than writing to the memory, allocating under lock and then writing -
-   *    in a second step - without lock will minimize the time that the Table's append_mutex is locked.
+   * 1. Reserve the required rows in the target Table and add them to its Chunks, without actually copying data to them.
+   *    Since reserving and adding rows is expected to be faster than writing to the memory, reserving and then writing
+   *    - in a second step - lets concurrent Inserts into the same Table overlap as much as possible.
+   *    The rows are reserved lock-free in the last Chunk. Only if it is full, the Table's append_mutex is locked to
+   *    append a new mutable Chunk.
    */
-  {
-    const auto append_lock = _target_table->acquire_append_mutex();
+  const auto max_chunk_size = _target_table->max_chunk_size();
+  auto remaining_rows = input_table_left()->row_count();
 
-    auto remaining_rows = input_table_left()->row_count();
+  while (remaining_rows > 0) {
+    const auto requested_row_count = static_cast<ChunkOffset>(std::min<size_t>(max_chunk_size, remaining_rows));
 
-    if (_target_table->chunk_count() == 0) {
-      _target_table->append_mutable_chunk();
-    }
+    auto target_chunk_id = ChunkID{0};
+    auto target_chunk = std::shared_ptr<Chunk>{};
+    auto reserved_rows = std::pair<ChunkOffset, ChunkOffset>{0, 0};
 
-    while (remaining_rows > 0) {
-      auto target_chunk_id = ChunkID{_target_table->chunk_count() - 1};
-      auto target_chunk = _target_table->get_chunk(target_chunk_id);
+    // Tries to reserve rows in the last Chunk of the target Table, which fails if it is immutable or full
+    const auto reserve_rows_in_last_chunk = [&]() {
+      const auto chunk_count = _target_table->chunk_count();
+      if (chunk_count == 0) return false;
 
-      // If the last Chunk of the target Table is either immutable or full, append a new mutable Chunk
-      if (!target_chunk->is_mutable() || target_chunk->size() == _target_table->max_chunk_size()) {
-        _target_table->append_mutable_chunk();
-        ++target_chunk_id;
-        target_chunk = _target_table->get_chunk(target_chunk_id);
-      }
+      target_chunk_id = ChunkID{chunk_count - 1};
+      target_chunk = _target_table->get_chunk(target_chunk_id);
 
-      const auto num_rows_for_target_chunk =
-          std::min<size_t>(_target_table->max_chunk_size() - target_chunk->size(), remaining_rows);
+      // The Chunk is still being constructed if another Insert has just appended it
+      if (!target_chunk || !target_chunk->is_mutable()) return false;
 
-      _target_chunk_ranges.emplace_back(
-          ChunkRange{target_chunk_id, target_chunk->size(),
-                     static_cast<ChunkOffset>(target_chunk->size() + num_rows_for_target_chunk)});
+      // Check this before reserving, because once rows are reserved, following Inserts wait for them to be added
+      for (const auto& segment : target_chunk->segments()) {
+        Assert(std::dynamic_pointer_cast<const BaseValueSegment>(segment), "Cannot insert into non-ValueColumns");
+      }
 
-      // Grow MVCC vectors and mark new (but still empty) rows as being under modification by current transaction.
-      // Do so before resizing the Segments, because the resize of `Chunk::_segments.front()` is what releases the
-      // new row count.
-      {
-        auto mvcc_data = target_chunk->get_scoped_mvcc_data_lock();
-        mvcc_data->grow_by(num_rows_for_target_chunk, context->transaction_id(), MvccData::MAX_COMMIT_ID);
+      reserved_rows = target_chunk->reserve_rows(requested_row_count, max_chunk_size);
+      return reserved_rows.second > 0;
+    };
+
+    if (!reserve_rows_in_last_chunk()) {
+      const auto append_lock = _target_table->acquire_append_mutex();
+
+      // Another Insert might have appended a Chunk while we were waiting for the lock
+      if (!reserve_rows_in_last_chunk()) {
+        // Tables that already filled a chunk are likely to fill the new one as well, so memory for a full chunk (but
+        // at most the default chunk size) is allocated right away. Otherwise, only the requested rows are allocated,
+        // so that small tables do not occupy the memory of full chunks.
+        const auto reserved_row_count = _target_table->chunk_count() > 0
+                                            ? std::min(max_chunk_size, Chunk::DEFAULT_SIZE)
+                                            : requested_row_count;
+        _target_table->append_mutable_chunk(reserved_row_count);
+
+        // The new Chunk might have been filled by other Inserts already, in which case we start over
+        if (!reserve_rows_in_last_chunk()) continue;
       }
+    }
 
-      // Grow data Segments.
-      // Do so in REVERSE column order so that the resize of `Chunk::_segments.front()` happens last. It is this last
-      // resize that makes the new row count visible to the outside world.
-      auto old_size = target_chunk->size();
-      for (ColumnID reverse_column_id{0}; reverse_column_id < target_chunk->column_count(); ++reverse_column_id) {
-        const auto column_id = static_cast<ColumnID>(target_chunk->column_count() - reverse_column_id - 1);
+    const auto [begin_chunk_offset, num_rows_for_target_chunk] = reserved_rows;
+    const auto end_chunk_offset = static_cast<ChunkOffset>(begin_chunk_offset + num_rows_for_target_chunk);
+    _target_chunk_ranges.emplace_back(ChunkRange{target_chunk_id, begin_chunk_offset, end_chunk_offset});
+
+    // The rows are added to the Chunk in the order in which they were reserved. Thus, wait until the Inserts that
+    // reserved the preceding rows have added them. As memory for the rows is usually allocated when the Chunk is
+    // appended, this is expected to take only a short time. Adding the rows in order ensures that only one Insert
+    // grows the MVCC vectors and Segments of a Chunk at a time and that the row count only becomes visible once all
+    // rows up to it exist.
+    while (target_chunk->size() != begin_chunk_offset) {
+      std::this_thread::yield();
+    }
 
-        resolve_data_type(_target_table->column_data_type(column_id), [&](const auto data_type_t) {
-          using ColumnDataType = typename decltype(data_type_t)::type;
+    // Grow MVCC vectors and mark new (but still empty) rows as being under modification by current transaction.
+    // Do so before resizing the Segments, because the resize of `Chunk::_segments.front()` is what releases the
+    // new row count.
+    {
+      auto mvcc_data = target_chunk->get_scoped_mvcc_data_lock();
+      mvcc_data->grow_by(num_rows_for_target_chunk, context->transaction_id(), MvccData::MAX_COMMIT_ID);
+    }
 
-          const auto value_segment =
-              std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(target_chunk->get_segment(column_id));
-          Assert(value_segment, "Cannot insert into non-ValueColumns");
+    // Grow data Segments.
+    // Do so in REVERSE column order so that the resize of `Chunk::_segments.front()` happens last. It is this last
+    // resize that makes the new row count visible to the outside world.
+    for (ColumnID reverse_column_id{0}; reverse_column_id < target_chunk->column_count(); ++reverse_column_id) {
+      const auto column_id = static_cast<ColumnID>(target_chunk->column_count() - reverse_column_id - 1);
 
-          const auto new_size = old_size + num_rows_for_target_chunk;
+      resolve_data_type(_target_table->column_data_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
 
-          value_segment->values().resize(new_size);
+        const auto value_segment =
+            std::static_pointer_cast<ValueSegment<ColumnDataType>>(target_chunk->get_segment(column_id));
 
-          if (value_segment->is_nullable()) {
-            value_segment->null_values().resize(new_size);
-          }
-        });
+        // Unlike resize(), grow_to_at_least() is safe while other threads read the Segment
+        value_segment->values().grow_to_at_least(end_chunk_offset);
 
-        // Make sure the first columns rewrite actually happens last and doesn't get reordered.
-        std::atomic_thread_fence(std::memory_order_seq_cst);
-      }
+        if (value_segment->is_nullable()) {
+          value_segment->null_values().grow_to_at_least(end_chunk_offset);
+        }
+      });
 
-      remaining_rows -= num_rows_for_target_chunk;
+      // Make sure the first columns rewrite actually happens last and doesn't get reordered.
+      std::atomic_thread_fence(std::memory_order_seq_cst);
     }
+
+    remaining_rows -= num_rows_for_target_chunk;
   }
 
   /**
@@ -219,6 +253,8 @@ void Insert::_on_commit_records(const CommitID cid) {
       mvcc_data->tids[chunk_offset] = 0u;
     }
   }
+
+  _target_table->update_last_modified_commit_id(cid);
 }
 
 void Insert::_on_rollback_records() {
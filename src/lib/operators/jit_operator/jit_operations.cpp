@@ -15,6 +15,16 @@ namespace opossum {
   case JIT_GET_ENUM_VALUE(0, types): \
     return to.set<JIT_GET_DATA_TYPE(0, types)>(from.get<JIT_GET_DATA_TYPE(0, types)>(context), to_index, context);
 
+#define JIT_HASH_JOIN_EQUALS_CASE(r, types)                 \
+  case JIT_GET_ENUM_VALUE(0, types):                        \
+    return lhs.get<JIT_GET_DATA_TYPE(0, types)>(context) == \
+           context.join_hashmap.columns[rhs.column_index].get<JIT_GET_DATA_TYPE(0, types)>(rhs_index);
+
+#define JIT_HASH_JOIN_ASSIGN_CASE(r, types)     \
+  case JIT_GET_ENUM_VALUE(0, types):            \
+    return to.set<JIT_GET_DATA_TYPE(0, types)>( \
+        context.join_hashmap.columns[from.column_index].get<JIT_GET_DATA_TYPE(0, types)>(from_index), context);
+
 #define JIT_GROW_BY_ONE_CASE(r, types) \
   case JIT_GET_ENUM_VALUE(0, types):   \
     return context.hashmap.columns[hashmap_entry.column_index].grow_by_one<JIT_GET_DATA_TYPE(0, types)>(initial_value);
@@ -127,18 +137,18 @@ std::optional<bool> jit_or(const JitExpression& left_side, const JitExpression&
   }
 }
 
-// TODO(anyone) State Machine is currently build for every comparison. It should be build only once.
+// TODO(anyone) The LikeMatcher is currently built for every comparison. It should be built only once.
 bool jit_like(const pmr_string& a, const pmr_string& b) {
-  const auto regex_string = LikeMatcher::sql_like_to_regex(b);
-  const auto regex = std::regex{regex_string};
-  return std::regex_match(a, regex);
+  auto result = false;
+  LikeMatcher{b}.resolve(false, [&](const auto& matcher) { result = matcher(a); });
+  return result;
 }
 
-// TODO(anyone) State Machine is currently build for every comparison. It should be build only once.
+// TODO(anyone) The LikeMatcher is currently built for every comparison. It should be built only once.
 bool jit_not_like(const pmr_string& a, const pmr_string& b) {
-  const auto regex_string = LikeMatcher::sql_like_to_regex(b);
-  const auto regex = std::regex{regex_string};
-  return !std::regex_match(a, regex);
+  auto result = false;
+  LikeMatcher{b}.resolve(true, [&](const auto& matcher) { result = matcher(a); });
+  return result;
 }
 
 std::optional<bool> jit_is_null(const JitExpression& left_side, JitRuntimeContext& context, const bool use_value_id) {
@@ -227,6 +237,37 @@ void jit_assign(const JitTupleEntry& from, const JitHashmapEntry& to, const size
   }
 }
 
+bool jit_hash_join_equals(const JitTupleEntry& lhs, const JitHashmapEntry& rhs, const size_t rhs_index,
+                          JitRuntimeContext& context) {
+  DebugAssert(lhs.data_type == rhs.data_type, "Data types don't match in jit_hash_join_equals.");
+
+  switch (lhs.data_type) {
+    BOOST_PP_SEQ_FOR_EACH_PRODUCT(JIT_HASH_JOIN_EQUALS_CASE, (JIT_DATA_TYPE_INFO))
+    default:
+      Fail("unreachable");
+  }
+}
+
+void jit_hash_join_assign(const JitHashmapEntry& from, const size_t from_index, const JitTupleEntry& to,
+                          JitRuntimeContext& context) {
+  DebugAssert(from.data_type == to.data_type, "Data types don't match in jit_hash_join_assign.");
+
+  if (!from.guaranteed_non_null) {
+    const bool is_null = context.join_hashmap.columns[from.column_index].is_null(from_index);
+    to.set_is_null(is_null, context);
+    // The value is NULL - our work is done here.
+    if (is_null) {
+      return;
+    }
+  }
+
+  switch (from.data_type) {
+    BOOST_PP_SEQ_FOR_EACH_PRODUCT(JIT_HASH_JOIN_ASSIGN_CASE, (JIT_DATA_TYPE_INFO))
+    default:
+      break;
+  }
+}
+
 size_t jit_grow_by_one(const JitHashmapEntry& hashmap_entry, const JitVariantVector::InitialValue initial_value,
                        JitRuntimeContext& context) {
   switch (hashmap_entry.data_type) {
@@ -240,6 +281,8 @@ size_t jit_grow_by_one(const JitHashmapEntry& hashmap_entry, const JitVariantVec
 #undef JIT_HASH_CASE
 #undef JIT_AGGREGATE_EQUALS_CASE
 #undef JIT_ASSIGN_CASE
+#undef JIT_HASH_JOIN_EQUALS_CASE
+#undef JIT_HASH_JOIN_ASSIGN_CASE
 #undef JIT_GROW_BY_ONE_CASE
 #undef JIT_IS_NULL_CASE
 #undef JIT_IS_NOT_NULL_CASE
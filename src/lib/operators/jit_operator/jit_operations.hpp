@@ -284,6 +284,16 @@ __attribute__((noinline)) size_t jit_grow_by_one(const JitHashmapEntry& hashmap_
                                                  const JitVariantVector::InitialValue initial_value,
                                                  JitRuntimeContext& context);
 
+// Compares a JitTupleEntry to a value in the hash table of the JitHashJoinProbe operator. Both values must be non-NULL
+// and of the same data type.
+__attribute__((noinline)) bool jit_hash_join_equals(const JitTupleEntry& lhs, const JitHashmapEntry& rhs,
+                                                    const size_t rhs_index, JitRuntimeContext& context);
+
+// Copies a value in the hash table of the JitHashJoinProbe operator to a JitTupleEntry. Both values MUST be of the same
+// data type.
+__attribute__((noinline)) void jit_hash_join_assign(const JitHashmapEntry& from, const size_t from_index,
+                                                    const JitTupleEntry& to, JitRuntimeContext& context);
+
 // Updates an aggregate by applying an operation to a JitTupleEntry and a JitHashmapEntry. The result is stored in the
 // hashmap value.
 template <typename T>
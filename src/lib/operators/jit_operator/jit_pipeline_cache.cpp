@@ -0,0 +1,116 @@
+#include "jit_pipeline_cache.hpp"
+
+#include <iterator>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+JitPipelineCache::JitPipelineCache(const size_t capacity) : _capacity(capacity) {}
+
+std::shared_ptr<JitPipelineCache::SpecializedFunctionWrapper> JitPipelineCache::try_get(
+    const std::shared_ptr<AbstractLQPNode>& lqp, const JitExecutionMode execution_mode) {
+  const auto& storage_manager = StorageManager::get();
+  const auto lqp_hash = lqp->hash();
+
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  const auto [begin, end] = _entries_by_lqp_hash.equal_range(lqp_hash);
+  for (auto iter = begin; iter != end; ++iter) {
+    const auto entry_iter = iter->second;
+    if (entry_iter->execution_mode != execution_mode || *entry_iter->lqp != *lqp) continue;
+
+    for (const auto& [table_name, weak_table] : entry_iter->tables) {
+      const auto table = weak_table.lock();
+      if (!table || !storage_manager.has_table(table_name) || storage_manager.get_table(table_name) != table) {
+        _erase(entry_iter);
+        ++_miss_count;
+        return nullptr;
+      }
+    }
+
+    _entries.splice(_entries.begin(), _entries, entry_iter);
+    ++_hit_count;
+    return entry_iter->specialized_function_wrapper;
+  }
+
+  ++_miss_count;
+  return nullptr;
+}
+
+void JitPipelineCache::set(const std::shared_ptr<AbstractLQPNode>& lqp, const JitExecutionMode execution_mode,
+                           const std::shared_ptr<SpecializedFunctionWrapper>& specialized_function_wrapper) {
+  const auto lqp_copy = lqp->deep_copy();
+  const auto lqp_hash = lqp_copy->hash();
+  auto entry = Entry{lqp_copy, lqp_hash, execution_mode, specialized_function_wrapper, {}};
+
+  const auto& storage_manager = StorageManager::get();
+  for (const auto& subplan_root : lqp_find_subplan_roots(lqp_copy)) {
+    visit_lqp(subplan_root, [&](const auto& node) {
+      if (node->type == LQPNodeType::StoredTable) {
+        const auto& table_name = static_cast<const StoredTableNode&>(*node).table_name;
+        if (storage_manager.has_table(table_name)) {
+          entry.tables.emplace_back(table_name, storage_manager.get_table(table_name));
+        }
+      }
+      return LQPVisitation::VisitInputs;
+    });
+  }
+
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  if (_capacity == 0) return;
+
+  // Replace the pipeline of an equal LQP, which might have been stale
+  const auto [begin, end] = _entries_by_lqp_hash.equal_range(lqp_hash);
+  for (auto iter = begin; iter != end; ++iter) {
+    if (iter->second->execution_mode != execution_mode || *iter->second->lqp != *lqp_copy) continue;
+    _erase(iter->second);
+    break;
+  }
+
+  while (_entries.size() >= _capacity) {
+    _erase(std::prev(_entries.end()));
+  }
+
+  _entries.emplace_front(std::move(entry));
+  _entries_by_lqp_hash.emplace(lqp_hash, _entries.begin());
+}
+
+size_t JitPipelineCache::size() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _entries.size();
+}
+
+void JitPipelineCache::clear() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _entries.clear();
+  _entries_by_lqp_hash.clear();
+}
+
+size_t JitPipelineCache::hit_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _hit_count;
+}
+
+size_t JitPipelineCache::miss_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _miss_count;
+}
+
+void JitPipelineCache::_erase(const EntryList::iterator entry_iter) {
+  const auto [begin, end] = _entries_by_lqp_hash.equal_range(entry_iter->lqp_hash);
+  for (auto iter = begin; iter != end; ++iter) {
+    if (iter->second != entry_iter) continue;
+    _entries_by_lqp_hash.erase(iter);
+    break;
+  }
+
+  _entries.erase(entry_iter);
+}
+
+}  // namespace opossum
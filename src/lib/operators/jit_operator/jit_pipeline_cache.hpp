@@ -0,0 +1,88 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "operators/jit_operator_wrapper.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class Table;
+
+/**
+ * Caches the jittable operator pipelines created by the JitAwareLQPTranslator, keyed on the LQP subplan they replace.
+ * Since the translation of equal subplans results in equal pipelines, a JitOperatorWrapper translated from an LQP that
+ * is already cached shares the SpecializedFunctionWrapper of the cached pipeline. The pipeline is then only specialized
+ * and compiled once, even if the subplan occurs in different statements (e.g., in executions of a query template or in
+ * statements that only differ outside of the jitted subplan). The execution mode is part of the key, as the
+ * SpecializedFunctionWrapper holds the functions of one execution mode only.
+ *
+ * The operators of a cached pipeline are shared by concurrent executions. They are only modified while the pipeline
+ * is prepared for specialization, which happens once under the specialization_mutex. All state that changes during an
+ * execution (e.g., whether the current chunk can use value ids) is kept in the JitRuntimeContext of the execution.
+ *
+ * The specialized code embeds the addresses of the jittable operators it was created from. Therefore, it cannot be
+ * used for other operator instances or be persisted across restarts.
+ *
+ * Specialization depends on the schema of the input tables (e.g., on the nullability of columns). Entries for which a
+ * table of the subplan was dropped or replaced are removed on lookup. If the capacity is exceeded, the least recently
+ * used entries are evicted.
+ *
+ * This class is thread-safe.
+ */
+class JitPipelineCache : private Noncopyable {
+ public:
+  using SpecializedFunctionWrapper = JitOperatorWrapper::SpecializedFunctionWrapper;
+
+  static constexpr size_t DEFAULT_CAPACITY = 1024;
+
+  explicit JitPipelineCache(const size_t capacity = DEFAULT_CAPACITY);
+
+  // Returns the pipeline of an LQP equal to @param lqp that is executed in @param execution_mode, if there is one
+  std::shared_ptr<SpecializedFunctionWrapper> try_get(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                                      const JitExecutionMode execution_mode);
+
+  // Adds the pipeline translated from @param lqp. The cache stores a copy of the LQP.
+  void set(const std::shared_ptr<AbstractLQPNode>& lqp, const JitExecutionMode execution_mode,
+           const std::shared_ptr<SpecializedFunctionWrapper>& specialized_function_wrapper);
+
+  size_t size() const;
+  void clear();
+
+  size_t hit_count() const;
+  size_t miss_count() const;
+
+ private:
+  struct Entry {
+    std::shared_ptr<AbstractLQPNode> lqp;
+    size_t lqp_hash;
+    JitExecutionMode execution_mode;
+    std::shared_ptr<SpecializedFunctionWrapper> specialized_function_wrapper;
+
+    // The tables read by the LQP, to detect them being dropped or replaced by a table of the same name
+    std::vector<std::pair<std::string, std::weak_ptr<const Table>>> tables;
+  };
+
+  // Most recently used first
+  using EntryList = std::list<Entry>;
+
+  void _erase(const EntryList::iterator entry_iter);
+
+  EntryList _entries;
+  std::unordered_multimap<size_t, EntryList::iterator> _entries_by_lqp_hash;
+
+  const size_t _capacity;
+  size_t _hit_count{0};
+  size_t _miss_count{0};
+
+  mutable std::mutex _mutex;
+};
+
+}  // namespace opossum
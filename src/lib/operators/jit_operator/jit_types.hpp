@@ -124,7 +124,7 @@ class JitVariantVector {
 class BaseJitSegmentReader;
 class BaseJitSegmentWriter;
 
-// The JitAggregate operator (and possibly future hashing based operators) require an efficient way to hash tuples
+// The JitAggregate and hash join operators require an efficient way to hash tuples
 // across multiple columns (i.e., the key-type of the hashmap spans multiple columns).
 // Since the number / data types of the columns are not known at compile time, we use a regular
 // hashmap in combination with some JitVariantVectors to build the foundation for more flexible hashing.
@@ -146,9 +146,18 @@ struct JitRuntimeContext {
   JitRuntimeHashmap hashmap;
   Segments out_chunk;
 
+  // Hash table built by the JitHashJoinBuild operator and probed by the JitHashJoinProbe operator
+  JitRuntimeHashmap join_hashmap;
+
   // Required by JitLimit operator
   size_t limit_rows;
 
+  // For chunks that cannot use the specialized function, JitReadTuples::before_chunk() sets the tuple indices of the
+  // input columns whose segments are not dictionary-encoded. JitExpressions on these columns compare actual values
+  // instead of value ids. This is part of the context rather than of the JitExpressions, as these are shared by all
+  // executions of a pipeline. Empty if all value ids can be used.
+  std::vector<bool> tuple_entries_without_value_ids;
+
   // Required by JitWriteReferences operator
   ChunkID chunk_id;
   std::shared_ptr<PosList> output_pos_list;
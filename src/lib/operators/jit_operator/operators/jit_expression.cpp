@@ -198,20 +198,22 @@ std::optional<ResultValueType> JitExpression::compute(JitRuntimeContext& context
 
   // We check for the result type here to reduce the size of the instantiated templated functions.
   if constexpr (std::is_same_v<ResultValueType, bool>) {
+    const auto uses_value_ids = _uses_value_ids(context);
+
     if (!jit_expression_is_binary(expression_type)) {
       switch (expression_type) {
         case JitExpressionType::Not:
           return jit_not(*left_child, context);
         case JitExpressionType::IsNull:
-          return jit_is_null(*left_child, context, use_value_ids);
+          return jit_is_null(*left_child, context, uses_value_ids);
         case JitExpressionType::IsNotNull:
-          return jit_is_not_null(*left_child, context, use_value_ids);
+          return jit_is_not_null(*left_child, context, uses_value_ids);
         default:
           Fail("This non-binary expression type is not supported.");
       }
     }
 
-    if (left_child->result_entry.data_type == DataType::String && !use_value_ids) {
+    if (left_child->result_entry.data_type == DataType::String && !uses_value_ids) {
       switch (expression_type) {
         case JitExpressionType::Equals:
           return jit_compute<ResultValueType>(jit_string_equals, *left_child, *right_child, context);
@@ -236,23 +238,24 @@ std::optional<ResultValueType> JitExpression::compute(JitRuntimeContext& context
 
     switch (expression_type) {
       case JitExpressionType::Equals:
-        return jit_compute<ResultValueType>(jit_equals, *left_child, *right_child, context, use_value_ids);
+        return jit_compute<ResultValueType>(jit_equals, *left_child, *right_child, context, uses_value_ids);
       case JitExpressionType::NotEquals:
-        return jit_compute<ResultValueType>(jit_not_equals, *left_child, *right_child, context, use_value_ids);
+        return jit_compute<ResultValueType>(jit_not_equals, *left_child, *right_child, context, uses_value_ids);
       case JitExpressionType::GreaterThan:
-        if (!use_value_ids) {
+        if (!uses_value_ids) {
           return jit_compute<ResultValueType>(jit_greater_than, *left_child, *right_child, context);
         }
         [[fallthrough]];  // use >= instead of > for value id comparisons
       case JitExpressionType::GreaterThanEquals:
-        return jit_compute<ResultValueType>(jit_greater_than_equals, *left_child, *right_child, context, use_value_ids);
+        return jit_compute<ResultValueType>(jit_greater_than_equals, *left_child, *right_child, context,
+                                            uses_value_ids);
       case JitExpressionType::LessThanEquals:
-        if (!use_value_ids) {
+        if (!uses_value_ids) {
           return jit_compute<ResultValueType>(jit_less_than_equals, *left_child, *right_child, context);
         }
         [[fallthrough]];  // use < instead of <= for value id comparisons
       case JitExpressionType::LessThan:
-        return jit_compute<ResultValueType>(jit_less_than, *left_child, *right_child, context, use_value_ids);
+        return jit_compute<ResultValueType>(jit_less_than, *left_child, *right_child, context, uses_value_ids);
 
       case JitExpressionType::And:
         return jit_and(*left_child, *right_child, context);
@@ -283,6 +286,13 @@ std::optional<ResultValueType> JitExpression::compute(JitRuntimeContext& context
   }
 }
 
+bool JitExpression::_uses_value_ids(const JitRuntimeContext& context) const {
+  if (!use_value_ids) return false;
+  const auto& tuple_entries_without_value_ids = context.tuple_entries_without_value_ids;
+  return tuple_entries_without_value_ids.empty() ||
+         !tuple_entries_without_value_ids[left_child->result_entry.tuple_index];
+}
+
 void JitExpression::update_nullable_information(std::vector<bool>& tuple_non_nullable_information) {
   if (expression_type == JitExpressionType::Column) {
     result_entry.guaranteed_non_null = tuple_non_nullable_information[result_entry.tuple_index];
@@ -83,11 +83,16 @@ class JitExpression {
   const std::shared_ptr<JitExpression> right_child;
   const JitExpressionType expression_type;
   JitTupleEntry result_entry;
+
+  // Set by JitReadTuples::before_specialization() if the input column is dictionary-encoded. Whether the value ids can
+  // be used for the current chunk is stored in the JitRuntimeContext.
   bool use_value_ids = false;
 
  private:
   std::pair<const DataType, const bool> _compute_result_type();
 
+  bool _uses_value_ids(const JitRuntimeContext& context) const;
+
   JitVariant _variant;
 };
 
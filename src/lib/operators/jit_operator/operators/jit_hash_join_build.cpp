@@ -0,0 +1,85 @@
+#include "jit_hash_join_build.hpp"
+
+#include "operators/jit_operator/jit_operations.hpp"
+
+namespace opossum {
+
+std::string JitHashJoinBuild::description() const {
+  std::stringstream desc;
+  desc << "[HashJoinBuild] Keys: ";
+  for (const auto& key_column : _key_columns) {
+    desc << "x" << key_column.tuple_entry.tuple_index << ", ";
+  }
+  desc << " Values: ";
+  for (const auto& value_column : _value_columns) {
+    desc << "x" << value_column.tuple_entry.tuple_index << ", ";
+  }
+  return desc.str();
+}
+
+void JitHashJoinBuild::before_specialization(const Table& in_table,
+                                             std::vector<bool>& tuple_non_nullable_information) {
+  // The hashmap entries of the keys are always non-nullable, as tuples with NULL keys are not added
+  for (auto& key_column : _key_columns) {
+    key_column.tuple_entry.guaranteed_non_null = tuple_non_nullable_information[key_column.tuple_entry.tuple_index];
+  }
+
+  for (auto& value_column : _value_columns) {
+    value_column.tuple_entry.guaranteed_non_null =
+        tuple_non_nullable_information[value_column.tuple_entry.tuple_index];
+    value_column.hashmap_entry.guaranteed_non_null =
+        tuple_non_nullable_information[value_column.tuple_entry.tuple_index];
+  }
+}
+
+void JitHashJoinBuild::before_query(JitRuntimeContext& context) const {
+  // Resize the hashmap data structure.
+  context.hashmap.columns.resize(_num_hashmap_columns);
+}
+
+void JitHashJoinBuild::add_key_column(const JitTupleEntry& tuple_entry) {
+  _key_columns.emplace_back(
+      JitHashJoinBuildColumn{tuple_entry, JitHashmapEntry(tuple_entry.data_type, true, _num_hashmap_columns++)});
+}
+
+size_t JitHashJoinBuild::add_value_column(const JitTupleEntry& tuple_entry) {
+  _value_columns.emplace_back(JitHashJoinBuildColumn{
+      tuple_entry, JitHashmapEntry(tuple_entry.data_type, tuple_entry.guaranteed_non_null, _num_hashmap_columns++)});
+  return _value_columns.size() - 1;
+}
+
+const std::vector<JitHashJoinBuildColumn>& JitHashJoinBuild::key_columns() const { return _key_columns; }
+
+const std::vector<JitHashJoinBuildColumn>& JitHashJoinBuild::value_columns() const { return _value_columns; }
+
+void JitHashJoinBuild::_consume(JitRuntimeContext& context) const {
+  // We use index-based for loops in this function, since the LLVM optimizer is not able to properly unroll range-based
+  // loops, and we need the unrolling for proper specialization.
+
+  const auto num_key_columns = _key_columns.size();
+  const auto num_value_columns = _value_columns.size();
+
+  // Step 1: Compute hash value of the keys. The hash is combined in the same way as in the JitHashJoinProbe operator.
+  uint64_t hash_value = 0;
+  for (uint32_t i = 0; i < num_key_columns; ++i) {
+    if (_key_columns[i].tuple_entry.is_null(context)) return;
+    hash_value = (hash_value << 5u) ^ jit_hash(_key_columns[i].tuple_entry, context);
+  }
+
+  // Step 2: Append the tuple to each column vector. Unlike in the JitAggregate operator, tuples with equal keys are not
+  // merged, as each of them joins with the matching probe tuples.
+  uint64_t row_index{std::numeric_limits<uint64_t>::max()};
+  for (uint32_t i = 0; i < num_key_columns; ++i) {
+    row_index = jit_grow_by_one(_key_columns[i].hashmap_entry, JitVariantVector::InitialValue::Zero, context);
+    jit_assign(_key_columns[i].tuple_entry, _key_columns[i].hashmap_entry, row_index, context);
+  }
+  for (uint32_t i = 0; i < num_value_columns; ++i) {
+    row_index = jit_grow_by_one(_value_columns[i].hashmap_entry, JitVariantVector::InitialValue::Zero, context);
+    jit_assign(_value_columns[i].tuple_entry, _value_columns[i].hashmap_entry, row_index, context);
+  }
+
+  // Step 3: Add the row to the rows with this hash
+  context.hashmap.indices[hash_value].emplace_back(row_index);
+}
+
+}  // namespace opossum
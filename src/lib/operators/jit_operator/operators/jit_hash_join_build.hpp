@@ -0,0 +1,55 @@
+#pragma once
+
+#include "abstract_jittable.hpp"
+
+namespace opossum {
+
+// Represents a column of the build side of a hash join that is stored in the hash table.
+// The tuple_entry provides the values of the build input, which are stored in the hashmap_entry.
+struct JitHashJoinBuildColumn {
+  JitTupleEntry tuple_entry;
+  JitHashmapEntry hashmap_entry;
+};
+
+/* The JitHashJoinBuild operator is the last operator of the pipeline that the JitOperatorWrapper runs on its right
+ * input before the pipeline on its left input. It builds the hash table that the JitHashJoinProbe operator in that
+ * pipeline probes, see jit_hash_join_probe.hpp.
+ *
+ * The hash table uses the same data structure as the JitAggregate operator (a JitRuntimeHashmap):
+ * - A set of vectors - one for each key column and one for each value column, i.e., each column of the build input
+ *   that the operators after the JitHashJoinProbe access. Each consumed tuple appends a row to these vectors.
+ * - A hashmap that maps the hash across all key columns to the indices of the rows with that hash.
+ *
+ * Tuples with a NULL key are not added, as they never match in an (inner) equi-join. The hash table is built in the
+ * runtime hashmap of the build pipeline, from which the JitOperatorWrapper moves it to the runtime context of the probe
+ * pipeline.
+ */
+class JitHashJoinBuild : public AbstractJittable {
+ public:
+  std::string description() const final;
+
+  void before_specialization(const Table& in_table, std::vector<bool>& tuple_non_nullable_information) override;
+
+  // Is called by the JitOperatorWrapper before any tuple is consumed.
+  // This is used to initialize the internal hashmap data structure to the correct size.
+  void before_query(JitRuntimeContext& context) const;
+
+  // Adds a column whose values must be equal to the corresponding key of the JitHashJoinProbe operator.
+  void add_key_column(const JitTupleEntry& tuple_entry);
+
+  // Adds a column whose values are written to the runtime tuple of the probe pipeline for each match.
+  // Returns the index of the column within the value columns.
+  size_t add_value_column(const JitTupleEntry& tuple_entry);
+
+  const std::vector<JitHashJoinBuildColumn>& key_columns() const;
+  const std::vector<JitHashJoinBuildColumn>& value_columns() const;
+
+ private:
+  void _consume(JitRuntimeContext& context) const final;
+
+  uint32_t _num_hashmap_columns{0};
+  std::vector<JitHashJoinBuildColumn> _key_columns;
+  std::vector<JitHashJoinBuildColumn> _value_columns;
+};
+
+}  // namespace opossum
@@ -0,0 +1,94 @@
+#include "jit_hash_join_probe.hpp"
+
+#include "jit_hash_join_build.hpp"
+#include "operators/jit_operator/jit_operations.hpp"
+
+namespace opossum {
+
+JitHashJoinProbe::JitHashJoinProbe(const std::shared_ptr<const JitHashJoinBuild>& hash_join_build)
+    : hash_join_build{hash_join_build} {}
+
+std::string JitHashJoinProbe::description() const {
+  std::stringstream desc;
+  desc << "[HashJoinProbe] Keys: ";
+  for (const auto& key_column : _key_columns) {
+    desc << "x" << key_column.tuple_index << ", ";
+  }
+  desc << " Values: ";
+  for (const auto& value_column : _value_columns) {
+    desc << "x" << value_column.tuple_index << ", ";
+  }
+  return desc.str();
+}
+
+void JitHashJoinProbe::before_specialization(const Table& in_table,
+                                             std::vector<bool>& tuple_non_nullable_information) {
+  for (auto& key_column : _key_columns) {
+    key_column.guaranteed_non_null = tuple_non_nullable_information[key_column.tuple_index];
+  }
+
+  // The build pipeline is specialized first, so the nullability of the build input is known
+  const auto& build_value_columns = hash_join_build->value_columns();
+  DebugAssert(build_value_columns.size() == _value_columns.size(), "Value columns of build and probe do not match");
+  for (auto column_idx = size_t{0}; column_idx < _value_columns.size(); ++column_idx) {
+    auto& value_column = _value_columns[column_idx];
+    value_column.guaranteed_non_null = build_value_columns[column_idx].hashmap_entry.guaranteed_non_null;
+    tuple_non_nullable_information[value_column.tuple_index] = value_column.guaranteed_non_null;
+  }
+}
+
+void JitHashJoinProbe::add_key_column(const JitTupleEntry& tuple_entry) { _key_columns.emplace_back(tuple_entry); }
+
+void JitHashJoinProbe::add_value_column(const JitTupleEntry& tuple_entry) {
+  _value_columns.emplace_back(tuple_entry);
+}
+
+const std::vector<JitTupleEntry>& JitHashJoinProbe::key_columns() const { return _key_columns; }
+
+const std::vector<JitTupleEntry>& JitHashJoinProbe::value_columns() const { return _value_columns; }
+
+void JitHashJoinProbe::_consume(JitRuntimeContext& context) const {
+  // We use index-based for loops in this function, since the LLVM optimizer is not able to properly unroll range-based
+  // loops, and we need the unrolling for proper specialization.
+
+  const auto& build_key_columns = hash_join_build->key_columns();
+  const auto& build_value_columns = hash_join_build->value_columns();
+  const auto num_key_columns = _key_columns.size();
+  const auto num_value_columns = _value_columns.size();
+
+  // Step 1: Compute hash value of the keys. NULL keys never match.
+  uint64_t hash_value = 0;
+  for (uint32_t i = 0; i < num_key_columns; ++i) {
+    if (_key_columns[i].is_null(context)) return;
+    hash_value = (hash_value << 5u) ^ jit_hash(_key_columns[i], context);
+  }
+
+  // Step 2: Look up the rows with this hash in the hash table.
+  const auto hash_bucket_iter = context.join_hashmap.indices.find(hash_value);
+  if (hash_bucket_iter == context.join_hashmap.indices.end()) return;
+  const auto& hash_bucket = hash_bucket_iter->second;
+
+  // Step 3: Emit the tuple once for each row with equal keys, with the values of that row. As in the JitAggregate
+  // operator, the loop over the bucket is not specializable as its size depends on the data.
+  for (const auto& row_index : hash_bucket) {
+    bool all_keys_equal = true;
+    for (uint32_t i = 0; i < num_key_columns; ++i) {
+      if (!jit_hash_join_equals(_key_columns[i], build_key_columns[i].hashmap_entry, row_index, context)) {
+        all_keys_equal = false;
+        break;
+      }
+    }
+    if (!all_keys_equal) continue;
+
+    for (uint32_t i = 0; i < num_value_columns; ++i) {
+      jit_hash_join_assign(build_value_columns[i].hashmap_entry, row_index, _value_columns[i], context);
+    }
+
+    _emit(context);
+
+    // A JitLimit operator might have emitted its last tuple
+    if (context.limit_rows == 0) return;
+  }
+}
+
+}  // namespace opossum
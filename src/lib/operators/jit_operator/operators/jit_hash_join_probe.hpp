@@ -0,0 +1,44 @@
+#pragma once
+
+#include "abstract_jittable.hpp"
+
+namespace opossum {
+
+class JitHashJoinBuild;
+
+/* The JitHashJoinProbe operator computes an inner equi-join between the tuples of its pipeline (the probe side) and
+ * the build input of the JitOperatorWrapper, whose tuples were added to a hash table by a JitHashJoinBuild operator.
+ *
+ * For each consumed tuple, the hash across its key columns is looked up in the hash table. For each row of the build
+ * side whose keys are equal to the keys of the tuple, the values of the row are written to the runtime tuple and the
+ * tuple is passed on to the next operator. Thus, the operators following the JitHashJoinProbe in the pipeline can
+ * access the columns of both join inputs and no intermediate join result needs to be materialized.
+ */
+class JitHashJoinProbe : public AbstractJittable {
+ public:
+  explicit JitHashJoinProbe(const std::shared_ptr<const JitHashJoinBuild>& hash_join_build);
+
+  std::string description() const final;
+
+  void before_specialization(const Table& in_table, std::vector<bool>& tuple_non_nullable_information) override;
+
+  // Adds a key column of the probe side. Its values are compared to the key column of the JitHashJoinBuild operator
+  // with the same index.
+  void add_key_column(const JitTupleEntry& tuple_entry);
+
+  // Adds the tuple entry that the value column of the JitHashJoinBuild operator with the same index is written to
+  void add_value_column(const JitTupleEntry& tuple_entry);
+
+  const std::vector<JitTupleEntry>& key_columns() const;
+  const std::vector<JitTupleEntry>& value_columns() const;
+
+  const std::shared_ptr<const JitHashJoinBuild> hash_join_build;
+
+ private:
+  void _consume(JitRuntimeContext& context) const final;
+
+  std::vector<JitTupleEntry> _key_columns;
+  std::vector<JitTupleEntry> _value_columns;
+};
+
+}  // namespace opossum
@@ -188,7 +188,8 @@ void JitReadTuples::before_query(const Table& in_table, const std::vector<AllTyp
 }
 
 bool JitReadTuples::before_chunk(const Table& in_table, const ChunkID chunk_id,
-                                 const std::vector<AllTypeVariant>& parameter_values, JitRuntimeContext& context) {
+                                 const std::vector<AllTypeVariant>& parameter_values,
+                                 JitRuntimeContext& context) const {
   const auto& in_chunk = *in_table.get_chunk(chunk_id);
 
   context.inputs.clear();
@@ -287,12 +288,16 @@ bool JitReadTuples::before_chunk(const Table& in_table, const ChunkID chunk_id,
     }
   }
 
-  // If the specialized function cannot be used, the jit expressions must be updated according to the encoding of the
-  // current chunk
+  // If the specialized function cannot be used, the jit expressions must use actual values instead of value ids for the
+  // segments of the current chunk that are not dictionary-encoded
+  context.tuple_entries_without_value_ids.clear();
   if (!use_specialization) {
+    context.tuple_entries_without_value_ids.resize(_num_tuple_values, false);
     for (const auto& value_id_expression : _value_id_expressions) {
-      const bool use_value_ids = segments_are_dictionaries[value_id_expression.input_column_index];
-      value_id_expression.jit_expression->use_value_ids = use_value_ids;
+      if (!segments_are_dictionaries[value_id_expression.input_column_index]) {
+        const auto& tuple_entry = _input_columns[value_id_expression.input_column_index].tuple_entry;
+        context.tuple_entries_without_value_ids[tuple_entry.tuple_index] = true;
+      }
     }
   }
 
@@ -136,7 +136,7 @@ class JitReadTuples : public AbstractJittable {
    *         specialized function cannot be used for this chunk.
    */
   virtual bool before_chunk(const Table& in_table, const ChunkID chunk_id,
-                            const std::vector<AllTypeVariant>& parameter_values, JitRuntimeContext& context);
+                            const std::vector<AllTypeVariant>& parameter_values, JitRuntimeContext& context) const;
 
   /*
    * Methods create a place in the runtime tuple to hold a column, literal, parameter or temporary value which are used
@@ -3,6 +3,8 @@
 #include "expression/expression_utils.hpp"
 #include "operators/jit_operator/operators/jit_aggregate.hpp"
 #include "operators/jit_operator/operators/jit_validate.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 
 namespace opossum {
 
@@ -13,12 +15,34 @@ JitOperatorWrapper::JitOperatorWrapper(const std::shared_ptr<const AbstractOpera
       _execution_mode{execution_mode},
       _specialized_function_wrapper{specialized_function_wrapper} {}
 
+JitOperatorWrapper::JitOperatorWrapper(const std::shared_ptr<const AbstractOperator>& left,
+                                       const std::shared_ptr<const AbstractOperator>& right,
+                                       const JitExecutionMode execution_mode,
+                                       const std::shared_ptr<SpecializedFunctionWrapper>& specialized_function_wrapper)
+    : AbstractReadOnlyOperator{OperatorType::JitOperatorWrapper, left, right},
+      _execution_mode{execution_mode},
+      _specialized_function_wrapper{specialized_function_wrapper} {}
+
+JitOperatorWrapper::SpecializedFunctionWrapper::~SpecializedFunctionWrapper() {
+  if (compilation_thread.joinable()) compilation_thread.join();
+}
+
+void JitOperatorWrapper::SpecializedFunctionWrapper::wait_for_compilation() {
+  if (const auto task = compilation_task.lock()) {
+    CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+  }
+  if (compilation_thread.joinable()) compilation_thread.join();
+}
+
 const std::string JitOperatorWrapper::name() const { return "JitOperatorWrapper"; }
 
 const std::string JitOperatorWrapper::description(DescriptionMode description_mode) const {
   std::stringstream desc;
   const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
   desc << "[JitOperatorWrapper]" << separator;
+  for (const auto& op : _specialized_function_wrapper->build_jit_operators) {
+    desc << op->description() << separator;
+  }
   for (const auto& op : _specialized_function_wrapper->jit_operators) {
     desc << op->description() << separator;
   }
@@ -33,10 +57,25 @@ const std::vector<std::shared_ptr<AbstractJittable>>& JitOperatorWrapper::jit_op
   return _specialized_function_wrapper->jit_operators;
 }
 
+void JitOperatorWrapper::add_build_jit_operator(const std::shared_ptr<AbstractJittable>& op) {
+  _specialized_function_wrapper->build_jit_operators.push_back(op);
+}
+
+const std::vector<std::shared_ptr<AbstractJittable>>& JitOperatorWrapper::build_jit_operators() const {
+  return _specialized_function_wrapper->build_jit_operators;
+}
+
 const std::vector<AllTypeVariant>& JitOperatorWrapper::input_parameter_values() const {
   return _input_parameter_values;
 }
 
+JitExecutionMode JitOperatorWrapper::execution_mode() const { return _execution_mode; }
+
+const std::shared_ptr<JitOperatorWrapper::SpecializedFunctionWrapper>&
+JitOperatorWrapper::specialized_function_wrapper() const {
+  return _specialized_function_wrapper;
+}
+
 const std::shared_ptr<JitReadTuples> JitOperatorWrapper::_source() const {
   return std::dynamic_pointer_cast<JitReadTuples>(_specialized_function_wrapper->jit_operators.front());
 }
@@ -45,12 +84,30 @@ const std::shared_ptr<AbstractJittableSink> JitOperatorWrapper::_sink() const {
   return std::dynamic_pointer_cast<AbstractJittableSink>(_specialized_function_wrapper->jit_operators.back());
 }
 
+const std::shared_ptr<JitReadTuples> JitOperatorWrapper::_build_source() const {
+  return std::dynamic_pointer_cast<JitReadTuples>(_specialized_function_wrapper->build_jit_operators.front());
+}
+
+const std::shared_ptr<JitHashJoinBuild> JitOperatorWrapper::_build_sink() const {
+  return std::dynamic_pointer_cast<JitHashJoinBuild>(_specialized_function_wrapper->build_jit_operators.back());
+}
+
 std::shared_ptr<const Table> JitOperatorWrapper::_on_execute() {
   Assert(_source(), "JitOperatorWrapper does not have a valid source node.");
   Assert(_sink(), "JitOperatorWrapper does not have a valid sink node.");
+  if (!_specialized_function_wrapper->build_jit_operators.empty()) {
+    Assert(input_right(), "JitOperatorWrapper with a build pipeline requires a right input.");
+    Assert(_build_source(), "Build pipeline of JitOperatorWrapper does not have a valid source node.");
+    Assert(_build_sink(), "Build pipeline of JitOperatorWrapper does not have a valid sink node.");
+  }
 
   _prepare_and_specialize_operator_pipeline();
 
+  if (_execution_mode == JitExecutionMode::Tiered &&
+      ++_specialized_function_wrapper->execution_count >= TIERED_COMPILATION_EXECUTION_THRESHOLD) {
+    _start_tiered_compilation();
+  }
+
   const auto in_table = input_left()->get_output();
 
   auto out_table = _sink()->create_output_table(*in_table);
@@ -61,13 +118,15 @@ std::shared_ptr<const Table> JitOperatorWrapper::_on_execute() {
     context.snapshot_commit_id = transaction_context()->snapshot_commit_id();
   }
 
+  if (!_specialized_function_wrapper->build_jit_operators.empty()) _build_hash_table(context);
+
   _source()->before_query(*in_table, _input_parameter_values, context);
   _sink()->before_query(*out_table, context);
 
   for (ChunkID chunk_id{0}; chunk_id < in_table->chunk_count() && context.limit_rows; ++chunk_id) {
     bool use_specialized_function = _source()->before_chunk(*in_table, chunk_id, _input_parameter_values, context);
     if (use_specialized_function) {
-      _specialized_function_wrapper->execute_func(_source().get(), context);
+      _execute_specialized_function(false, context);
     } else {
       _source()->execute(context);
     }
@@ -79,12 +138,65 @@ std::shared_ptr<const Table> JitOperatorWrapper::_on_execute() {
   return out_table;
 }
 
+void JitOperatorWrapper::_build_hash_table(JitRuntimeContext& context) const {
+  const auto build_table = input_right()->get_output();
+
+  // The build pipeline runs in a separate context, as its tuple layout is independent of the probe pipeline
+  JitRuntimeContext build_context;
+  build_context.transaction_id = context.transaction_id;
+  build_context.snapshot_commit_id = context.snapshot_commit_id;
+
+  _build_source()->before_query(*build_table, {}, build_context);
+  _build_sink()->before_query(build_context);
+
+  for (ChunkID chunk_id{0}; chunk_id < build_table->chunk_count(); ++chunk_id) {
+    bool use_specialized_function = _build_source()->before_chunk(*build_table, chunk_id, {}, build_context);
+    if (use_specialized_function) {
+      _execute_specialized_function(true, build_context);
+    } else {
+      _build_source()->execute(build_context);
+    }
+  }
+
+  context.join_hashmap = std::move(build_context.hashmap);
+}
+
 void JitOperatorWrapper::_prepare_and_specialize_operator_pipeline() {
   // Use a mutex to specialize a jittable operator pipeline within a subquery only once.
   // See jit_operator_wrapper.hpp for details.
   std::lock_guard<std::mutex> guard(_specialized_function_wrapper->specialization_mutex);
   if (_specialized_function_wrapper->execute_func) return;
 
+  // The build pipeline is specialized first, since the probe operator needs to know which of the values stored in the
+  // hash table can be NULL.
+  const auto& build_jit_operators = _specialized_function_wrapper->build_jit_operators;
+  if (!build_jit_operators.empty()) {
+    const auto build_table = input_right()->get_output();
+
+    std::vector<bool> build_tuple_non_nullable_information;
+    for (auto& jit_operator : build_jit_operators) {
+      jit_operator->before_specialization(*build_table, build_tuple_non_nullable_information);
+    }
+
+    for (auto it = build_jit_operators.begin(); it + 1 < build_jit_operators.end(); ++it) {
+      (*it)->set_next_operator(*(it + 1));
+    }
+
+    switch (_execution_mode) {
+      case JitExecutionMode::Compile:
+        _specialized_function_wrapper->build_execute_func =
+            _specialized_function_wrapper->build_module
+                .specialize_and_compile_function<void(const JitReadTuples*, JitRuntimeContext&)>(
+                    "_ZNK7opossum13JitReadTuples7executeERNS_17JitRuntimeContextE",
+                    std::make_shared<JitConstantRuntimePointer>(_build_source().get()));
+        break;
+      case JitExecutionMode::Interpret:
+      case JitExecutionMode::Tiered:
+        _specialized_function_wrapper->build_execute_func = &JitReadTuples::execute;
+        break;
+    }
+  }
+
   const auto in_table = input_left()->get_output();
 
   const auto jit_operators = _specialized_function_wrapper->jit_operators;
@@ -113,11 +225,79 @@ void JitOperatorWrapper::_prepare_and_specialize_operator_pipeline() {
                   std::make_shared<JitConstantRuntimePointer>(_source().get()), two_specialization_passes);
       break;
     case JitExecutionMode::Interpret:
+    case JitExecutionMode::Tiered:
       _specialized_function_wrapper->execute_func = &JitReadTuples::execute;
       break;
   }
 }
 
+void JitOperatorWrapper::_execute_specialized_function(const bool build_pipeline, JitRuntimeContext& context) const {
+  auto& specialized_function_wrapper = *_specialized_function_wrapper;
+  const auto source = build_pipeline ? _build_source() : _source();
+
+  if (_execution_mode == JitExecutionMode::Tiered) {
+    if (const auto compiled_functions = std::atomic_load(&specialized_function_wrapper.compiled_functions)) {
+      const auto& execute_func =
+          build_pipeline ? compiled_functions->build_execute_func : compiled_functions->execute_func;
+      execute_func(source.get(), context);
+      return;
+    }
+    if (++specialized_function_wrapper.interpreted_chunk_count >= TIERED_COMPILATION_CHUNK_THRESHOLD) {
+      _start_tiered_compilation();
+    }
+  }
+
+  const auto& execute_func =
+      build_pipeline ? specialized_function_wrapper.build_execute_func : specialized_function_wrapper.execute_func;
+  execute_func(source.get(), context);
+}
+
+void JitOperatorWrapper::_start_tiered_compilation() const {
+  if (_specialized_function_wrapper->compilation_started.exchange(true)) return;
+
+  const auto build_source = _specialized_function_wrapper->build_jit_operators.empty() ? nullptr : _build_source();
+  const auto two_specialization_passes = static_cast<bool>(std::dynamic_pointer_cast<JitAggregate>(_sink()));
+
+  // The compilation must not access the JitOperatorWrapper, which might be destroyed before it finishes. The operators
+  // are not modified after _prepare_and_specialize_operator_pipeline(), so they can be specialized while other
+  // executions interpret them. The specialization uses JitCodeSpecializers of its own, which are published only once
+  // both functions are compiled.
+  const auto compile = [source = _source(), build_source,
+                        two_specialization_passes](SpecializedFunctionWrapper& specialized_function_wrapper) {
+    using CompiledFunctions = SpecializedFunctionWrapper::CompiledFunctions;
+    auto compiled_functions = std::make_shared<CompiledFunctions>();
+
+    if (build_source) {
+      compiled_functions->build_execute_func =
+          compiled_functions->build_module
+              .specialize_and_compile_function<void(const JitReadTuples*, JitRuntimeContext&)>(
+                  "_ZNK7opossum13JitReadTuples7executeERNS_17JitRuntimeContextE",
+                  std::make_shared<JitConstantRuntimePointer>(build_source.get()));
+    }
+
+    compiled_functions->execute_func =
+        compiled_functions->module.specialize_and_compile_function<void(const JitReadTuples*, JitRuntimeContext&)>(
+            "_ZNK7opossum13JitReadTuples7executeERNS_17JitRuntimeContextE",
+            std::make_shared<JitConstantRuntimePointer>(source.get()), two_specialization_passes);
+
+    std::atomic_store(&specialized_function_wrapper.compiled_functions,
+                      std::shared_ptr<const CompiledFunctions>{std::move(compiled_functions)});
+  };
+
+  // Without a scheduler, AbstractTask::schedule() would run the task right away and block this execution
+  if (!CurrentScheduler::is_set()) {
+    _specialized_function_wrapper->compilation_thread = std::thread{compile, std::ref(*_specialized_function_wrapper)};
+    return;
+  }
+
+  const auto compilation_task =
+      std::make_shared<JobTask>([compile, specialized_function_wrapper = _specialized_function_wrapper]() {
+        compile(*specialized_function_wrapper);
+      });
+  _specialized_function_wrapper->compilation_task = compilation_task;
+  compilation_task->schedule();
+}
+
 void JitOperatorWrapper::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
   const auto& input_parameters = _source()->input_parameters();
   _input_parameter_values.resize(input_parameters.size());
@@ -145,6 +325,10 @@ void JitOperatorWrapper::_on_set_transaction_context(const std::weak_ptr<Transac
 std::shared_ptr<AbstractOperator> JitOperatorWrapper::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  if (copied_input_right) {
+    return std::make_shared<JitOperatorWrapper>(copied_input_left, copied_input_right, _execution_mode,
+                                                _specialized_function_wrapper);
+  }
   return std::make_shared<JitOperatorWrapper>(copied_input_left, _execution_mode, _specialized_function_wrapper);
 }
 
@@ -1,15 +1,26 @@
 #pragma once
 
+#include <atomic>
 #include <string>
+#include <thread>
 
 #include "abstract_read_only_operator.hpp"
 #include "jit_operator/operators/abstract_jittable_sink.hpp"
+#include "jit_operator/operators/jit_hash_join_build.hpp"
 #include "jit_operator/operators/jit_read_tuples.hpp"
 #include "operators/jit_operator/specialization/jit_code_specializer.hpp"
 
 namespace opossum {
 
-enum class JitExecutionMode { Interpret, Compile };
+class AbstractTask;
+
+/* Interpret runs the operator pipeline through virtual calls, Compile specializes and compiles it before the first
+ * execution. Tiered starts out interpreting and compiles the pipeline once it turned out to be hot, i.e., after it was
+ * executed TIERED_COMPILATION_EXECUTION_THRESHOLD times or interpreted for TIERED_COMPILATION_CHUNK_THRESHOLD chunks.
+ * The compilation runs as a JobTask if a scheduler is set and on a thread of its own otherwise, so that it never blocks
+ * the execution that started it. Short-running queries thus do not pay the compilation latency.
+ */
+enum class JitExecutionMode { Interpret, Compile, Tiered };
 
 /* The JitOperatorWrapper wraps a number of jittable operators and exposes them through Hyrise's default
  * operator interface. This allows a number of jit operators to be seamlessly integrated with
@@ -17,6 +28,10 @@ enum class JitExecutionMode { Interpret, Compile };
  * The JitOperatorWrapper is responsible for chaining the operators it contains, compiling code for the operators at
  * runtime, creating and managing the runtime context and calling hooks (before/after processing a chunk or the entire
  * query) on the its operators.
+ *
+ * If the operator pipeline contains a JitHashJoinProbe, the JitOperatorWrapper has a right input, the build side of
+ * the join. Before the pipeline is run on the left input, a second pipeline (from a JitReadTuples to a
+ * JitHashJoinBuild operator) is run on the right input to build the hash table.
  */
 class JitOperatorWrapper : public AbstractReadOnlyOperator {
  public:
@@ -30,19 +45,61 @@ class JitOperatorWrapper : public AbstractReadOnlyOperator {
    * instance will also start specializing the pipeline as no specialized function exists so far.
    * To prevent this, a mutex is used during specialization which ensures that only the first JitOperatorWrapper
    * instance specializes the pipeline and all other instances wait till the specialization finishes.
+   *
+   * In the Tiered execution mode, execute_func interprets the pipeline. A JobTask or, without a scheduler, the
+   * compilation_thread specializes the pipeline with its own JitCodeSpecializers and publishes them together with the
+   * compiled functions in compiled_functions. Executions that load compiled_functions keep the compiled code alive
+   * until they finish. The JobTask keeps the SpecializedFunctionWrapper alive, the thread is joined on destruction.
    */
   struct SpecializedFunctionWrapper {
+    ~SpecializedFunctionWrapper();
+
+    // Blocks until a started Tiered compilation has published its functions
+    void wait_for_compilation();
+
     std::vector<std::shared_ptr<AbstractJittable>> jit_operators;
     std::function<void(const JitReadTuples*, JitRuntimeContext&)> execute_func;
     std::mutex specialization_mutex;
     JitCodeSpecializer module;
+
+    // The pipeline building the hash table of a JitHashJoinProbe, if any
+    std::vector<std::shared_ptr<AbstractJittable>> build_jit_operators;
+    std::function<void(const JitReadTuples*, JitRuntimeContext&)> build_execute_func;
+    JitCodeSpecializer build_module;
+
+    // Tiered execution
+    struct CompiledFunctions {
+      std::function<void(const JitReadTuples*, JitRuntimeContext&)> execute_func;
+      JitCodeSpecializer module;
+      std::function<void(const JitReadTuples*, JitRuntimeContext&)> build_execute_func;
+      JitCodeSpecializer build_module;
+    };
+
+    std::atomic_size_t execution_count{0};
+    std::atomic_size_t interpreted_chunk_count{0};
+    std::atomic_bool compilation_started{false};
+    // Only accessed through std::atomic_load() and std::atomic_store(), nullptr until the compilation finished
+    std::shared_ptr<const CompiledFunctions> compiled_functions;
+    // The task does not keep itself alive after it finished, hence the weak_ptr
+    std::weak_ptr<AbstractTask> compilation_task;
+    std::thread compilation_thread;
   };
 
+  static constexpr size_t TIERED_COMPILATION_EXECUTION_THRESHOLD = 3;
+  static constexpr size_t TIERED_COMPILATION_CHUNK_THRESHOLD = 32;
+
   explicit JitOperatorWrapper(const std::shared_ptr<const AbstractOperator>& left,
                               const JitExecutionMode execution_mode = JitExecutionMode::Compile,
                               const std::shared_ptr<SpecializedFunctionWrapper>& specialized_function_wrapper =
                                   std::make_shared<SpecializedFunctionWrapper>());
 
+  // For operator pipelines containing a JitHashJoinProbe, with @param right being the build input of the join
+  JitOperatorWrapper(const std::shared_ptr<const AbstractOperator>& left,
+                     const std::shared_ptr<const AbstractOperator>& right,
+                     const JitExecutionMode execution_mode = JitExecutionMode::Compile,
+                     const std::shared_ptr<SpecializedFunctionWrapper>& specialized_function_wrapper =
+                         std::make_shared<SpecializedFunctionWrapper>());
+
   const std::string name() const final;
   const std::string description(DescriptionMode description_mode) const final;
 
@@ -51,8 +108,19 @@ class JitOperatorWrapper : public AbstractReadOnlyOperator {
   void add_jit_operator(const std::shared_ptr<AbstractJittable>& op);
 
   const std::vector<std::shared_ptr<AbstractJittable>>& jit_operators() const;
+
+  // Adds a jittable operator to the end of the operator pipeline that builds the hash table of a JitHashJoinProbe.
+  // This pipeline must start with a JitReadTuples and end with a JitHashJoinBuild operator.
+  void add_build_jit_operator(const std::shared_ptr<AbstractJittable>& op);
+
+  const std::vector<std::shared_ptr<AbstractJittable>>& build_jit_operators() const;
+
   const std::vector<AllTypeVariant>& input_parameter_values() const;
 
+  JitExecutionMode execution_mode() const;
+
+  const std::shared_ptr<SpecializedFunctionWrapper>& specialized_function_wrapper() const;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
 
@@ -66,8 +134,22 @@ class JitOperatorWrapper : public AbstractReadOnlyOperator {
   const std::shared_ptr<JitReadTuples> _source() const;
   const std::shared_ptr<AbstractJittableSink> _sink() const;
 
+  const std::shared_ptr<JitReadTuples> _build_source() const;
+  const std::shared_ptr<JitHashJoinBuild> _build_sink() const;
+
   void _prepare_and_specialize_operator_pipeline();
 
+  // Runs the specialized function of the (build) pipeline on a chunk that can use it. In the Tiered execution mode, the
+  // compiled function is used once it was published. Until then, this counts interpreted chunks and starts the
+  // compilation once the pipeline is hot.
+  void _execute_specialized_function(const bool build_pipeline, JitRuntimeContext& context) const;
+
+  // Compiles the pipelines of a Tiered JitOperatorWrapper in the background, unless this already happened
+  void _start_tiered_compilation() const;
+
+  // Runs the build pipeline on the right input and moves the resulting hash table to @param context
+  void _build_hash_table(JitRuntimeContext& context) const;
+
   const JitExecutionMode _execution_mode;
   const std::shared_ptr<SpecializedFunctionWrapper> _specialized_function_wrapper;
 
@@ -0,0 +1,94 @@
+#include "join_key_filter.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+std::shared_ptr<JoinKeyFilter> JoinKeyFilter::build(const Table& table, const ColumnID column_id,
+                                                    const size_t max_membership_value_count) {
+  auto min_max = std::optional<std::pair<AllTypeVariant, AllTypeVariant>>{};
+  auto membership_values = std::optional<std::vector<AllTypeVariant>>{};
+
+  resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    auto min = std::optional<ColumnDataType>{};
+    auto max = std::optional<ColumnDataType>{};
+
+    // Once there are more distinct values than we want to track, we stop collecting them
+    auto distinct_values = std::set<ColumnDataType>{};
+    auto track_distinct_values = max_membership_value_count > 0;
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& segment = *table.get_chunk(chunk_id)->get_segment(column_id);
+
+      segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+        if (position.is_null()) return;
+
+        const auto& value = position.value();
+        if (!min || value < *min) min = value;
+        if (!max || value > *max) max = value;
+
+        if (track_distinct_values) {
+          distinct_values.emplace(value);
+          if (distinct_values.size() > max_membership_value_count) {
+            track_distinct_values = false;
+            distinct_values.clear();
+          }
+        }
+      });
+    }
+
+    if (!min) return;
+
+    min_max.emplace(AllTypeVariant{*min}, AllTypeVariant{*max});
+
+    if (track_distinct_values) {
+      membership_values.emplace(distinct_values.begin(), distinct_values.end());
+    }
+  });
+
+  return std::make_shared<JoinKeyFilter>(min_max, membership_values);
+}
+
+JoinKeyFilter::JoinKeyFilter(const std::optional<std::pair<AllTypeVariant, AllTypeVariant>>& min_max,
+                             const std::optional<std::vector<AllTypeVariant>>& membership_values)
+    : _min_max(min_max), _membership_values(membership_values) {
+  DebugAssert(_min_max || !_membership_values || _membership_values->empty(),
+              "Without min/max, there cannot be any membership values");
+}
+
+const std::optional<std::pair<AllTypeVariant, AllTypeVariant>>& JoinKeyFilter::min_max() const { return _min_max; }
+
+const std::optional<std::vector<AllTypeVariant>>& JoinKeyFilter::membership_values() const {
+  return _membership_values;
+}
+
+bool JoinKeyFilter::can_prune(const ChunkStatistics& chunk_statistics, const ColumnID column_id) const {
+  // Without any keys, no row can find a join partner
+  if (!_min_max) return true;
+
+  if (chunk_statistics.can_prune(column_id, PredicateCondition::BetweenInclusive, _min_max->first, _min_max->second)) {
+    return true;
+  }
+
+  // The range of the keys overlaps with the Chunk, but there might be no single key that actually occurs in it
+  if (!_membership_values) return false;
+
+  return std::all_of(_membership_values->begin(), _membership_values->end(), [&](const auto& value) {
+    return chunk_statistics.can_prune(column_id, PredicateCondition::Equals, value);
+  });
+}
+
+}  // namespace opossum
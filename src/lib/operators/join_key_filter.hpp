@@ -0,0 +1,54 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class ChunkStatistics;
+class Table;
+
+/**
+ * Summary of the join keys found in one column of a (materialized) join input, used for sideways information passing:
+ * With an equi-join, rows of the other input can only find a join partner if their key lies within [min, max] of the
+ * keys of this input and - if the number of distinct keys is small enough to track them - is one of these keys.
+ * GetTable uses this to skip stored Chunks whose ChunkStatistics (MinMaxFilter/RangeFilter) rule out every key.
+ *
+ * NULLs never find a join partner in an equi-join and are thus ignored.
+ */
+class JoinKeyFilter final {
+ public:
+  // Up to this number of distinct keys, the keys themselves are tracked in addition to their min/max
+  static constexpr auto DEFAULT_MAX_MEMBERSHIP_VALUE_COUNT = size_t{256};
+
+  static std::shared_ptr<JoinKeyFilter> build(
+      const Table& table, const ColumnID column_id,
+      const size_t max_membership_value_count = DEFAULT_MAX_MEMBERSHIP_VALUE_COUNT);
+
+  /**
+   * @param min_max              std::nullopt if there are no (non-NULL) keys
+   * @param membership_values    Sorted distinct keys, std::nullopt if there were too many to track them
+   */
+  JoinKeyFilter(const std::optional<std::pair<AllTypeVariant, AllTypeVariant>>& min_max,
+                const std::optional<std::vector<AllTypeVariant>>& membership_values);
+
+  const std::optional<std::pair<AllTypeVariant, AllTypeVariant>>& min_max() const;
+  const std::optional<std::vector<AllTypeVariant>>& membership_values() const;
+
+  /**
+   * @return  true if the statistics of the Chunk guarantee that none of its values in `column_id` equals one of the
+   *          keys, i.e., the Chunk cannot contribute to the result of the join
+   */
+  bool can_prune(const ChunkStatistics& chunk_statistics, const ColumnID column_id) const;
+
+ private:
+  const std::optional<std::pair<AllTypeVariant, AllTypeVariant>> _min_max;
+  const std::optional<std::vector<AllTypeVariant>> _membership_values;
+};
+
+}  // namespace opossum
@@ -18,6 +18,9 @@ class Limit : public AbstractReadOnlyOperator {
 
   std::shared_ptr<AbstractExpression> row_count_expression() const;
 
+  // Evaluates the expression that determines the number of rows, which has to be a non-negative integer
+  static size_t evaluate_row_count(const AbstractExpression& row_count_expression);
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
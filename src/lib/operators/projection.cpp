@@ -12,6 +12,7 @@
 #include "expression/expression_utils.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
+#include "storage/reference_segment.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -40,15 +41,11 @@ std::shared_ptr<const Table> Projection::_on_execute() {
   const auto& input_table = *input_table_left();
 
   /**
-   * If an expression is a PQPColumnExpression then it might be possible to forward the input column, if the
-   * input TableType (References or Data) matches the output column type (ReferenceSegment or not).
+   * Columns (i.e., PQPColumnExpressions) are forwarded from the input table, so that the output table has the type of
+   * the input table. For a reference table, this avoids materializing the forwarded columns. The computed columns are
+   * stored in a separate data table, which the output table references (see _reference_computed_segments()).
    */
-  const auto only_projects_columns = std::all_of(expressions.begin(), expressions.end(), [&](const auto& expression) {
-    return expression->type == ExpressionType::PQPColumn;
-  });
-
-  const auto output_table_type = only_projects_columns ? input_table.type() : TableType::Data;
-  const auto forward_columns = input_table.type() == output_table_type;
+  const auto output_table_type = input_table.type();
 
   const auto uncorrelated_subquery_results =
       ExpressionEvaluator::populate_uncorrelated_subquery_results_cache(expressions);
@@ -67,20 +64,34 @@ std::shared_ptr<const Table> Projection::_on_execute() {
 
     ExpressionEvaluator evaluator(input_table_left(), chunk_id, uncorrelated_subquery_results);
 
+    // The expressions that are not forwarded are evaluated together, batch-at-a-time
+    auto evaluated_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+    auto evaluated_column_ids = std::vector<ColumnID>{};
+
     for (auto column_id = ColumnID{0}; column_id < expressions.size(); ++column_id) {
       const auto& expression = expressions[column_id];
 
-      // Forward input column if possible
-      if (expression->type == ExpressionType::PQPColumn && forward_columns) {
+      // Forward input column
+      if (expression->type == ExpressionType::PQPColumn) {
         const auto pqp_column_expression = std::static_pointer_cast<PQPColumnExpression>(expression);
         output_segments[column_id] = input_chunk->get_segment(pqp_column_expression->column_id);
         column_is_nullable[column_id] =
             column_is_nullable[column_id] || input_table.column_is_nullable(pqp_column_expression->column_id);
 
       } else {
-        auto output_segment = evaluator.evaluate_expression_to_segment(*expression);
-        column_is_nullable[column_id] = column_is_nullable[column_id] || output_segment->is_nullable();
-        output_segments[column_id] = std::move(output_segment);
+        evaluated_expressions.emplace_back(expression);
+        evaluated_column_ids.emplace_back(column_id);
+      }
+    }
+
+    if (!evaluated_expressions.empty()) {
+      auto evaluated_segments = evaluator.evaluate_expressions_to_segments_batched(evaluated_expressions);
+
+      for (auto expression_idx = size_t{0}; expression_idx < evaluated_expressions.size(); ++expression_idx) {
+        const auto column_id = evaluated_column_ids[expression_idx];
+        column_is_nullable[column_id] =
+            column_is_nullable[column_id] || evaluated_segments[expression_idx]->is_nullable();
+        output_segments[column_id] = std::move(evaluated_segments[expression_idx]);
       }
     }
 
@@ -96,6 +107,10 @@ std::shared_ptr<const Table> Projection::_on_execute() {
                                     column_is_nullable[column_id]);
   }
 
+  if (output_table_type == TableType::References) {
+    _reference_computed_segments(output_chunk_segments, column_definitions);
+  }
+
   auto output_chunks = std::vector<std::shared_ptr<Chunk>>{input_table.chunk_count()};
 
   for (auto chunk_id = ChunkID{0}; chunk_id < input_table.chunk_count(); ++chunk_id) {
@@ -107,6 +122,49 @@ std::shared_ptr<const Table> Projection::_on_execute() {
                                  input_table.has_mvcc());
 }
 
+void Projection::_reference_computed_segments(std::vector<Segments>& output_chunk_segments,
+                                              const TableColumnDefinitions& column_definitions) const {
+  auto computed_column_ids = std::vector<ColumnID>{};
+  auto computed_column_definitions = TableColumnDefinitions{};
+  for (auto column_id = ColumnID{0}; column_id < expressions.size(); ++column_id) {
+    if (expressions[column_id]->type == ExpressionType::PQPColumn) continue;
+
+    computed_column_ids.emplace_back(column_id);
+    computed_column_definitions.emplace_back(column_definitions[column_id]);
+  }
+  if (computed_column_ids.empty()) return;
+
+  // Move the computed segments of each chunk to a chunk of the data table
+  auto computed_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  computed_chunks.reserve(output_chunk_segments.size());
+  for (auto& output_segments : output_chunk_segments) {
+    auto computed_segments = Segments{};
+    for (const auto column_id : computed_column_ids) {
+      computed_segments.emplace_back(std::move(output_segments[column_id]));
+    }
+    computed_chunks.emplace_back(std::make_shared<Chunk>(std::move(computed_segments)));
+  }
+
+  const auto computed_table =
+      std::make_shared<Table>(computed_column_definitions, TableType::Data, std::move(computed_chunks));
+
+  // Replace the computed segments with ReferenceSegments that reference all rows of the corresponding chunk
+  for (auto chunk_id = ChunkID{0}; chunk_id < output_chunk_segments.size(); ++chunk_id) {
+    const auto chunk_size = computed_table->get_chunk(chunk_id)->size();
+    auto pos_list = std::make_shared<PosList>(chunk_size);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      (*pos_list)[chunk_offset] = RowID{chunk_id, chunk_offset};
+    }
+    pos_list->guarantee_single_chunk();
+
+    for (auto computed_column_id = ColumnID{0}; computed_column_id < computed_column_ids.size();
+         ++computed_column_id) {
+      output_chunk_segments[chunk_id][computed_column_ids[computed_column_id]] =
+          std::make_shared<ReferenceSegment>(computed_table, computed_column_id, pos_list);
+    }
+  }
+}
+
 // returns the singleton dummy table used for literal projections
 std::shared_ptr<Table> Projection::dummy_table() {
   static auto shared_dummy = std::make_shared<DummyTable>();
@@ -17,6 +17,9 @@ namespace opossum {
 
 /**
  * Operator to evaluate Expressions (except for AggregateExpressions)
+ *
+ * The output table has the type of the input table. Columns are forwarded without copying their segments. If the input
+ * is a reference table, the computed columns are ReferenceSegments into a data table holding the evaluated values.
  */
 class Projection : public AbstractReadOnlyOperator {
  public:
@@ -50,6 +53,10 @@ class Projection : public AbstractReadOnlyOperator {
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
   void _on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) override;
 
+  // Moves the computed (i.e., not forwarded) segments to a new data table and replaces them with ReferenceSegments
+  void _reference_computed_segments(std::vector<Segments>& output_chunk_segments,
+                                    const TableColumnDefinitions& column_definitions) const;
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
@@ -1,110 +1,273 @@
 #include "sort.hpp"
 
+#include <array>
+#include <cstring>
 #include <functional>
 #include <memory>
+#include <numeric>
+#include <queue>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/segment_accessor.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
 
-namespace opossum {
+namespace {
 
-Sort::Sort(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id, const OrderByMode order_by_mode,
-           const size_t output_chunk_size)
-    : AbstractReadOnlyOperator(OperatorType::Sort, in),
-      _column_id(column_id),
-      _order_by_mode(order_by_mode),
-      _output_chunk_size(output_chunk_size) {}
+using namespace opossum;  // NOLINT
 
-ColumnID Sort::column_id() const { return _column_id; }
+bool nulls_first(const OrderByMode order_by_mode) {
+  return order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::Descending;
+}
 
-OrderByMode Sort::order_by_mode() const { return _order_by_mode; }
+bool is_descending(const OrderByMode order_by_mode) {
+  return order_by_mode == OrderByMode::Descending || order_by_mode == OrderByMode::DescendingNullsLast;
+}
 
-const std::string Sort::name() const { return "Sort"; }
+// Number of bytes that the values of a column take up in the normalized key. Strings are encoded as their rank.
+size_t normalized_value_width(const DataType data_type) {
+  return data_type == DataType::Long || data_type == DataType::Double ? 8 : 4;
+}
 
-std::shared_ptr<AbstractOperator> Sort::_on_deep_copy(
-    const std::shared_ptr<AbstractOperator>& copied_input_left,
-    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<Sort>(copied_input_left, _column_id, _order_by_mode, _output_chunk_size);
+// Maps a value to an unsigned integer that has the same order as the value, i.e., the sign bit of integers is flipped,
+// and negative floating-point numbers have all bits inverted (so that larger magnitudes become smaller).
+template <typename ColumnDataType>
+uint64_t order_preserving_bits(const ColumnDataType value) {
+  if constexpr (std::is_same_v<ColumnDataType, int32_t>) {
+    return static_cast<uint32_t>(value) ^ uint32_t{0x8000'0000};
+  } else if constexpr (std::is_same_v<ColumnDataType, int64_t>) {
+    return static_cast<uint64_t>(value) ^ uint64_t{0x8000'0000'0000'0000};
+  } else if constexpr (std::is_floating_point_v<ColumnDataType>) {  // NOLINT - doesn't like else if constexpr
+    using Bits = std::conditional_t<std::is_same_v<ColumnDataType, float>, uint32_t, uint64_t>;
+    constexpr auto sign_bit = Bits{1} << (sizeof(Bits) * 8 - 1);
+
+    // -0.0 and 0.0 are equal and have to be encoded the same way
+    const auto normalized_value = value == ColumnDataType{0} ? ColumnDataType{0} : value;
+    auto bits = Bits{};
+    std::memcpy(&bits, &normalized_value, sizeof(Bits));
+    return (bits & sign_bit) ? static_cast<Bits>(~bits) : static_cast<Bits>(bits | sign_bit);
+  } else {
+    Fail("Strings are encoded by their rank");
+  }
 }
 
-void Sort::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+// Writes the @param width least significant bytes of @param bits to @param key, most significant byte first
+void write_big_endian(const uint64_t bits, const size_t width, uint8_t* key) {
+  for (auto byte_index = size_t{0}; byte_index < width; ++byte_index) {
+    key[byte_index] = static_cast<uint8_t>(bits >> (8 * (width - 1 - byte_index)));
+  }
+}
 
-std::shared_ptr<const Table> Sort::_on_execute() {
-  _impl = make_unique_by_data_type<AbstractReadOnlyOperatorImpl, SortImpl>(
-      input_table_left()->column_data_type(_column_id), input_table_left(), _column_id, _order_by_mode,
-      _output_chunk_size);
-  return _impl->_on_execute();
+// Layout of a sort column within the normalized key
+struct NormalizedKeyColumn {
+  ColumnID column_id;
+  DataType data_type;
+  OrderByMode order_by_mode;
+  bool has_null_byte;
+  size_t offset;
+  size_t value_width;
+
+  // Only for string columns: the sorted distinct values, the rank of a value is its index
+  std::vector<pmr_string> sorted_strings;
+};
+
+// A chunk of the input table with the normalized keys of its rows (stored contiguously in the order of the rows) and
+// the offsets of its rows in sorted order
+struct SortedRun {
+  std::vector<uint8_t> keys;
+  std::vector<ChunkOffset> sorted_offsets;
+};
+
+void encode_keys(const Chunk& chunk, const std::vector<NormalizedKeyColumn>& key_columns, const size_t key_width,
+                 std::vector<uint8_t>& keys) {
+  keys.resize(chunk.size() * key_width);
+
+  for (const auto& key_column : key_columns) {
+    const auto null_byte = static_cast<uint8_t>(nulls_first(key_column.order_by_mode) ? 0 : 1);
+    const auto descending = is_descending(key_column.order_by_mode);
+
+    resolve_data_type(key_column.data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      segment_iterate<ColumnDataType>(*chunk.get_segment(key_column.column_id), [&](const auto& position) {
+        auto* key = keys.data() + position.chunk_offset() * key_width + key_column.offset;
+
+        // The value bytes of NULLs stay zero, so that all NULLs compare as equal
+        if (key_column.has_null_byte) {
+          *key = position.is_null() ? null_byte : static_cast<uint8_t>(1 - null_byte);
+          ++key;
+        }
+        if (position.is_null()) return;
+
+        auto bits = uint64_t{};
+        if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+          const auto& sorted_strings = key_column.sorted_strings;
+          bits = std::lower_bound(sorted_strings.begin(), sorted_strings.end(), position.value()) -
+                 sorted_strings.begin();
+        } else {
+          bits = order_preserving_bits(position.value());
+        }
+        write_big_endian(descending ? ~bits : bits, key_column.value_width, key);
+      });
+    });
+  }
 }
 
-void Sort::_on_cleanup() { _impl.reset(); }
+// Least significant digit radix sort of the offsets by their keys, one byte per pass. It is stable, so equal keys
+// keep the order of their rows within the chunk.
+void radix_sort(const std::vector<uint8_t>& keys, const size_t key_width, std::vector<ChunkOffset>& offsets) {
+  if (offsets.empty()) return;
+
+  auto buffer = std::vector<ChunkOffset>(offsets.size());
+  auto histogram = std::array<size_t, 256>{};
+
+  for (auto byte_index = key_width; byte_index-- > 0;) {
+    histogram.fill(0);
+    for (const auto offset : offsets) {
+      ++histogram[keys[offset * key_width + byte_index]];
+    }
+
+    // Skip bytes that are the same for all rows, e.g., the high bytes of small integers or unused NULL bytes
+    if (histogram[keys[offsets.front() * key_width + byte_index]] == offsets.size()) continue;
+
+    auto bucket_begin = size_t{0};
+    for (auto& bucket : histogram) {
+      const auto bucket_size = bucket;
+      bucket = bucket_begin;
+      bucket_begin += bucket_size;
+    }
+
+    for (const auto offset : offsets) {
+      buffer[histogram[keys[offset * key_width + byte_index]]++] = offset;
+    }
+    std::swap(offsets, buffer);
+  }
+}
+
+void sort_run(const size_t key_width, SortedRun& run) {
+  auto& offsets = run.sorted_offsets;
+  offsets.resize(run.keys.size() / key_width);
+  std::iota(offsets.begin(), offsets.end(), ChunkOffset{0});
+
+  if (key_width <= Sort::MAX_RADIX_SORT_KEY_WIDTH) {
+    radix_sort(run.keys, key_width, offsets);
+  } else {
+    const auto* keys = run.keys.data();
+    std::stable_sort(offsets.begin(), offsets.end(), [&](const auto lhs, const auto rhs) {
+      return std::memcmp(keys + lhs * key_width, keys + rhs * key_width, key_width) < 0;
+    });
+  }
+}
+
+// Merges the sorted runs into a single sequence of RowIDs. Rows with equal keys are taken from the run with the lower
+// ChunkID first, which keeps the sort stable.
+PosList merge_runs(const std::vector<SortedRun>& runs, const size_t key_width, const size_t row_count) {
+  auto pos_list = PosList{};
+  pos_list.reserve(row_count);
+
+  if (runs.size() == 1) {
+    for (const auto offset : runs.front().sorted_offsets) {
+      pos_list.emplace_back(RowID{ChunkID{0}, offset});
+    }
+    return pos_list;
+  }
+
+  // The position of each run that is merged next
+  auto run_positions = std::vector<size_t>(runs.size(), 0);
+
+  const auto current_key = [&](const ChunkID chunk_id) {
+    const auto& run = runs[chunk_id];
+    return run.keys.data() + run.sorted_offsets[run_positions[chunk_id]] * key_width;
+  };
+
+  // std::priority_queue is a max-heap, so this returns true if the run on the left has to be merged after the one on
+  // the right.
+  const auto merged_after = [&](const ChunkID lhs, const ChunkID rhs) {
+    const auto comparison = std::memcmp(current_key(lhs), current_key(rhs), key_width);
+    return comparison > 0 || (comparison == 0 && lhs > rhs);
+  };
+  auto queue = std::priority_queue<ChunkID, std::vector<ChunkID>, decltype(merged_after)>{merged_after};
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < runs.size(); ++chunk_id) {
+    if (!runs[chunk_id].sorted_offsets.empty()) queue.push(chunk_id);
+  }
+
+  while (!queue.empty()) {
+    const auto chunk_id = queue.top();
+    queue.pop();
 
-// This class fulfills only the materialization task for a sorted row_id_value_vector.
-template <typename SortColumnType>
-class Sort::SortImplMaterializeOutput {
- public:
-  // creates a new table with reference segments
-  SortImplMaterializeOutput(const std::shared_ptr<const Table>& in,
-                            const std::shared_ptr<std::vector<std::pair<RowID, SortColumnType>>>& id_value_map,
-                            const size_t output_chunk_size)
-      : _table_in(in), _output_chunk_size(output_chunk_size), _row_id_value_vector(id_value_map) {}
+    auto& run_position = run_positions[chunk_id];
+    pos_list.emplace_back(RowID{chunk_id, runs[chunk_id].sorted_offsets[run_position]});
 
-  std::shared_ptr<const Table> execute() {
-    // First we create a new table as the output
-    auto output = std::make_shared<Table>(_table_in->column_definitions(), TableType::Data, _output_chunk_size);
+    ++run_position;
+    if (run_position < runs[chunk_id].sorted_offsets.size()) queue.push(chunk_id);
+  }
+
+  return pos_list;
+}
 
-    // We have decided against duplicating MVCC data in https://github.com/hyrise/hyrise/issues/408
+// Materializes the rows of the input table in the order given by the pos_list into a new table. The columns are
+// materialized in parallel.
+std::shared_ptr<Table> materialize_output(const std::shared_ptr<const Table>& table_in, const PosList& pos_list,
+                                          const size_t output_chunk_size) {
+  // First we create a new table as the output
+  auto output = std::make_shared<Table>(table_in->column_definitions(), TableType::Data, output_chunk_size);
 
-    // After we created the output table and initialized the column structure, we can start adding values. Because the
-    // values are not ordered by input chunks anymore, we can't process them chunk by chunk. Instead the values are
-    // copied column by column for each output row. For each column in a row we visit the input segment with a reference
-    // to the output segment. This enables for the SortImplMaterializeOutput class to ignore the column types during the
-    // copying of the values.
-    const auto row_count_out = _row_id_value_vector->size();
+  // We have decided against duplicating MVCC data in https://github.com/hyrise/hyrise/issues/408
 
-    // Ceiling of integer division
-    const auto div_ceil = [](auto x, auto y) { return (x + y - 1u) / y; };
+  // Because the values are not ordered by input chunks anymore, we can't process them chunk by chunk. Instead the
+  // values are copied column by column for each output row.
+  const auto row_count_out = pos_list.size();
 
-    const auto chunk_count_out = div_ceil(row_count_out, _output_chunk_size);
+  // Ceiling of integer division
+  const auto div_ceil = [](auto x, auto y) { return (x + y - 1u) / y; };
 
-    // Vector of segments for each chunk
-    std::vector<Segments> output_segments_by_chunk(chunk_count_out);
+  const auto chunk_count_out = div_ceil(row_count_out, output_chunk_size);
 
-    // Materialize segment-wise
-    for (ColumnID column_id{0u}; column_id < output->column_count(); ++column_id) {
+  // Output segments of each column, one per output chunk
+  auto segments_by_column = std::vector<std::vector<std::shared_ptr<BaseSegment>>>(output->column_count());
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(output->column_count());
+
+  for (ColumnID column_id{0u}; column_id < output->column_count(); ++column_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, column_id]() {
       const auto column_data_type = output->column_data_type(column_id);
+      auto& output_segments = segments_by_column[column_id];
+      output_segments.reserve(chunk_count_out);
 
       resolve_data_type(column_data_type, [&](auto type) {
         using ColumnDataType = typename decltype(type)::type;
 
-        auto chunk_it = output_segments_by_chunk.begin();
         auto chunk_offset_out = 0u;
 
         auto value_segment_value_vector = pmr_concurrent_vector<ColumnDataType>();
         auto value_segment_null_vector = pmr_concurrent_vector<bool>();
 
-        value_segment_value_vector.reserve(row_count_out);
-        value_segment_null_vector.reserve(row_count_out);
+        value_segment_value_vector.reserve(std::min(row_count_out, output_chunk_size));
+        value_segment_null_vector.reserve(std::min(row_count_out, output_chunk_size));
 
         auto segment_ptr_and_accessor_by_chunk_id =
             std::unordered_map<ChunkID, std::pair<std::shared_ptr<const BaseSegment>,
                                                   std::shared_ptr<AbstractSegmentAccessor<ColumnDataType>>>>();
-        segment_ptr_and_accessor_by_chunk_id.reserve(row_count_out);
-
-        for (auto row_index = 0u; row_index < row_count_out; ++row_index) {
-          const auto [chunk_id, chunk_offset] = _row_id_value_vector->at(row_index).first;
+        segment_ptr_and_accessor_by_chunk_id.reserve(table_in->chunk_count());
 
+        for (const auto& [chunk_id, chunk_offset] : pos_list) {
           auto& segment_ptr_and_typed_ptr_pair = segment_ptr_and_accessor_by_chunk_id[chunk_id];
           auto& base_segment = segment_ptr_and_typed_ptr_pair.first;
           auto& accessor = segment_ptr_and_typed_ptr_pair.second;
 
           if (!base_segment) {
-            base_segment = _table_in->get_chunk(chunk_id)->get_segment(column_id);
+            base_segment = table_in->get_chunk(chunk_id)->get_segment(column_id);
             accessor = create_segment_accessor<ColumnDataType>(base_segment);
           }
 
@@ -124,130 +287,130 @@ class Sort::SortImplMaterializeOutput {
           ++chunk_offset_out;
 
           // Check if value segment is full
-          if (chunk_offset_out >= _output_chunk_size) {
+          if (chunk_offset_out >= output_chunk_size) {
             chunk_offset_out = 0u;
-            auto value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector),
-                                                                                std::move(value_segment_null_vector));
-            chunk_it->push_back(value_segment);
+            output_segments.emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(
+                std::move(value_segment_value_vector), std::move(value_segment_null_vector)));
             value_segment_value_vector = pmr_concurrent_vector<ColumnDataType>();
             value_segment_null_vector = pmr_concurrent_vector<bool>();
-            ++chunk_it;
           }
         }
 
         // Last segment has not been added
         if (chunk_offset_out > 0u) {
-          auto value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector),
-                                                                              std::move(value_segment_null_vector));
-          chunk_it->push_back(value_segment);
+          output_segments.emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(
+              std::move(value_segment_value_vector), std::move(value_segment_null_vector)));
         }
       });
-    }
-
-    for (auto& segments : output_segments_by_chunk) {
-      output->append_chunk(segments);
-    }
-
-    return output;
+    }));
+    jobs.back()->schedule();
   }
 
- protected:
-  const std::shared_ptr<const Table> _table_in;
-  const size_t _output_chunk_size;
-  const std::shared_ptr<std::vector<std::pair<RowID, SortColumnType>>> _row_id_value_vector;
-};
+  CurrentScheduler::wait_for_tasks(jobs);
 
-// we need to use the impl pattern because the scan operator of the sort depends on the type of the column
-template <typename SortColumnType>
-class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
- public:
-  using RowIDValuePair = std::pair<RowID, SortColumnType>;
-
-  SortImpl(const std::shared_ptr<const Table>& table_in, const ColumnID column_id,
-           const OrderByMode order_by_mode = OrderByMode::Ascending, const size_t output_chunk_size = 0)
-      : _table_in(table_in),
-        _column_id(column_id),
-        _order_by_mode(order_by_mode),
-        _output_chunk_size(output_chunk_size) {
-    // initialize a structure which can be sorted by std::sort
-    _row_id_value_vector = std::make_shared<std::vector<RowIDValuePair>>();
-    _null_value_rows = std::make_shared<std::vector<RowIDValuePair>>();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count_out; ++chunk_id) {
+    auto segments = Segments{};
+    for (auto& column_segments : segments_by_column) {
+      segments.emplace_back(std::move(column_segments[chunk_id]));
+    }
+    output->append_chunk(segments);
   }
 
- protected:
-  std::shared_ptr<const Table> _on_execute() override {
-    // 1. Prepare Sort: Creating rowid-value-Structure
-    _materialize_sort_column();
+  return output;
+}
 
-    // 2. After we got our ValueRowID Map we sort the map by the value of the pair
-    if (_order_by_mode == OrderByMode::Ascending || _order_by_mode == OrderByMode::AscendingNullsLast) {
-      _sort_with_operator<std::less<>>();
-    } else {
-      _sort_with_operator<std::greater<>>();
-    }
+}  // namespace
 
-    // 2b. Insert null rows if necessary
-    if (!_null_value_rows->empty()) {
-      if (_order_by_mode == OrderByMode::AscendingNullsLast || _order_by_mode == OrderByMode::DescendingNullsLast) {
-        // NULLs last
-        _row_id_value_vector->insert(_row_id_value_vector->end(), _null_value_rows->begin(), _null_value_rows->end());
-      } else {
-        // NULLs first (default behavior)
-        _row_id_value_vector->insert(_row_id_value_vector->begin(), _null_value_rows->begin(), _null_value_rows->end());
-      }
-    }
+namespace opossum {
 
-    // 3. Materialization of the result: We take the sorted ValueRowID Vector, create chunks fill them until they are
-    // full and create the next one. Each chunk is filled row by row.
-    auto materialization = std::make_shared<SortImplMaterializeOutput<SortColumnType>>(_table_in, _row_id_value_vector,
-                                                                                       _output_chunk_size);
-    auto output = materialization->execute();
-    for (auto& chunk : output->chunks()) {
-      chunk->set_ordered_by(std::make_pair(_column_id, _order_by_mode));
-    }
+Sort::Sort(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id, const OrderByMode order_by_mode,
+           const size_t output_chunk_size)
+    : Sort(in, std::vector<SortColumnDefinition>{SortColumnDefinition{column_id, order_by_mode}}, output_chunk_size) {}
 
-    return output;
-  }
+Sort::Sort(const std::shared_ptr<const AbstractOperator>& in,
+           const std::vector<SortColumnDefinition>& sort_definitions, const size_t output_chunk_size)
+    : AbstractReadOnlyOperator(OperatorType::Sort, in),
+      _sort_definitions(sort_definitions),
+      _output_chunk_size(output_chunk_size) {
+  Assert(!_sort_definitions.empty(), "Expected at least one sort criterion");
+}
 
-  // completely materializes the sort column to create a vector of RowID-Value pairs
-  void _materialize_sort_column() {
-    auto& row_id_value_vector = *_row_id_value_vector;
-    row_id_value_vector.reserve(_table_in->row_count());
+const std::vector<SortColumnDefinition>& Sort::sort_definitions() const { return _sort_definitions; }
 
-    auto& null_value_rows = *_null_value_rows;
+const std::string Sort::name() const { return "Sort"; }
 
-    for (ChunkID chunk_id{0}; chunk_id < _table_in->chunk_count(); ++chunk_id) {
-      auto chunk = _table_in->get_chunk(chunk_id);
+std::shared_ptr<AbstractOperator> Sort::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<Sort>(copied_input_left, _sort_definitions, _output_chunk_size);
+}
 
-      auto base_segment = chunk->get_segment(_column_id);
+void Sort::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
-      segment_iterate<SortColumnType>(*base_segment, [&](const auto& position) {
-        if (position.is_null()) {
-          null_value_rows.emplace_back(RowID{chunk_id, position.chunk_offset()}, SortColumnType{});
-        } else {
-          row_id_value_vector.emplace_back(RowID{chunk_id, position.chunk_offset()}, position.value());
-        }
-      });
+std::shared_ptr<const Table> Sort::_on_execute() {
+  const auto input_table = input_table_left();
+  const auto chunk_count = input_table->chunk_count();
+
+  // 1. Determine the layout of the normalized keys. Each sort column has a NULL byte (if it is nullable), followed by
+  // its value. For string columns, the distinct values are collected and sorted so that each value can be encoded as
+  // its rank.
+  auto key_columns = std::vector<NormalizedKeyColumn>{};
+  auto key_width = size_t{0};
+  for (const auto& sort_definition : _sort_definitions) {
+    auto key_column = NormalizedKeyColumn{};
+    key_column.column_id = sort_definition.column;
+    key_column.data_type = input_table->column_data_type(sort_definition.column);
+    key_column.order_by_mode = sort_definition.order_by_mode;
+    key_column.has_null_byte = input_table->column_is_nullable(sort_definition.column);
+    key_column.offset = key_width;
+    key_column.value_width = normalized_value_width(key_column.data_type);
+
+    if (key_column.data_type == DataType::String) {
+      auto& sorted_strings = key_column.sorted_strings;
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        const auto& segment = *input_table->get_chunk(chunk_id)->get_segment(sort_definition.column);
+        segment_iterate<pmr_string>(segment, [&](const auto& position) {
+          if (!position.is_null()) sorted_strings.emplace_back(position.value());
+        });
+      }
+      std::sort(sorted_strings.begin(), sorted_strings.end());
+      sorted_strings.erase(std::unique(sorted_strings.begin(), sorted_strings.end()), sorted_strings.end());
     }
+
+    key_width += (key_column.has_null_byte ? 1 : 0) + key_column.value_width;
+    key_columns.emplace_back(std::move(key_column));
   }
 
-  template <typename Comparator>
-  void _sort_with_operator() {
-    Comparator comparator;
-    std::stable_sort(_row_id_value_vector->begin(), _row_id_value_vector->end(),
-                     [comparator](RowIDValuePair a, RowIDValuePair b) { return comparator(a.second, b.second); });
+  // 2. Encode and sort each input chunk as a separate run
+  auto runs = std::vector<SortedRun>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      auto& run = runs[chunk_id];
+      encode_keys(*input_table->get_chunk(chunk_id), key_columns, key_width, run.keys);
+      sort_run(key_width, run);
+    }));
+    jobs.back()->schedule();
   }
 
-  const std::shared_ptr<const Table> _table_in;
+  CurrentScheduler::wait_for_tasks(jobs);
 
-  // column to sort by
-  const ColumnID _column_id;
-  const OrderByMode _order_by_mode;
-  // chunk size of the materialized output
-  const size_t _output_chunk_size;
+  // 3. Merge the runs into the final order of the RowIDs. A single run only needs its offsets, which are turned into
+  // RowIDs of the first chunk.
+  const auto pos_list = merge_runs(runs, key_width, input_table->row_count());
+  runs.clear();
 
-  std::shared_ptr<std::vector<RowIDValuePair>> _row_id_value_vector;
-  std::shared_ptr<std::vector<RowIDValuePair>> _null_value_rows;
-};
+  // 4. Materialization of the result: The rows are copied in the merged order, filling one output chunk after another
+  auto output = materialize_output(input_table, pos_list, _output_chunk_size);
+  const auto& first_sort_definition = _sort_definitions.front();
+  for (auto& chunk : output->chunks()) {
+    chunk->set_ordered_by(std::make_pair(first_sort_definition.column, first_sort_definition.order_by_mode));
+  }
+
+  return output;
+}
 
 }  // namespace opossum
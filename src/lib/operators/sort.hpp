@@ -9,15 +9,33 @@
 
 #include "abstract_read_only_operator.hpp"
 #include "resolve_type.hpp"
+#include "storage/chunk.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
 /**
- * Operator to sort a table by a single column. This implements a stable sort, i.e., rows that share the same value will
- * maintain their relative order.
- * Multi-column sort is not supported yet. For now, you will have to sort by the secondary criterion, then by the first
+ * Defines one criterion of a Sort: the column that is sorted by and the direction and NULL placement of the order.
+ */
+struct SortColumnDefinition final {
+  explicit SortColumnDefinition(const ColumnID& column, const OrderByMode order_by_mode = OrderByMode::Ascending)
+      : column(column), order_by_mode(order_by_mode) {}
+
+  const ColumnID column;
+  const OrderByMode order_by_mode;
+};
+
+/**
+ * Operator to sort a table by one or more columns. Rows are ordered by the first SortColumnDefinition, rows that are
+ * equal in it by the second one, and so on. This implements a stable sort, i.e., rows that are equal in all sort
+ * columns will maintain their relative order.
+ *
+ * For each row, the values of the sort columns are encoded into a normalized key, which is a fixed-width byte string
+ * that compares (with memcmp) the same way as the row compares according to the SortColumnDefinitions. NULLs, the
+ * direction of the order, and the encoding of signed and floating-point numbers are taken care of during the encoding.
+ * Strings are encoded as their rank among the distinct strings of the column. The chunks of the input are encoded and
+ * sorted as independent runs in parallel (using a radix sort if the keys are short) and merged afterwards.
  */
 class Sort : public AbstractReadOnlyOperator {
  public:
@@ -25,30 +43,25 @@ class Sort : public AbstractReadOnlyOperator {
   Sort(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id,
        const OrderByMode order_by_mode = OrderByMode::Ascending, const size_t output_chunk_size = Chunk::DEFAULT_SIZE);
 
-  ColumnID column_id() const;
-  OrderByMode order_by_mode() const;
+  Sort(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+       const size_t output_chunk_size = Chunk::DEFAULT_SIZE);
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
 
   const std::string name() const override;
 
+  // Keys of up to this many bytes are sorted with a radix sort, which needs one pass over the run per byte. Longer keys
+  // are sorted with a comparison-based sort.
+  static constexpr auto MAX_RADIX_SORT_KEY_WIDTH = size_t{16};
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
-  void _on_cleanup() override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
 
-  // The operator is separated in three different classes. SortImpl is the common templated implementation of the
-  // operator. SortImpl* und SortImplMaterializeOutput are extra classes for the visitor pattern. They fulfill a certain
-  // task during the Sort process, as described later on.
-  template <typename SortColumnType>
-  class SortImpl;
-  template <typename SortColumnType>
-  class SortImplMaterializeOutput;
-
-  std::unique_ptr<AbstractReadOnlyOperatorImpl> _impl;
-  const ColumnID _column_id;
-  const OrderByMode _order_by_mode;
+  const std::vector<SortColumnDefinition> _sort_definitions;
   const size_t _output_chunk_size;
 };
 
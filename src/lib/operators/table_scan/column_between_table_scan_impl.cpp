@@ -4,6 +4,7 @@
 #include <string>
 #include <type_traits>
 
+#include "column_scan_kernels.hpp"
 #include "expression/between_expression.hpp"
 #include "storage/chunk.hpp"
 #include "storage/create_iterable_from_segment.hpp"
@@ -35,8 +36,11 @@ std::string ColumnBetweenTableScanImpl::description() const { return "ColumnBetw
 void ColumnBetweenTableScanImpl::_scan_non_reference_segment(
     const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
     const std::shared_ptr<const PosList>& position_filter) const {
-  // Select optimized or generic scanning implementation based on segment type
-  if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
+  // Select a specialized kernel, if there is one, or the optimized or generic scanning implementation based on segment
+  // type
+  if (const auto kernel = get_column_scan_kernel(segment, _predicate_condition)) {
+    kernel(segment, _left_value, _right_value, position_filter.get(), chunk_id, matches);
+  } else if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
     _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
   } else {
     _scan_generic_segment(segment, chunk_id, matches, position_filter);
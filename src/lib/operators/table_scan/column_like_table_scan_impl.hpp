@@ -2,7 +2,6 @@
 
 #include <map>
 #include <memory>
-#include <regex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -26,8 +25,8 @@ class Table;
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the segment satisfy the expression.
  *
- * Performance Notes: Uses std::regex as a slow fallback and resorts to much faster Pattern matchers for special cases,
- *                    e.g., StartsWithPattern. 
+ * Performance Notes: Uses the LikeMatcher's GenericPattern as a fallback and resorts to even faster Pattern matchers
+ *                    for special cases, e.g., StartsWithPattern.
  */
 class ColumnLikeTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
  public:
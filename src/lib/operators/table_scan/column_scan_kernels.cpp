@@ -0,0 +1,275 @@
+#include "column_scan_kernels.hpp"
+
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <map>
+#include <tuple>
+#include <utility>
+
+#include "resolve_type.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/base_encoded_segment.hpp"
+#include "storage/encoding_type.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "utils/enum_constant.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+constexpr auto KERNEL_PREDICATE_CONDITIONS = hana::make_tuple(
+    enum_c<PredicateCondition, PredicateCondition::Equals>, enum_c<PredicateCondition, PredicateCondition::LessThan>,
+    enum_c<PredicateCondition, PredicateCondition::LessThanEquals>,
+    enum_c<PredicateCondition, PredicateCondition::GreaterThan>,
+    enum_c<PredicateCondition, PredicateCondition::GreaterThanEquals>,
+    enum_c<PredicateCondition, PredicateCondition::BetweenInclusive>,
+    enum_c<PredicateCondition, PredicateCondition::BetweenLowerExclusive>,
+    enum_c<PredicateCondition, PredicateCondition::BetweenUpperExclusive>,
+    enum_c<PredicateCondition, PredicateCondition::BetweenExclusive>);
+
+constexpr auto KERNEL_DATA_TYPES = hana::tuple_t<int32_t, int64_t, float, double>;
+
+constexpr bool is_between(const PredicateCondition condition) {
+  return condition == PredicateCondition::BetweenInclusive || condition == PredicateCondition::BetweenLowerExclusive ||
+         condition == PredicateCondition::BetweenUpperExclusive || condition == PredicateCondition::BetweenExclusive;
+}
+
+// Non-short-circuiting (&) conjunctions keep the loops free of branches
+template <PredicateCondition condition, typename T>
+bool matches_predicate(const T& value, const T& typed_value, const T& typed_second_value) {
+  if constexpr (condition == PredicateCondition::Equals) return value == typed_value;
+  if constexpr (condition == PredicateCondition::LessThan) return value < typed_value;
+  if constexpr (condition == PredicateCondition::LessThanEquals) return value <= typed_value;
+  if constexpr (condition == PredicateCondition::GreaterThan) return value > typed_value;
+  if constexpr (condition == PredicateCondition::GreaterThanEquals) return value >= typed_value;
+  if constexpr (condition == PredicateCondition::BetweenInclusive) {
+    return (value >= typed_value) & (value <= typed_second_value);
+  }
+  if constexpr (condition == PredicateCondition::BetweenLowerExclusive) {
+    return (value > typed_value) & (value <= typed_second_value);
+  }
+  if constexpr (condition == PredicateCondition::BetweenUpperExclusive) {
+    return (value >= typed_value) & (value < typed_second_value);
+  }
+  if constexpr (condition == PredicateCondition::BetweenExclusive) {
+    return (value > typed_value) & (value < typed_second_value);
+  }
+}
+
+template <PredicateCondition condition, typename T>
+std::pair<T, T> typed_values(const AllTypeVariant& value, const AllTypeVariant& second_value) {
+  if constexpr (is_between(condition)) {
+    return {boost::get<T>(value), boost::get<T>(second_value)};
+  } else {
+    return {boost::get<T>(value), T{}};
+  }
+}
+
+// Calls @param position_matches for the offsets 0 to @param size - 1 (in this order) and writes a RowID for each offset
+// for which it returns true. The RowID is written unconditionally to avoid a branch.
+template <typename PositionMatches>
+void write_matches(const size_t size, const ChunkID chunk_id, PositionMatches position_matches, PosList& matches) {
+  auto match_index = matches.size();
+  matches.resize(match_index + size, RowID{chunk_id, 0});
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+    matches[match_index].chunk_offset = chunk_offset;
+    match_index += static_cast<size_t>(position_matches(chunk_offset));
+  }
+
+  matches.resize(match_index);
+}
+
+template <typename T, PredicateCondition condition>
+void scan_value_segment(const BaseSegment& base_segment, const AllTypeVariant& value,
+                        const AllTypeVariant& second_value, const PosList* position_filter, const ChunkID chunk_id,
+                        PosList& matches) {
+  const auto& segment = static_cast<const ValueSegment<T>&>(base_segment);
+  const auto [typed_value, typed_second_value] = typed_values<condition, T>(value, second_value);
+  const auto& values = segment.values();
+
+  if (position_filter) {
+    const auto& filter = *position_filter;
+    if (segment.is_nullable()) {
+      const auto& null_values = segment.null_values();
+      write_matches(filter.size(), chunk_id, [&](const auto index) {
+        const auto chunk_offset = filter[index].chunk_offset;
+        return !null_values[chunk_offset] &
+               matches_predicate<condition>(values[chunk_offset], typed_value, typed_second_value);
+      }, matches);
+    } else {
+      write_matches(filter.size(), chunk_id, [&](const auto index) {
+        return matches_predicate<condition>(values[filter[index].chunk_offset], typed_value, typed_second_value);
+      }, matches);
+    }
+    return;
+  }
+
+  // pmr_concurrent_vector is not contiguous, so it is accessed through iterators for sequential scans
+  auto value_it = values.cbegin();
+  if (segment.is_nullable()) {
+    auto null_value_it = segment.null_values().cbegin();
+    write_matches(values.size(), chunk_id, [&](const auto) {
+      const auto position_matches =
+          !*null_value_it & matches_predicate<condition>(*value_it, typed_value, typed_second_value);
+      ++value_it;
+      ++null_value_it;
+      return position_matches;
+    }, matches);
+  } else {
+    write_matches(values.size(), chunk_id, [&](const auto) {
+      const auto position_matches = matches_predicate<condition>(*value_it, typed_value, typed_second_value);
+      ++value_it;
+      return position_matches;
+    }, matches);
+  }
+}
+
+// Translates the predicate into the range [lower, upper) of matching value ids. NULL is represented by
+// unique_values_count(), which is never part of the range, so that NULLs do not need to be checked separately.
+template <PredicateCondition condition>
+std::pair<ValueID::base_type, ValueID::base_type> matching_value_id_range(const BaseDictionarySegment& segment,
+                                                                          const AllTypeVariant& value,
+                                                                          const AllTypeVariant& second_value) {
+  const auto unique_values_count = segment.unique_values_count();
+
+  // lower_bound() and upper_bound() return INVALID_VALUE_ID if all values are smaller than the searched value
+  const auto bound = [&](const ValueID value_id) {
+    return value_id == INVALID_VALUE_ID ? unique_values_count : static_cast<ValueID::base_type>(value_id);
+  };
+
+  if constexpr (condition == PredicateCondition::Equals) {
+    return {bound(segment.lower_bound(value)), bound(segment.upper_bound(value))};
+  }
+  if constexpr (condition == PredicateCondition::LessThan) return {0, bound(segment.lower_bound(value))};
+  if constexpr (condition == PredicateCondition::LessThanEquals) return {0, bound(segment.upper_bound(value))};
+  if constexpr (condition == PredicateCondition::GreaterThan) {
+    return {bound(segment.upper_bound(value)), unique_values_count};
+  }
+  if constexpr (condition == PredicateCondition::GreaterThanEquals) {
+    return {bound(segment.lower_bound(value)), unique_values_count};
+  }
+  if constexpr (is_between(condition)) {
+    const auto lower = is_lower_inclusive_between(condition) ? segment.lower_bound(value) : segment.upper_bound(value);
+    const auto upper = is_upper_inclusive_between(condition) ? segment.upper_bound(second_value)
+                                                             : segment.lower_bound(second_value);
+    return {bound(lower), bound(upper)};
+  }
+}
+
+// The attribute vector is independent of the data type, so this kernel is shared by all data types
+template <PredicateCondition condition>
+void scan_dictionary_segment(const BaseSegment& base_segment, const AllTypeVariant& value,
+                             const AllTypeVariant& second_value, const PosList* position_filter,
+                             const ChunkID chunk_id, PosList& matches) {
+  const auto& segment = static_cast<const BaseDictionarySegment&>(base_segment);
+  const auto [lower, upper] = matching_value_id_range<condition>(segment, value, second_value);
+  if (lower >= upper) return;
+
+  // Because the value ids are unsigned, (x >= lower && x < upper) === ((x - lower) < (upper - lower))
+  const auto value_id_diff = upper - lower;
+
+  resolve_compressed_vector_type(*segment.attribute_vector(), [&](const auto& attribute_vector) {
+    if (position_filter) {
+      const auto& filter = *position_filter;
+      auto decompressor = attribute_vector.create_decompressor();
+      write_matches(filter.size(), chunk_id, [&](const auto index) {
+        return decompressor->get(filter[index].chunk_offset) - lower < value_id_diff;
+      }, matches);
+    } else {
+      auto value_id_it = attribute_vector.cbegin();
+      write_matches(attribute_vector.size(), chunk_id, [&](const auto) {
+        const auto position_matches = static_cast<ValueID::base_type>(*value_id_it) - lower < value_id_diff;
+        ++value_id_it;
+        return position_matches;
+      }, matches);
+    }
+  });
+}
+
+template <typename T, PredicateCondition condition>
+void scan_frame_of_reference_segment(const BaseSegment& base_segment, const AllTypeVariant& value,
+                                     const AllTypeVariant& second_value, const PosList* position_filter,
+                                     const ChunkID chunk_id, PosList& matches) {
+  const auto& segment = static_cast<const FrameOfReferenceSegment<T>&>(base_segment);
+  const auto [typed_value, typed_second_value] = typed_values<condition, T>(value, second_value);
+  const auto& block_minima = segment.block_minima();
+  const auto& null_values = segment.null_values();
+  constexpr auto block_size = FrameOfReferenceSegment<T>::block_size;
+
+  resolve_compressed_vector_type(segment.offset_values(), [&](const auto& offset_values) {
+    if (position_filter) {
+      const auto& filter = *position_filter;
+      auto decompressor = offset_values.create_decompressor();
+      write_matches(filter.size(), chunk_id, [&](const auto index) {
+        const auto chunk_offset = filter[index].chunk_offset;
+        const auto decoded_value = static_cast<T>(block_minima[chunk_offset / block_size] +
+                                                  static_cast<T>(decompressor->get(chunk_offset)));
+        return !null_values[chunk_offset] &
+               matches_predicate<condition>(decoded_value, typed_value, typed_second_value);
+      }, matches);
+    } else {
+      auto offset_value_it = offset_values.cbegin();
+      write_matches(offset_values.size(), chunk_id, [&](const auto chunk_offset) {
+        const auto decoded_value =
+            static_cast<T>(block_minima[chunk_offset / block_size] + static_cast<T>(*offset_value_it));
+        ++offset_value_it;
+        return !null_values[chunk_offset] &
+               matches_predicate<condition>(decoded_value, typed_value, typed_second_value);
+      }, matches);
+    }
+  });
+}
+
+using ColumnScanKernelKey = std::tuple<DataType, EncodingType, PredicateCondition>;
+
+const std::map<ColumnScanKernelKey, ColumnScanKernel>& column_scan_kernels() {
+  static const auto kernels = [] {
+    auto kernels = std::map<ColumnScanKernelKey, ColumnScanKernel>{};
+
+    hana::for_each(KERNEL_DATA_TYPES, [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      constexpr auto data_type = data_type_from_type<ColumnDataType>();
+
+      hana::for_each(KERNEL_PREDICATE_CONDITIONS, [&](const auto condition_c) {
+        constexpr auto condition = decltype(condition_c)::value;
+
+        kernels[{data_type, EncodingType::Unencoded, condition}] = &scan_value_segment<ColumnDataType, condition>;
+        kernels[{data_type, EncodingType::Dictionary, condition}] = &scan_dictionary_segment<condition>;
+        if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FrameOfReference>,
+                                                  hana::type_c<ColumnDataType>)) {
+          kernels[{data_type, EncodingType::FrameOfReference, condition}] =
+              &scan_frame_of_reference_segment<ColumnDataType, condition>;
+        }
+      });
+    });
+
+    return kernels;
+  }();
+
+  return kernels;
+}
+
+}  // namespace
+
+namespace opossum {
+
+ColumnScanKernel get_column_scan_kernel(const BaseSegment& segment, const PredicateCondition predicate_condition) {
+  auto encoding_type = EncodingType::Unencoded;
+  if (const auto* encoded_segment = dynamic_cast<const BaseEncodedSegment*>(&segment)) {
+    encoding_type = encoded_segment->encoding_type();
+  } else if (!dynamic_cast<const BaseValueSegment*>(&segment)) {
+    // ReferenceSegments are resolved by the table scan impls
+    return nullptr;
+  }
+
+  const auto& kernels = column_scan_kernels();
+  const auto kernel_it = kernels.find({segment.data_type(), encoding_type, predicate_condition});
+  return kernel_it != kernels.end() ? kernel_it->second : nullptr;
+}
+
+}  // namespace opossum
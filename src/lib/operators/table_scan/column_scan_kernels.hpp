@@ -0,0 +1,34 @@
+#pragma once
+
+#include "all_type_variant.hpp"
+#include "storage/pos_list.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+/**
+ * Specialized kernels for the most common column scans: int, long, float, and double segments that are unencoded,
+ * dictionary-encoded, or frame-of-reference-encoded and that are compared with =, <, <=, >, >=, or BETWEEN.
+ *
+ * Each kernel is instantiated for its data type, encoding, and predicate condition. Thus, its loop over the raw data of
+ * the segment (the values and NULLs, the attribute vector, or the block minima and offsets) contains neither virtual
+ * calls nor a switch over the predicate condition. Matches are written to the PosList without branching on the result
+ * of the comparison: A RowID is written for every row, but the write position only advances if the row matches.
+ *
+ * The kernels are selected at runtime through a dispatch table. Scans that are not covered by a kernel (e.g., on
+ * strings, for != or on run-length-encoded segments) use the iterator-based implementations of the table scan impls.
+ */
+
+// @param second_value is the upper bound of BETWEEN predicates and ignored for all other predicates.
+// @param position_filter, if set, contains the positions to scan. As with the segment iterables, the ChunkOffsets of
+//                         the matches then refer to the index within the position_filter.
+using ColumnScanKernel = void (*)(const BaseSegment& segment, const AllTypeVariant& value,
+                                  const AllTypeVariant& second_value, const PosList* position_filter,
+                                  const ChunkID chunk_id, PosList& matches);
+
+// Returns the kernel for scanning the segment with the predicate condition, or nullptr if there is none
+ColumnScanKernel get_column_scan_kernel(const BaseSegment& segment, const PredicateCondition predicate_condition);
+
+}  // namespace opossum
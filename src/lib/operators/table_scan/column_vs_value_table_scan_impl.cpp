@@ -4,6 +4,7 @@
 #include <utility>
 #include <vector>
 
+#include "column_scan_kernels.hpp"
 #include "sorted_segment_search.hpp"
 #include "storage/base_dictionary_segment.hpp"
 #include "storage/create_iterable_from_segment.hpp"
@@ -34,6 +35,8 @@ void ColumnVsValueTableScanImpl::_scan_non_reference_segment(
   const auto ordered_by = _in_table->get_chunk(chunk_id)->ordered_by();
   if (ordered_by && ordered_by->first == _column_id) {
     _scan_sorted_segment(segment, chunk_id, matches, position_filter, ordered_by->second);
+  } else if (const auto kernel = get_column_scan_kernel(segment, _predicate_condition)) {
+    kernel(segment, _value, NULL_VALUE, position_filter.get(), chunk_id, matches);
   } else {
     // Select optimized or generic scanning implementation based on segment type
     if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
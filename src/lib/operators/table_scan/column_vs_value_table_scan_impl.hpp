@@ -17,6 +17,8 @@ namespace opossum {
 /**
  * @brief Compares one column to a literal (i.e., an AllTypeVariant)
  *
+ * - Common combinations of data type, encoding, and predicate condition are scanned by specialized kernels
+ *   (see column_scan_kernels.hpp)
  * - Value segments are scanned sequentially
  * - For dictionary segments, we basically look up the value ID of the constant value in the dictionary
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
@@ -15,7 +15,7 @@ std::string ExpressionEvaluatorTableScanImpl::description() const { return "Expr
 
 std::shared_ptr<PosList> ExpressionEvaluatorTableScanImpl::scan_chunk(ChunkID chunk_id) const {
   return std::make_shared<PosList>(
-      ExpressionEvaluator{_in_table, chunk_id, _uncorrelated_subquery_results}.evaluate_expression_to_pos_list(
+      ExpressionEvaluator{_in_table, chunk_id, _uncorrelated_subquery_results}.evaluate_expression_to_pos_list_batched(
           *_expression));
 }
 
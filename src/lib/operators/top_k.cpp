@@ -0,0 +1,423 @@
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "expression/expression_utils.hpp"
+#include "limit.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/topology.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+bool nulls_first(const OrderByMode order_by_mode) {
+  return order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::Descending;
+}
+
+bool is_descending(const OrderByMode order_by_mode) {
+  return order_by_mode == OrderByMode::Descending || order_by_mode == OrderByMode::DescendingNullsLast;
+}
+
+/**
+ * The values of one sort column: those of the chunk that a job currently processes and those of the job's candidates,
+ * which are stored in slots. All comparisons return a negative number if the left row comes first in the result, zero
+ * if the rows are equal in this column, and a positive number otherwise.
+ */
+class BaseTopKColumn {
+ public:
+  virtual ~BaseTopKColumn() = default;
+
+  virtual void load_chunk(const Chunk& chunk) = 0;
+
+  virtual int compare_row_with_candidate(const ChunkOffset chunk_offset, const size_t slot) const = 0;
+  virtual int compare_candidates(const size_t slot, const BaseTopKColumn& other, const size_t other_slot) const = 0;
+  virtual int compare_values(const AllTypeVariant& lhs, const AllTypeVariant& rhs) const = 0;
+
+  virtual void store_candidate(const ChunkOffset chunk_offset, const size_t slot) = 0;
+  virtual AllTypeVariant candidate_value(const size_t slot) const = 0;
+};
+
+template <typename ColumnDataType>
+class TopKColumn : public BaseTopKColumn {
+ public:
+  TopKColumn(const ColumnID column_id, const OrderByMode order_by_mode, const size_t k)
+      : _column_id(column_id),
+        _nulls_first(nulls_first(order_by_mode)),
+        _descending(is_descending(order_by_mode)),
+        _candidate_values(k),
+        _candidate_nulls(k) {}
+
+  void load_chunk(const Chunk& chunk) override {
+    _chunk_values.resize(chunk.size());
+    _chunk_nulls.resize(chunk.size());
+
+    segment_iterate<ColumnDataType>(*chunk.get_segment(_column_id), [&](const auto& position) {
+      _chunk_nulls[position.chunk_offset()] = position.is_null();
+      if (!position.is_null()) _chunk_values[position.chunk_offset()] = position.value();
+    });
+  }
+
+  int compare_row_with_candidate(const ChunkOffset chunk_offset, const size_t slot) const override {
+    return _compare(_chunk_values[chunk_offset], _chunk_nulls[chunk_offset], _candidate_values[slot],
+                    _candidate_nulls[slot]);
+  }
+
+  int compare_candidates(const size_t slot, const BaseTopKColumn& other, const size_t other_slot) const override {
+    const auto& typed_other = static_cast<const TopKColumn<ColumnDataType>&>(other);
+    return _compare(_candidate_values[slot], _candidate_nulls[slot], typed_other._candidate_values[other_slot],
+                    typed_other._candidate_nulls[other_slot]);
+  }
+
+  int compare_values(const AllTypeVariant& lhs, const AllTypeVariant& rhs) const override {
+    const auto lhs_is_null = variant_is_null(lhs);
+    const auto rhs_is_null = variant_is_null(rhs);
+    return _compare(lhs_is_null ? ColumnDataType{} : boost::get<ColumnDataType>(lhs), lhs_is_null,
+                    rhs_is_null ? ColumnDataType{} : boost::get<ColumnDataType>(rhs), rhs_is_null);
+  }
+
+  void store_candidate(const ChunkOffset chunk_offset, const size_t slot) override {
+    _candidate_values[slot] = _chunk_values[chunk_offset];
+    _candidate_nulls[slot] = _chunk_nulls[chunk_offset];
+  }
+
+  AllTypeVariant candidate_value(const size_t slot) const override {
+    if (_candidate_nulls[slot]) return NULL_VALUE;
+    return _candidate_values[slot];
+  }
+
+ private:
+  int _compare(const ColumnDataType& lhs, const bool lhs_is_null, const ColumnDataType& rhs,
+               const bool rhs_is_null) const {
+    if (lhs_is_null || rhs_is_null) {
+      if (lhs_is_null == rhs_is_null) return 0;
+      return lhs_is_null == _nulls_first ? -1 : 1;
+    }
+    if (lhs < rhs) return _descending ? 1 : -1;
+    if (rhs < lhs) return _descending ? -1 : 1;
+    return 0;
+  }
+
+  const ColumnID _column_id;
+  const bool _nulls_first;
+  const bool _descending;
+
+  // The values of NULLs are not reset and must not be used
+  std::vector<ColumnDataType> _chunk_values;
+  std::vector<bool> _chunk_nulls;
+
+  std::vector<ColumnDataType> _candidate_values;
+  std::vector<bool> _candidate_nulls;
+};
+
+// The best rows that a job has found so far. The candidates are stored in slots, which are organized in a max-heap so
+// that the worst candidate is at the front.
+struct TopKCandidates {
+  std::vector<std::unique_ptr<BaseTopKColumn>> columns;
+  std::vector<RowID> row_ids;
+  std::vector<size_t> heap;
+
+  // Rows that are equal in all sort columns keep the order of the input
+  int compare(const size_t slot, const TopKCandidates& other, const size_t other_slot) const {
+    for (auto column_index = size_t{0}; column_index < columns.size(); ++column_index) {
+      const auto comparison = columns[column_index]->compare_candidates(slot, *other.columns[column_index], other_slot);
+      if (comparison != 0) return comparison;
+    }
+    return row_ids[slot] < other.row_ids[other_slot] ? -1 : 1;
+  }
+};
+
+void process_chunk(const Chunk& chunk, const ChunkID chunk_id, const size_t k, TopKCandidates& candidates) {
+  auto& columns = candidates.columns;
+
+  // The first sort column is needed for every row. The others are only loaded once a row is equal to a candidate in
+  // all previous sort columns, or once a row becomes a candidate.
+  auto loaded_columns = std::vector<bool>(columns.size());
+  const auto load_column = [&](const size_t column_index) {
+    if (loaded_columns[column_index]) return;
+    columns[column_index]->load_chunk(chunk);
+    loaded_columns[column_index] = true;
+  };
+  load_column(0);
+
+  const auto compare_row_with_candidate = [&](const ChunkOffset chunk_offset, const size_t slot) {
+    for (auto column_index = size_t{0}; column_index < columns.size(); ++column_index) {
+      load_column(column_index);
+      const auto comparison = columns[column_index]->compare_row_with_candidate(chunk_offset, slot);
+      if (comparison != 0) return comparison;
+    }
+    return RowID{chunk_id, chunk_offset} < candidates.row_ids[slot] ? -1 : 1;
+  };
+
+  const auto store_candidate = [&](const ChunkOffset chunk_offset, const size_t slot) {
+    for (auto column_index = size_t{0}; column_index < columns.size(); ++column_index) {
+      load_column(column_index);
+      columns[column_index]->store_candidate(chunk_offset, slot);
+    }
+    candidates.row_ids[slot] = RowID{chunk_id, chunk_offset};
+  };
+
+  auto& heap = candidates.heap;
+  const auto comes_before = [&](const size_t lhs_slot, const size_t rhs_slot) {
+    return candidates.compare(lhs_slot, candidates, rhs_slot) < 0;
+  };
+
+  const auto chunk_size = chunk.size();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+    if (heap.size() < k) {
+      const auto slot = heap.size();
+      store_candidate(chunk_offset, slot);
+      heap.emplace_back(slot);
+      std::push_heap(heap.begin(), heap.end(), comes_before);
+      continue;
+    }
+
+    const auto worst_slot = heap.front();
+    if (compare_row_with_candidate(chunk_offset, worst_slot) > 0) continue;
+
+    std::pop_heap(heap.begin(), heap.end(), comes_before);
+    store_candidate(chunk_offset, worst_slot);
+    std::push_heap(heap.begin(), heap.end(), comes_before);
+  }
+}
+
+// Returns true if the statistics of the chunk show that none of its rows reaches the @param bound in the first sort
+// column, i.e., that no row of the chunk can be part of the result
+bool chunk_can_be_skipped(const Chunk& chunk, const SortColumnDefinition& sort_definition,
+                          const bool column_is_nullable, const AllTypeVariant& bound) {
+  // The statistics do not record NULLs. Thus, we cannot tell if the chunk holds NULLs that come before the bound.
+  if (variant_is_null(bound) || (column_is_nullable && nulls_first(sort_definition.order_by_mode))) return false;
+
+  auto statistics = chunk.statistics();
+  auto column_id = sort_definition.column;
+
+  // Chunks of reference tables have no statistics, but if all rows of a segment stem from a single chunk, the
+  // statistics of that chunk apply to them, too.
+  const auto segment = chunk.get_segment(column_id);
+  if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+    const auto& pos_list = *reference_segment->pos_list();
+    if (pos_list.empty() || !pos_list.references_single_chunk()) return false;
+
+    statistics = reference_segment->referenced_table()->get_chunk(pos_list.front().chunk_id)->statistics();
+    column_id = reference_segment->referenced_column_id();
+  }
+
+  if (!statistics) return false;
+
+  const auto predicate_condition = is_descending(sort_definition.order_by_mode) ? PredicateCondition::GreaterThanEquals
+                                                                                : PredicateCondition::LessThanEquals;
+  return statistics->can_prune(column_id, predicate_condition, bound);
+}
+
+}  // namespace
+
+namespace opossum {
+
+TopK::TopK(const std::shared_ptr<const AbstractOperator>& in,
+           const std::vector<SortColumnDefinition>& sort_definitions,
+           const std::shared_ptr<AbstractExpression>& row_count_expression)
+    : AbstractReadOnlyOperator(OperatorType::TopK, in),
+      _sort_definitions(sort_definitions),
+      _row_count_expression(row_count_expression) {
+  Assert(!_sort_definitions.empty(), "Expected at least one sort criterion");
+}
+
+const std::string TopK::name() const { return "TopK"; }
+
+const std::vector<SortColumnDefinition>& TopK::sort_definitions() const { return _sort_definitions; }
+
+std::shared_ptr<AbstractExpression> TopK::row_count_expression() const { return _row_count_expression; }
+
+std::shared_ptr<AbstractOperator> TopK::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<TopK>(copied_input_left, _sort_definitions, _row_count_expression->deep_copy());
+}
+
+std::shared_ptr<const Table> TopK::_on_execute() {
+  const auto input_table = input_table_left();
+  const auto chunk_count = input_table->chunk_count();
+  const auto k = std::min(Limit::evaluate_row_count(*_row_count_expression), input_table->row_count());
+
+  if (k == 0) {
+    return std::make_shared<Table>(input_table->column_definitions(), TableType::References);
+  }
+
+  // 1. Find the best k rows of each job
+  const auto job_count = std::max(size_t{1}, std::min(static_cast<size_t>(chunk_count), Topology::get().num_cpus()));
+  auto candidates_by_job = std::vector<TopKCandidates>(job_count);
+
+  const auto& first_sort_definition = _sort_definitions.front();
+  const auto first_column_is_nullable = input_table->column_is_nullable(first_sort_definition.column);
+  const auto reverse_chunk_order = is_descending(first_sort_definition.order_by_mode);
+
+  auto next_chunk_index = std::atomic<ChunkID::base_type>{0};
+  auto bound_mutex = std::mutex{};
+  auto bound = std::optional<AllTypeVariant>{};
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(job_count);
+
+  for (auto job_index = size_t{0}; job_index < job_count; ++job_index) {
+    auto& candidates = candidates_by_job[job_index];
+    for (const auto& sort_definition : _sort_definitions) {
+      resolve_data_type(input_table->column_data_type(sort_definition.column), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        candidates.columns.emplace_back(
+            std::make_unique<TopKColumn<ColumnDataType>>(sort_definition.column, sort_definition.order_by_mode, k));
+      });
+    }
+    candidates.row_ids.resize(k);
+    candidates.heap.reserve(k);
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, job_index]() {
+      auto& candidates = candidates_by_job[job_index];
+      auto& first_column = *candidates.columns.front();
+
+      for (auto chunk_index = next_chunk_index++; chunk_index < chunk_count; chunk_index = next_chunk_index++) {
+        const auto chunk_id = ChunkID{reverse_chunk_order ? chunk_count - 1 - chunk_index : chunk_index};
+        const auto chunk = input_table->get_chunk(chunk_id);
+
+        auto current_bound = std::optional<AllTypeVariant>{};
+        {
+          const auto lock = std::lock_guard<std::mutex>{bound_mutex};
+          current_bound = bound;
+        }
+        if (current_bound &&
+            chunk_can_be_skipped(*chunk, first_sort_definition, first_column_is_nullable, *current_bound)) {
+          continue;
+        }
+
+        process_chunk(*chunk, chunk_id, k, candidates);
+
+        // Share the first sort value of the worst candidate if it is tighter than the current bound
+        if (candidates.heap.size() == k) {
+          const auto worst_value = first_column.candidate_value(candidates.heap.front());
+          const auto lock = std::lock_guard<std::mutex>{bound_mutex};
+          if (!bound || first_column.compare_values(worst_value, *bound) < 0) bound = worst_value;
+        }
+      }
+    }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  // 2. Merge the candidates of all jobs and keep the best k of them
+  auto merged_candidates = std::vector<std::pair<size_t, size_t>>{};
+  for (auto job_index = size_t{0}; job_index < job_count; ++job_index) {
+    for (const auto slot : candidates_by_job[job_index].heap) {
+      merged_candidates.emplace_back(job_index, slot);
+    }
+  }
+
+  std::sort(merged_candidates.begin(), merged_candidates.end(), [&](const auto& lhs, const auto& rhs) {
+    return candidates_by_job[lhs.first].compare(lhs.second, candidates_by_job[rhs.first], rhs.second) < 0;
+  });
+  merged_candidates.resize(std::min(merged_candidates.size(), k));
+
+  auto row_ids = std::make_shared<PosList>();
+  row_ids->reserve(merged_candidates.size());
+  for (const auto& [job_index, slot] : merged_candidates) {
+    row_ids->emplace_back(candidates_by_job[job_index].row_ids[slot]);
+  }
+
+  // 3. Build the output, which references either the input table or the tables that the input references
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  const auto add_output_chunk = [&](Segments&& output_segments) {
+    auto output_chunk = std::make_shared<Chunk>(std::move(output_segments));
+    output_chunk->set_ordered_by(std::make_pair(first_sort_definition.column, first_sort_definition.order_by_mode));
+    output_chunks.emplace_back(output_chunk);
+  };
+
+  const auto column_count = input_table->column_count();
+
+  if (input_table->type() == TableType::Data) {
+    auto output_segments = Segments{};
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      output_segments.emplace_back(std::make_shared<ReferenceSegment>(input_table, column_id, row_ids));
+    }
+    add_output_chunk(std::move(output_segments));
+  } else {
+    // The chunks of a reference table can reference different tables, e.g., after a UnionAll. Input chunks that
+    // reference the same table and column in every column form a reference group, represented by its first chunk.
+    // Consecutive output rows of the same group share an output chunk, so that the rows stay in order.
+    const auto chunk_count = input_table->chunk_count();
+    const auto references_same_columns = [&](const Chunk& lhs, const Chunk& rhs) {
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        const auto& lhs_segment = static_cast<const ReferenceSegment&>(*lhs.get_segment(column_id));
+        const auto& rhs_segment = static_cast<const ReferenceSegment&>(*rhs.get_segment(column_id));
+        if (lhs_segment.referenced_table() != rhs_segment.referenced_table() ||
+            lhs_segment.referenced_column_id() != rhs_segment.referenced_column_id()) {
+          return false;
+        }
+      }
+      return true;
+    };
+
+    auto reference_group_by_chunk = std::vector<size_t>(chunk_count);
+    auto reference_group_chunks = std::vector<std::shared_ptr<const Chunk>>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = input_table->get_chunk(chunk_id);
+      auto reference_group = size_t{0};
+      while (reference_group < reference_group_chunks.size() &&
+             !references_same_columns(*chunk, *reference_group_chunks[reference_group])) {
+        ++reference_group;
+      }
+      if (reference_group == reference_group_chunks.size()) reference_group_chunks.emplace_back(chunk);
+      reference_group_by_chunk[chunk_id] = reference_group;
+    }
+
+    for (auto begin = size_t{0}; begin < row_ids->size();) {
+      const auto reference_group = reference_group_by_chunk[(*row_ids)[begin].chunk_id];
+      auto end = begin + 1;
+      while (end < row_ids->size() && reference_group_by_chunk[(*row_ids)[end].chunk_id] == reference_group) ++end;
+
+      auto output_segments = Segments{};
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        auto referenced_row_ids = std::make_shared<PosList>();
+        referenced_row_ids->reserve(end - begin);
+        for (auto row_index = begin; row_index < end; ++row_index) {
+          const auto& row_id = (*row_ids)[row_index];
+          const auto segment = input_table->get_chunk(row_id.chunk_id)->get_segment(column_id);
+          const auto& reference_segment = static_cast<const ReferenceSegment&>(*segment);
+          referenced_row_ids->emplace_back((*reference_segment.pos_list())[row_id.chunk_offset]);
+        }
+
+        const auto& group_segment =
+            static_cast<const ReferenceSegment&>(*reference_group_chunks[reference_group]->get_segment(column_id));
+        output_segments.emplace_back(std::make_shared<ReferenceSegment>(
+            group_segment.referenced_table(), group_segment.referenced_column_id(), referenced_row_ids));
+      }
+      add_output_chunk(std::move(output_segments));
+
+      begin = end;
+    }
+  }
+
+  return std::make_shared<Table>(input_table->column_definitions(), TableType::References, std::move(output_chunks));
+}
+
+void TopK::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  expression_set_parameters(_row_count_expression, parameters);
+}
+
+void TopK::_on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {
+  expression_set_transaction_context(_row_count_expression, transaction_context);
+}
+
+}  // namespace opossum
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "expression/abstract_expression.hpp"
+#include "sort.hpp"
+
+namespace opossum {
+
+/**
+ * Returns the first k rows of its input in the order given by the SortColumnDefinitions, i.e., the same rows as a Sort
+ * followed by a Limit, without sorting the entire input. Rows that are equal in all sort columns are returned in the
+ * order of the input, as with the stable Sort.
+ *
+ * The chunks of the input are distributed over one job per CPU. Each job keeps a bounded max-heap of its best k rows,
+ * and only rows that beat the worst row in the heap are inserted. The heaps are merged once all chunks are processed.
+ *
+ * Whenever a heap is full, the first sort value of its worst row is a bound that every row of the result has to reach
+ * (otherwise, the heap already holds k better rows). The jobs share the tightest of these bounds and skip chunks whose
+ * statistics show that none of their rows reaches it. To establish a tight bound early, chunks are processed from the
+ * last to the first if the first sort column is descending, as the newest rows (e.g., of timestamps or ids) are usually
+ * found at the end of a table.
+ *
+ * The output consists of ReferenceSegments, which point to the tables referenced by the input. If the chunks of the
+ * input reference different tables, the output is split into consecutive chunks that each reference one of them.
+ */
+class TopK : public AbstractReadOnlyOperator {
+ public:
+  TopK(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+       const std::shared_ptr<AbstractExpression>& row_count_expression);
+
+  const std::string name() const override;
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+  std::shared_ptr<AbstractExpression> row_count_expression() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  void _on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) override;
+
+ private:
+  const std::vector<SortColumnDefinition> _sort_definitions;
+  const std::shared_ptr<AbstractExpression> _row_count_expression;
+};
+
+}  // namespace opossum
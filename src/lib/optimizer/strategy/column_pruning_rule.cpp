@@ -1,5 +1,7 @@
 #include "column_pruning_rule.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <unordered_map>
 
 #include "expression/abstract_expression.hpp"
@@ -67,6 +69,7 @@ ExpressionUnorderedSet ColumnPruningRule::_collect_actually_used_columns(const s
       case LQPNodeType::DropView:
       case LQPNodeType::DropTable:
       case LQPNodeType::DummyTable:
+      case LQPNodeType::IntermediateTable:
       case LQPNodeType::Join:
       case LQPNodeType::Limit:
       case LQPNodeType::Predicate:
@@ -124,6 +127,11 @@ void ColumnPruningRule::_prune_columns_from_leaves(const std::shared_ptr<Abstrac
       return LQPVisitation::VisitInputs;
     }
 
+    // Intermediate tables are already materialized, their columns are not necessarily LQPColumnExpressions
+    if (node->type == LQPNodeType::IntermediateTable) {
+      return LQPVisitation::VisitInputs;
+    }
+
     auto pruned_column_ids = std::vector<ColumnID>{};
     for (const auto& expression : node->column_expressions()) {
       if (referenced_columns.find(expression) != referenced_columns.end()) {
@@ -138,10 +146,19 @@ void ColumnPruningRule::_prune_columns_from_leaves(const std::shared_ptr<Abstrac
       pruned_column_ids.pop_back();
     }
 
+    // The LQP might be optimized more than once (e.g., by the adaptive re-optimization). Columns that were pruned
+    // before are not part of the column_expressions() anymore and have to stay pruned.
+    const auto merge_pruned_column_ids = [&](const std::vector<ColumnID>& previously_pruned_column_ids) {
+      auto merged_column_ids = std::vector<ColumnID>{};
+      std::set_union(previously_pruned_column_ids.begin(), previously_pruned_column_ids.end(),
+                     pruned_column_ids.begin(), pruned_column_ids.end(), std::back_inserter(merged_column_ids));
+      return merged_column_ids;
+    };
+
     if (const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node)) {
-      stored_table_node->set_pruned_column_ids(pruned_column_ids);
+      stored_table_node->set_pruned_column_ids(merge_pruned_column_ids(stored_table_node->pruned_column_ids()));
     } else if (const auto mock_node = std::dynamic_pointer_cast<MockNode>(node)) {
-      mock_node->set_pruned_column_ids(pruned_column_ids);
+      mock_node->set_pruned_column_ids(merge_pruned_column_ids(mock_node->pruned_column_ids()));
     } else {
       // We don't know how to prune columns from this leaf-node type (CreateViewNode, etc.), so do nothing
     }
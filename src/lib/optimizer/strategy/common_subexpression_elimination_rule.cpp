@@ -0,0 +1,83 @@
+#include "common_subexpression_elimination_rule.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "expression/expression_utils.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/projection_node.hpp"
+
+namespace opossum {
+
+std::string CommonSubexpressionEliminationRule::name() const { return "Common Subexpression Elimination Rule"; }
+
+void CommonSubexpressionEliminationRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
+  if (node->type != LQPNodeType::Projection) {
+    _apply_to_inputs(node);
+    return;
+  }
+
+  const auto& input_node = node->left_input();
+
+  // Expressions that the input already provides or that do not need to be computed are left as they are. Aggregates
+  // are always provided by the input, and subqueries are not compared in a meaningful way.
+  const auto is_candidate = [&](const auto& expression) {
+    return expression->requires_computation() && expression->type != ExpressionType::Aggregate &&
+           expression->type != ExpressionType::LQPSubquery && !input_node->find_column_id(*expression);
+  };
+
+  // Count the occurrences of the sub-expressions, in the order of their first occurrence. The arguments of a repeated
+  // occurrence are not counted again, as they are computed along with it.
+  auto occurrence_counts = ExpressionUnorderedMap<size_t>{};
+  auto common_subexpressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+
+  for (const auto& expression : node->node_expressions) {
+    visit_expression(expression, [&](const auto& sub_expression) {
+      if (!is_candidate(sub_expression)) return ExpressionVisitation::DoNotVisitArguments;
+
+      const auto occurrence_count = ++occurrence_counts[sub_expression];
+      if (occurrence_count == 2) common_subexpressions.emplace_back(sub_expression);
+
+      return occurrence_count == 1 ? ExpressionVisitation::VisitArguments : ExpressionVisitation::DoNotVisitArguments;
+    });
+  }
+
+  if (common_subexpressions.empty()) {
+    _apply_to_inputs(node);
+    return;
+  }
+
+  // Collect the input columns that are still used by the upper ProjectionNode once the common sub-expressions are
+  // computed below it
+  const auto common_subexpression_set =
+      ExpressionUnorderedSet{common_subexpressions.begin(), common_subexpressions.end()};
+  auto required_input_expressions = ExpressionUnorderedSet{};
+
+  for (const auto& expression : node->node_expressions) {
+    visit_expression(expression, [&](const auto& sub_expression) {
+      if (common_subexpression_set.count(sub_expression)) return ExpressionVisitation::DoNotVisitArguments;
+
+      if (input_node->find_column_id(*sub_expression)) {
+        required_input_expressions.emplace(sub_expression);
+        return ExpressionVisitation::DoNotVisitArguments;
+      }
+
+      return ExpressionVisitation::VisitArguments;
+    });
+  }
+
+  auto lower_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (const auto& input_expression : input_node->column_expressions()) {
+    if (required_input_expressions.count(input_expression)) lower_expressions.emplace_back(input_expression);
+  }
+  lower_expressions.insert(lower_expressions.end(), common_subexpressions.begin(), common_subexpressions.end());
+
+  lqp_insert_node(node, LQPInputSide::Left, ProjectionNode::make(lower_expressions));
+
+  // Continues with the new ProjectionNode, which might contain common sub-expressions itself
+  _apply_to_inputs(node);
+}
+
+}  // namespace opossum
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * Computes sub-expressions that occur more than once in the expressions of a ProjectionNode only once, by inserting
+ * a ProjectionNode below it that computes them. The LQPTranslator then resolves the occurrences in the upper
+ * ProjectionNode to the columns of the lower one.
+ *
+ * E.g., the pre-aggregate projection of TPC-H Q1
+ *   [l_extendedprice * (1 - l_discount), l_extendedprice * (1 - l_discount) * (1 + l_tax)]
+ * is turned into
+ *   [l_extendedprice * (1 - l_discount), l_extendedprice * (1 - l_discount) * (1 + l_tax)]
+ *     -> [l_tax, l_extendedprice * (1 - l_discount)]
+ *
+ * The lower ProjectionNode only forwards the input columns the upper one still needs. Common sub-expressions nested in
+ * other common sub-expressions are extracted into a further ProjectionNode when the rule is applied to the new node.
+ */
+class CommonSubexpressionEliminationRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
+};
+
+}  // namespace opossum
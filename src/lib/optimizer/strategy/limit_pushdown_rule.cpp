@@ -0,0 +1,34 @@
+#include "limit_pushdown_rule.hpp"
+
+#include <vector>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+
+namespace opossum {
+
+std::string LimitPushdownRule::name() const { return "LimitPushdown"; }
+
+void LimitPushdownRule::apply_to(const std::shared_ptr<AbstractLQPNode>& root) const {
+  Assert(root->type == LQPNodeType::Root, "LimitPushdownRule needs root to hold onto");
+
+  // Collect the LimitNodes first, as manipulating the LQP within visit_lqp() is prone to bugs
+  auto limit_nodes = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+  visit_lqp(root, [&](const auto& node) {
+    if (node->type == LQPNodeType::Limit) limit_nodes.emplace_back(node);
+    return LQPVisitation::VisitInputs;
+  });
+
+  for (const auto& limit_node : limit_nodes) {
+    while (true) {
+      const auto input_node = limit_node->left_input();
+      if (input_node->type != LQPNodeType::Projection && input_node->type != LQPNodeType::Alias) break;
+      if (input_node->output_count() > 1) break;
+
+      lqp_remove_node(limit_node);
+      lqp_insert_node(input_node, LQPInputSide::Left, limit_node);
+    }
+  }
+}
+
+}  // namespace opossum
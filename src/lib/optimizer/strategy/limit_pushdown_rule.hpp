@@ -0,0 +1,30 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+/**
+ * This rule pushes LimitNodes below ProjectionNodes and AliasNodes, which neither add nor remove rows.
+ *
+ * The Projection operator evaluates its expressions for all rows of its input. Below a Limit, this is wasted for all
+ * rows the Limit drops. Once the LimitNode is below the ProjectionNode, only the rows within the limit are evaluated.
+ *
+ * EXAMPLE: `SELECT a * 2, b + c, ... FROM t LIMIT 10` computes the projected columns for 10 rows instead of all rows
+ *          of t.
+ *
+ * Nodes with multiple outputs are left in place, as the other outputs need all rows.
+ *
+ * As the SortNode of an ORDER BY is usually below the ProjectionNodes, this also places the LimitNode directly on top
+ * of it, which the LQPTranslator turns into a TopK operator.
+ */
+class LimitPushdownRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override;
+};
+
+}  // namespace opossum
@@ -2,6 +2,9 @@
 
 #include <boost/asio.hpp>
 
+#include <algorithm>
+#include <array>
+
 #include "postgres_wire_handler.hpp"
 #include "then_operator.hpp"
 #include "use_boost_future.hpp"
@@ -65,6 +68,23 @@ boost::future<std::string> ClientConnection::receive_execute_packet_body(uint32_
   return _receive_bytes_async(size) >> then >> PostgresWireHandler::handle_execute_packet;
 }
 
+boost::future<std::string> ClientConnection::receive_copy_data_packet_body(uint32_t size) {
+  return _receive_bytes_async(size) >> then >> PostgresWireHandler::handle_copy_data_packet;
+}
+
+boost::future<void> ClientConnection::receive_copy_done_packet_body(uint32_t size) {
+  // Packet has no content, we'll make the receive call anyways, just in case size > 0
+  return _receive_bytes_async(size) >> then >> [](InputPacket packet) {};
+}
+
+boost::future<std::string> ClientConnection::receive_copy_fail_packet_body(uint32_t size) {
+  return _receive_bytes_async(size) >> then >> PostgresWireHandler::handle_copy_fail_packet;
+}
+
+boost::future<void> ClientConnection::skip_packet_body(uint32_t size) {
+  return _receive_bytes_async(size) >> then >> [](InputPacket packet) {};
+}
+
 boost::future<void> ClientConnection::send_ssl_denied() {
   // Don't use new_output_packet here, because this packet has special size requirements (only contains N, no size)
   auto output_packet = std::make_shared<OutputPacket>();
@@ -168,71 +188,86 @@ boost::future<void> ClientConnection::send_row_description(const std::vector<Col
     PostgresWireHandler::write_value(*output_packet,
                                      htons(static_cast<uint16_t>(column_description.type_width)));  // regular int
     PostgresWireHandler::write_value(*output_packet, htonl(-1));                                    // no modifier
-    PostgresWireHandler::write_value(*output_packet, htons(0u));                                    // text format
+    PostgresWireHandler::write_value(*output_packet,
+                                     htons(static_cast<uint16_t>(column_description.format)));  // text or binary
   }
 
   return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
 }
 
-boost::future<void> ClientConnection::send_data_row(const std::vector<std::string>& row_strings) {
-  auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::DataRow);
-
-  /*
-  DataRow (B)
-  Byte1('D')
-  Identifies the message as a data row.
+boost::future<void> ClientConnection::send_data_rows(const std::shared_ptr<OutputPacket>& data_rows) {
+  // The packet can be much larger than _max_response_size. Instead of copying it into the response buffer, both are
+  // sent with a single scatter-gather write, so that the messages buffered so far (e.g., the RowDescription) are not
+  // delayed by an additional flush.
+  const auto buffers = std::array<boost::asio::const_buffer, 2>{boost::asio::buffer(_response_buffer),
+                                                                boost::asio::buffer(data_rows->data)};
+  const auto total_size = _response_buffer.size() + data_rows->data.size();
 
-  Int32
-  Length of message contents in bytes, including self.
-
-  Int16
-  The number of column values that follow (possibly zero).
-
-  Next, the following pair of fields appear for each column:
-
-  Int32
-  The length of the column value, in bytes (this count does not include itself). Can be zero. As a special case,
-  -1 indicates a NULL column value. No value bytes follow in the NULL case.
+  // We need a copy of this client connection and of the packet to outlive the async operation
+  auto self = shared_from_this();
+  return boost::asio::async_write(_socket, buffers, boost::asio::use_boost_future) >> then >>
+         [this, self, data_rows, total_size](uint64_t sent_bytes) {
+           // If this fails, the connection may be closed but the server will keep running.
+           Assert(sent_bytes == total_size, "Could not send all data");
+           _response_buffer.clear();
+         };
+}
 
-  Byte n
-  The value of the column, in the format indicated by the associated format code. n is the above length.
-  */
+boost::future<void> ClientConnection::send_command_complete(const std::string& message) {
+  auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::CommandComplete);
+  PostgresWireHandler::write_string(*output_packet, message);
 
-  // Number of columns in row
-  PostgresWireHandler::write_value(*output_packet, htons(static_cast<uint16_t>(row_strings.size())));
+  return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
+}
 
-  for (const auto& value_string : row_strings) {
-    // Size of string representation of value, NOT of value type's size
-    PostgresWireHandler::write_value(*output_packet, htonl(static_cast<uint32_t>(value_string.length())));
+boost::future<void> ClientConnection::send_copy_in_response(const CopyFormat format, const size_t column_count) {
+  auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::CopyInResponse);
 
-    // Text mode means that all values are sent as non-terminated strings
-    PostgresWireHandler::write_string(*output_packet, value_string, false);
+  // Int8 overall format (0 = text, 1 = binary), Int16 number of columns, and Int16 format code of each column. CSV is
+  // a textual format as well.
+  const auto format_code = static_cast<uint16_t>(format == CopyFormat::Binary ? 1 : 0);
+  PostgresWireHandler::write_value(*output_packet, static_cast<char>(format_code));
+  PostgresWireHandler::write_value(*output_packet, htons(static_cast<uint16_t>(column_count)));
+  for (auto column_id = size_t{0}; column_id < column_count; ++column_id) {
+    PostgresWireHandler::write_value(*output_packet, htons(format_code));
   }
 
-  return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
+  // The client waits for this message before it sends the data
+  return _send_bytes_async(output_packet, true) >> then >> ignore_sent_bytes;
 }
 
-boost::future<void> ClientConnection::send_command_complete(const std::string& message) {
-  auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::CommandComplete);
-  PostgresWireHandler::write_string(*output_packet, message);
+boost::future<void> ClientConnection::flush() {
+  if (_response_buffer.empty()) return boost::make_ready_future();
 
-  return _send_bytes_async(output_packet, true) >> then >> ignore_sent_bytes;
+  return _flush_async() >> then >> ignore_sent_bytes;
 }
 
 boost::future<InputPacket> ClientConnection::_receive_bytes_async(size_t size) {
-  auto result = std::make_shared<InputPacket>();
-  result->data.resize(size);
+  const auto buffered_size = _receive_buffer.size() - _receive_buffer_offset;
+  if (buffered_size >= size) {
+    auto result = InputPacket{};
+    const auto begin = _receive_buffer.cbegin() + _receive_buffer_offset;
+    result.data.assign(begin, begin + size);
+    result.offset = result.data.begin();
+    _receive_buffer_offset += size;
+    return boost::make_ready_future(std::move(result));
+  }
+
+  // Keep the bytes that have not been consumed yet and read at least the missing ones. If the client has already sent
+  // more (e.g., the following messages), these are read as well, up to MIN_RECEIVE_SIZE bytes in total.
+  _receive_buffer.erase(_receive_buffer.begin(), _receive_buffer.begin() + _receive_buffer_offset);
+  _receive_buffer_offset = 0;
+  const auto missing_size = size - buffered_size;
+  const auto read_size = std::max(missing_size, MIN_RECEIVE_SIZE - std::min(buffered_size, MIN_RECEIVE_SIZE));
+  _receive_buffer.resize(buffered_size + read_size);
 
   // We need a copy of this client connection to outlive the async operation
   auto self = shared_from_this();
-  return _socket.async_read_some(boost::asio::buffer(result->data, size), boost::asio::use_boost_future) >> then >>
-         [self, result, size](uint64_t received_size) {
-           // If this assertion should fail, we will end up in either the error handler for the current command or
-           // the entire session. The connection may be closed but the server will keep running either way.
-           Assert(received_size == size, "Client sent less data than expected.");
-
-           result->offset = result->data.begin();
-           return std::move(*result);
+  return boost::asio::async_read(_socket, boost::asio::buffer(_receive_buffer.data() + buffered_size, read_size),
+                                 boost::asio::transfer_at_least(missing_size), boost::asio::use_boost_future) >>
+         then >> [this, self, buffered_size, size](uint64_t received_size) {
+           _receive_buffer.resize(buffered_size + received_size);
+           return _receive_bytes_async(size);
          };
 }
 
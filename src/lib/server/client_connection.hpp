@@ -14,11 +14,14 @@ struct RequestHeader;
 struct ParsePacket;
 struct BindPacket;
 enum class NetworkMessageType : unsigned char;
+enum class ResultFormat : int16_t;
+enum class CopyFormat;
 
 struct ColumnDescription {
   std::string column_name;
   uint64_t object_id;
   int64_t type_width;
+  ResultFormat format;
 };
 
 // This class provides a wrapper over the TCP socket and (de)serializes
@@ -39,6 +42,11 @@ class ClientConnection : public std::enable_shared_from_this<ClientConnection> {
   boost::future<void> receive_sync_packet_body(uint32_t size);
   boost::future<void> receive_flush_packet_body(uint32_t size);
   boost::future<std::string> receive_execute_packet_body(uint32_t size);
+  boost::future<std::string> receive_copy_data_packet_body(uint32_t size);
+  boost::future<void> receive_copy_done_packet_body(uint32_t size);
+  boost::future<std::string> receive_copy_fail_packet_body(uint32_t size);
+  // Used for messages that are discarded after an error in the extended query protocol
+  boost::future<void> skip_packet_body(uint32_t size);
 
   boost::future<void> send_ssl_denied();
   boost::future<void> send_auth();
@@ -48,8 +56,15 @@ class ClientConnection : public std::enable_shared_from_this<ClientConnection> {
   boost::future<void> send_notice(const std::string& notice);
   boost::future<void> send_status_message(const NetworkMessageType& type);
   boost::future<void> send_row_description(const std::vector<ColumnDescription>& row_description);
-  boost::future<void> send_data_row(const std::vector<std::string>& row_strings);
+  // Sends a packet of consecutive DataRow messages as built by QueryResponseBuilder::build_data_rows
+  boost::future<void> send_data_rows(const std::shared_ptr<OutputPacket>& data_rows);
   boost::future<void> send_command_complete(const std::string& message);
+  // Asks the client to send the data of a COPY ... FROM STDIN
+  boost::future<void> send_copy_in_response(CopyFormat format, size_t column_count);
+
+  // Sends the buffered messages right away. Most messages are only buffered until a ReadyForQuery or an error is
+  // sent, so that the responses to pipelined messages of the extended query protocol are sent together.
+  boost::future<void> flush();
 
  protected:
   boost::future<InputPacket> _receive_bytes_async(size_t size);
@@ -59,6 +74,12 @@ class ClientConnection : public std::enable_shared_from_this<ClientConnection> {
 
   boost::asio::ip::tcp::socket _socket;
 
+  // Received bytes that have not been consumed yet. Messages that the client sends in one go (e.g., pipelined
+  // Parse/Bind/Execute/Sync messages) are received with a single read and then consumed from this buffer.
+  ByteBuffer _receive_buffer;
+  size_t _receive_buffer_offset = 0;
+  static constexpr auto MIN_RECEIVE_SIZE = size_t{8 * 1024};
+
   // Max 2048 bytes per IP packet sent
   uint32_t _max_response_size = 2048;
   ByteBuffer _response_buffer;
@@ -0,0 +1,413 @@
+#include "copy_data_parser.hpp"
+
+#include <algorithm>
+#include <charconv>  // NOLINT - cpplint does not know this C++17 header
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The binary format starts with this signature, followed by an Int32 of flags and the Int32 length of an extension
+constexpr auto BINARY_SIGNATURE = std::string_view{"PGCOPY\n\377\r\n\0", 11};
+constexpr auto BINARY_HEADER_SIZE = BINARY_SIGNATURE.size() + 2 * sizeof(uint32_t);
+
+template <typename T>
+T read_big_endian(const char* source) {
+  static_assert(std::is_unsigned_v<T>, "Expected the unsigned representation of the value");
+  auto value = T{0};
+  for (auto byte_index = size_t{0}; byte_index < sizeof(T); ++byte_index) {
+    value = static_cast<T>((value << 8) | static_cast<unsigned char>(source[byte_index]));
+  }
+  return value;
+}
+
+int16_t read_int16(const std::string_view data, const size_t position) {
+  return static_cast<int16_t>(read_big_endian<uint16_t>(data.data() + position));
+}
+
+int32_t read_int32(const std::string_view data, const size_t position) {
+  return static_cast<int32_t>(read_big_endian<uint32_t>(data.data() + position));
+}
+
+// Converts the values of a column, either from their text representation or from their binary format, and builds a
+// ValueSegment from them. Similar to the CsvConverter, but the rows are appended in order.
+class BaseCopyValueConverter {
+ public:
+  virtual ~BaseCopyValueConverter() = default;
+
+  virtual void append_text(const std::string& value) = 0;
+  virtual void append_binary(std::string_view value) = 0;
+  virtual void append_null() = 0;
+
+  virtual std::shared_ptr<BaseSegment> finish() = 0;
+};
+
+template <typename T>
+class CopyValueConverter : public BaseCopyValueConverter {
+ public:
+  explicit CopyValueConverter(const TableColumnDefinition& column_definition)
+      : _column_name(column_definition.name), _is_nullable(column_definition.nullable) {}
+
+  void append_text(const std::string& value) override {
+    // clang-format off
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      _values.push_back(pmr_string{value});
+    } else if constexpr (std::is_integral_v<T>) {  // NOLINT - doesn't like else if constexpr
+      auto converted = T{};
+      const auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), converted);
+      AssertInput(error == std::errc{} && end == value.data() + value.size(), _invalid_value_message(value));
+      _values.push_back(converted);
+    } else {  // NOLINT
+      // clang-format on
+      // Not all of our compilers support std::from_chars for floating point numbers
+      auto end = static_cast<char*>(nullptr);
+      const auto converted =
+          std::is_same_v<T, float> ? std::strtof(value.c_str(), &end) : std::strtod(value.c_str(), &end);
+      AssertInput(!value.empty() && end == value.c_str() + value.size(), _invalid_value_message(value));
+      _values.push_back(static_cast<T>(converted));
+    }
+    _null_values.push_back(false);
+  }
+
+  void append_binary(const std::string_view value) override {
+    // clang-format off
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      _values.push_back(pmr_string{value.data(), value.size()});
+    } else {  // NOLINT
+      // clang-format on
+      using UnsignedType = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+      static_assert(sizeof(T) == sizeof(UnsignedType), "Unexpected size of data type");
+
+      AssertInput(value.size() == sizeof(T), "Expected a binary value of " + std::to_string(sizeof(T)) +
+                                                 " bytes for column " + _column_name + ", got " +
+                                                 std::to_string(value.size()) + " bytes");
+      const auto unsigned_value = read_big_endian<UnsignedType>(value.data());
+      auto converted = T{};
+      std::memcpy(&converted, &unsigned_value, sizeof(converted));
+      _values.push_back(converted);
+    }
+    _null_values.push_back(false);
+  }
+
+  void append_null() override {
+    AssertInput(_is_nullable, "Column " + _column_name + " is not nullable");
+    _values.push_back(T{});
+    _null_values.push_back(true);
+  }
+
+  std::shared_ptr<BaseSegment> finish() override {
+    if (_is_nullable) {
+      return std::make_shared<ValueSegment<T>>(std::move(_values), std::move(_null_values));
+    } else {
+      return std::make_shared<ValueSegment<T>>(std::move(_values));
+    }
+  }
+
+ private:
+  std::string _invalid_value_message(const std::string& value) const {
+    return "Invalid value '" + value + "' for column " + _column_name;
+  }
+
+  const std::string _column_name;
+  const bool _is_nullable;
+
+  pmr_concurrent_vector<T> _values;
+  pmr_concurrent_vector<bool> _null_values;
+};
+
+char unescape_text_character(const char character) {
+  switch (character) {
+    case 'b':
+      return '\b';
+    case 'f':
+      return '\f';
+    case 'n':
+      return '\n';
+    case 'r':
+      return '\r';
+    case 't':
+      return '\t';
+    case 'v':
+      return '\v';
+    default:
+      // Any other character, including the backslash and the delimiter, stands for itself
+      return character;
+  }
+}
+
+// Parses the rows of the text or the CSV format. The rows are complete, i.e., each one ends with a linebreak.
+void parse_text_rows(const std::string_view batch, const CopyFormat format,
+                     std::vector<std::unique_ptr<BaseCopyValueConverter>>& converters) {
+  const auto is_csv = format == CopyFormat::Csv;
+  const auto separator = is_csv ? ',' : '\t';
+  const auto column_count = converters.size();
+
+  auto position = size_t{0};
+  auto field = std::string{};
+  while (position < batch.size()) {
+    // Older clients mark the end of the data with this line
+    if (batch.compare(position, 3, "\\.\n") == 0 || batch.compare(position, 4, "\\.\r\n") == 0) {
+      position = batch.find('\n', position) + 1;
+      continue;
+    }
+
+    for (auto column_id = size_t{0}; column_id < column_count; ++column_id) {
+      const auto field_begin = position;
+      auto is_quoted = false;
+      auto in_quotes = false;
+      field.clear();
+
+      while (true) {
+        const auto character = batch[position];
+        if (in_quotes) {
+          // In CSV, a quote within a quoted field is escaped by another quote
+          if (character == '"') {
+            if (position + 1 < batch.size() && batch[position + 1] == '"') {
+              field.push_back('"');
+              ++position;
+            } else {
+              in_quotes = false;
+            }
+          } else {
+            field.push_back(character);
+          }
+        } else if (character == separator || character == '\n') {
+          break;
+        } else if (character == '\r' && position + 1 < batch.size() && batch[position + 1] == '\n') {
+          // Rows may also end with \r\n
+          break;
+        } else if (is_csv && character == '"') {
+          is_quoted = true;
+          in_quotes = true;
+        } else if (!is_csv && character == '\\') {
+          ++position;
+          field.push_back(unescape_text_character(batch[position]));
+        } else {
+          field.push_back(character);
+        }
+        ++position;
+      }
+
+      // In CSV, only an unquoted empty field is NULL. In the text format, NULL is \N, while an escaped \\N is a string.
+      const auto is_null =
+          is_csv ? !is_quoted && field.empty() : batch.substr(field_begin, position - field_begin) == "\\N";
+      if (is_null) {
+        converters[column_id]->append_null();
+      } else {
+        converters[column_id]->append_text(field);
+      }
+
+      if (batch[position] == '\r') ++position;
+
+      const auto is_last_column = column_id + 1 == column_count;
+      AssertInput((batch[position] == '\n') == is_last_column,
+                  "Expected rows of " + std::to_string(column_count) + " fields in COPY data");
+      ++position;
+    }
+  }
+}
+
+// Parses the rows of the binary format, which may end with the trailer
+void parse_binary_rows(const std::string_view batch, std::vector<std::unique_ptr<BaseCopyValueConverter>>& converters) {
+  auto position = size_t{0};
+  while (position < batch.size()) {
+    const auto field_count = read_int16(batch, position);
+    position += sizeof(int16_t);
+    if (field_count == -1) break;
+
+    for (auto column_id = size_t{0}; column_id < converters.size(); ++column_id) {
+      const auto value_size = read_int32(batch, position);
+      position += sizeof(int32_t);
+      if (value_size == -1) {
+        converters[column_id]->append_null();
+      } else {
+        converters[column_id]->append_binary(batch.substr(position, value_size));
+        position += value_size;
+      }
+    }
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+CopyDataParser::CopyDataParser(const TableColumnDefinitions& column_definitions, const CopyFormat format,
+                               const ChunkOffset batch_row_count)
+    : _column_definitions(column_definitions), _format(format), _batch_row_count(batch_row_count) {
+  Assert(_batch_row_count > 0, "Expected batches of at least one row");
+}
+
+void CopyDataParser::append(const std::string_view data) {
+  AssertInput(!_trailer_found || data.empty(), "Received COPY data after the end of the binary data");
+
+  // Drop the batches that have already been returned, so that only the rows that are not complete yet or that have
+  // not been returned remain in the buffer
+  if (_taken_size > 0) {
+    _buffer.erase(0, _taken_size);
+    _rows_end -= _taken_size;
+    _search_position -= _taken_size;
+    _taken_size = 0;
+  }
+
+  _buffer.append(data);
+}
+
+std::optional<std::string> CopyDataParser::next_batch() {
+  _find_rows();
+  if (_row_count < _batch_row_count) return std::nullopt;
+
+  return _take_rows();
+}
+
+std::string CopyDataParser::finish() {
+  _find_rows();
+  Assert(_row_count < _batch_row_count, "Expected all complete batches to be taken before");
+
+  if (_format == CopyFormat::Binary) {
+    AssertInput(_trailer_found, "Binary COPY data ended without trailer");
+  } else {
+    // The last row does not need to end with a linebreak
+    if (_rows_end < _buffer.size()) {
+      _buffer.push_back('\n');
+      _find_rows();
+    }
+    AssertInput(_rows_end == _buffer.size(), "COPY data ended within a row");
+  }
+
+  return _take_rows();
+}
+
+Segments CopyDataParser::parse_batch(const std::string_view batch) const {
+  auto converters = std::vector<std::unique_ptr<BaseCopyValueConverter>>{};
+  for (const auto& column_definition : _column_definitions) {
+    converters.emplace_back(make_unique_by_data_type<BaseCopyValueConverter, CopyValueConverter>(
+        column_definition.data_type, column_definition));
+  }
+
+  if (_format == CopyFormat::Binary) {
+    parse_binary_rows(batch, converters);
+  } else {
+    parse_text_rows(batch, _format, converters);
+  }
+
+  auto segments = Segments{};
+  for (auto& converter : converters) {
+    segments.push_back(converter->finish());
+  }
+  return segments;
+}
+
+void CopyDataParser::_find_rows() {
+  if (_format == CopyFormat::Binary) {
+    _find_binary_rows();
+  } else {
+    _find_text_rows();
+  }
+}
+
+void CopyDataParser::_find_text_rows() {
+  // Only linebreaks that are neither escaped (text) nor quoted (CSV) end a row
+  const auto special_characters = _format == CopyFormat::Csv ? std::string{"\"\n"} : std::string{"\\\n"};
+
+  while (_row_count < _batch_row_count) {
+    const auto position = _buffer.find_first_of(special_characters, _search_position);
+    if (position == std::string::npos) {
+      _search_position = _buffer.size();
+      return;
+    }
+
+    switch (_buffer[position]) {
+      case '\\':
+        // If the escaped character has not been received yet, the search continues at the backslash
+        if (position + 1 == _buffer.size()) {
+          _search_position = position;
+          return;
+        }
+        _search_position = position + 2;
+        break;
+
+      case '"':
+        // An escaped quote ("") toggles twice
+        _in_quotes = !_in_quotes;
+        _search_position = position + 1;
+        break;
+
+      default:
+        _search_position = position + 1;
+        if (!_in_quotes) {
+          _rows_end = _search_position;
+          ++_row_count;
+        }
+    }
+  }
+}
+
+void CopyDataParser::_find_binary_rows() {
+  const auto data = std::string_view{_buffer};
+
+  if (!_header_found) {
+    if (data.size() < BINARY_HEADER_SIZE) return;
+    AssertInput(data.substr(0, BINARY_SIGNATURE.size()) == BINARY_SIGNATURE, "Invalid signature of binary COPY data");
+
+    const auto extension_size = read_int32(data, BINARY_HEADER_SIZE - sizeof(int32_t));
+    AssertInput(extension_size >= 0, "Invalid header extension of binary COPY data");
+    if (data.size() < BINARY_HEADER_SIZE + static_cast<size_t>(extension_size)) return;
+
+    // The header is not part of any batch
+    _header_found = true;
+    _taken_size = BINARY_HEADER_SIZE + extension_size;
+    _rows_end = _taken_size;
+    _search_position = _taken_size;
+  }
+
+  // Each row starts with its Int16 number of fields, a number of -1 marks the trailer. Each field consists of the Int32
+  // length of the value and the value.
+  while (_row_count < _batch_row_count && !_trailer_found) {
+    auto position = _rows_end;
+    if (data.size() < position + sizeof(int16_t)) return;
+
+    const auto field_count = read_int16(data, position);
+    position += sizeof(int16_t);
+    if (field_count == -1) {
+      _trailer_found = true;
+      _rows_end = position;
+      AssertInput(_rows_end == data.size(), "Received COPY data after the end of the binary data");
+      return;
+    }
+    AssertInput(static_cast<size_t>(field_count) == _column_definitions.size(),
+                "Expected rows of " + std::to_string(_column_definitions.size()) + " fields in binary COPY data");
+
+    for (auto field_index = int16_t{0}; field_index < field_count; ++field_index) {
+      if (data.size() < position + sizeof(int32_t)) return;
+      const auto value_size = read_int32(data, position);
+      AssertInput(value_size >= -1, "Invalid length of a value in binary COPY data");
+      position += sizeof(int32_t) + std::max(value_size, 0);
+    }
+    if (data.size() < position) return;
+
+    _rows_end = position;
+    _search_position = position;
+    ++_row_count;
+  }
+}
+
+std::string CopyDataParser::_take_rows() {
+  auto rows = _buffer.substr(_taken_size, _rows_end - _taken_size);
+  _taken_size = _rows_end;
+  _row_count = 0;
+  return rows;
+}
+
+}  // namespace opossum
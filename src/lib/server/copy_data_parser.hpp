@@ -0,0 +1,72 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "storage/chunk.hpp"
+#include "storage/table_column_definition.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Parses the data of a COPY ... FROM STDIN. The client sends the data in CopyData messages whose boundaries need not
+ * be aligned with the rows. The parser buffers the data and cuts it into batches of complete rows, which are then
+ * parsed independently of each other. This way, the server can parse batches in parallel while the client is still
+ * sending.
+ *
+ * The formats are those of PostgreSQL (https://www.postgresql.org/docs/current/static/sql-copy.html):
+ *  - Text: Tab-separated fields with backslash escapes, \N is NULL
+ *  - Csv: Comma-separated fields as in RFC 4180 (see CsvParser), an unquoted empty field is NULL
+ *  - Binary: A header followed by the rows, each value in network byte order with its length (-1 for NULL), and a
+ *            trailer. The values are encoded as in the binary result format, see QueryResponseBuilder.
+ */
+class CopyDataParser {
+ public:
+  CopyDataParser(const TableColumnDefinitions& column_definitions, CopyFormat format, ChunkOffset batch_row_count);
+
+  // Appends the content of a CopyData message
+  void append(std::string_view data);
+
+  // Returns a batch of batch_row_count rows once enough rows have been received
+  std::optional<std::string> next_batch();
+
+  // To be called once the client has sent all data and all batches have been taken with next_batch(). Returns the
+  // remaining rows and fails if the data is incomplete.
+  std::string finish();
+
+  // Parses a batch as returned by next_batch() or finish() into the segments of a chunk. As this does not modify the
+  // parser, different batches can be parsed concurrently.
+  Segments parse_batch(std::string_view batch) const;
+
+ protected:
+  // Searches the buffer for the ends of rows until batch_row_count rows have been found or the buffer ends
+  void _find_rows();
+  void _find_text_rows();
+  void _find_binary_rows();
+
+  // Removes the rows found so far from the buffer and returns them
+  std::string _take_rows();
+
+  const TableColumnDefinitions _column_definitions;
+  const CopyFormat _format;
+  const ChunkOffset _batch_row_count;
+
+  std::string _buffer;
+
+  // The part of the buffer that has been returned as a batch and can be dropped
+  size_t _taken_size = 0;
+  // The end of the last complete row that has been found and the number of rows found since the last batch
+  size_t _rows_end = 0;
+  ChunkOffset _row_count = 0;
+  // The position up to which the buffer has been searched. In the text formats, this may be within a row.
+  size_t _search_position = 0;
+  bool _in_quotes = false;
+
+  // Only used in the binary format
+  bool _header_found = false;
+  bool _trailer_found = false;
+};
+
+}  // namespace opossum
@@ -84,8 +84,11 @@ BindPacket PostgresWireHandler::handle_bind_packet(const InputPacket& packet) {
 
   auto num_result_column_format_codes = ntohs(read_value<int16_t>(packet));
   auto result_column_format_codes = read_values<int16_t>(packet, num_result_column_format_codes);
+  for (auto& format_code : result_column_format_codes) {
+    format_code = static_cast<int16_t>(ntohs(format_code));
+  }
 
-  return BindPacket{statement_name, portal, std::move(parameter_values)};
+  return BindPacket{statement_name, portal, std::move(parameter_values), std::move(result_column_format_codes)};
 }
 
 std::string PostgresWireHandler::handle_execute_packet(const InputPacket& packet) {
@@ -100,6 +103,18 @@ std::string PostgresWireHandler::handle_describe_packet(const InputPacket& packe
   return portal;
 }
 
+std::string PostgresWireHandler::handle_copy_data_packet(const InputPacket& packet) {
+  // The data of a COPY is sent in arbitrary pieces that do not need to be aligned with rows
+  auto data = std::string(packet.offset, packet.data.cend());
+  packet.offset = packet.data.cend();
+  return data;
+}
+
+std::string PostgresWireHandler::handle_copy_fail_packet(const InputPacket& packet) {
+  // The client may send the reason why the COPY failed
+  return read_string(packet);
+}
+
 void PostgresWireHandler::write_string(OutputPacket& packet, const std::string& value, bool terminate) {
   auto num_bytes = value.length();
   auto& data = packet.data;
@@ -43,6 +43,8 @@ struct BindPacket {
   std::string statement_name;
   std::string destination_portal;
   std::vector<AllTypeVariant> params;
+  // Format codes of the result columns (0 = text, 1 = binary), see QueryResponseBuilder::build_result_formats
+  std::vector<int16_t> result_format_codes;
 };
 
 class PostgresWireHandler {
@@ -60,6 +62,8 @@ class PostgresWireHandler {
   static BindPacket handle_bind_packet(const InputPacket& packet);
   static std::string handle_describe_packet(const InputPacket& packet);
   static std::string handle_execute_packet(const InputPacket& packet);
+  static std::string handle_copy_data_packet(const InputPacket& packet);
+  static std::string handle_copy_fail_packet(const InputPacket& packet);
 
   template <typename T>
   static T read_value(const InputPacket& packet);
@@ -1,17 +1,145 @@
 #include "query_response_builder.hpp"
 
+#include <array>
+#include <charconv>  // NOLINT - cpplint does not know this C++17 header
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+
 #include "server/postgres_wire_handler.hpp"
 #include "sql/sql_pipeline.hpp"
+#include "storage/segment_iterate.hpp"
 
 #include "SQLParserResult.h"
 
 #include "then_operator.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+/**
+ * The encoded values of one segment, each preceded by its length as required in the DataRow message:
+ *
+ * Int32
+ * The length of the column value, in bytes (this count does not include itself). Can be zero. As a special case,
+ * -1 indicates a NULL column value. No value bytes follow in the NULL case.
+ *
+ * Byte n
+ * The value of the column, in the format indicated by the associated format code. n is the above length.
+ */
+struct EncodedSegment {
+  ByteBuffer bytes;
+
+  // value_offsets[chunk_offset] is the position of the length of the value in bytes. The last entry is the end.
+  std::vector<size_t> value_offsets;
+};
+
+template <typename T>
+void append_big_endian(ByteBuffer& bytes, const T value) {
+  static_assert(std::is_unsigned_v<T>, "Expected the unsigned representation of the value");
+  for (auto shift = static_cast<int>(sizeof(T) * 8) - 8; shift >= 0; shift -= 8) {
+    bytes.push_back(static_cast<char>((value >> shift) & 0xFF));
+  }
+}
+
+template <typename T>
+void write_big_endian(char* destination, const T value) {
+  for (auto byte_index = size_t{0}; byte_index < sizeof(T); ++byte_index) {
+    destination[byte_index] = static_cast<char>((value >> ((sizeof(T) - 1 - byte_index) * 8)) & 0xFF);
+  }
+}
+
+void append_length_and_bytes(ByteBuffer& bytes, const char* begin, const size_t length) {
+  append_big_endian(bytes, static_cast<uint32_t>(length));
+  bytes.insert(bytes.end(), begin, begin + length);
+}
+
+// The text format matches the output of AllTypeVariant's operator<<, which is used by the console and in SQL results
+template <typename ColumnDataType>
+void append_text_value(ByteBuffer& bytes, const ColumnDataType& value) {
+  if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+    append_length_and_bytes(bytes, value.data(), value.size());
+  } else if constexpr (std::is_integral_v<ColumnDataType>) {  // NOLINT - doesn't like else if constexpr
+    auto text = std::array<char, 24>{};
+    const auto end = std::to_chars(text.data(), text.data() + text.size(), value).ptr;
+    append_length_and_bytes(bytes, text.data(), static_cast<size_t>(end - text.data()));
+  } else {
+    auto text = std::array<char, 32>{};
+    const auto length = std::snprintf(text.data(), text.size(), "%g", static_cast<double>(value));
+    append_length_and_bytes(bytes, text.data(), static_cast<size_t>(length));
+  }
+}
+
+// The binary format of PostgreSQL's int4, int8, float4, float8, and text types
+template <typename ColumnDataType>
+void append_binary_value(ByteBuffer& bytes, const ColumnDataType& value) {
+  if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+    append_length_and_bytes(bytes, value.data(), value.size());
+  } else {
+    using UnsignedType = std::conditional_t<sizeof(ColumnDataType) == 4, uint32_t, uint64_t>;
+    static_assert(sizeof(ColumnDataType) == sizeof(UnsignedType), "Unexpected size of data type");
+
+    auto unsigned_value = UnsignedType{};
+    std::memcpy(&unsigned_value, &value, sizeof(value));
+    append_big_endian(bytes, static_cast<uint32_t>(sizeof(value)));
+    append_big_endian(bytes, unsigned_value);
+  }
+}
+
+EncodedSegment encode_segment(const BaseSegment& segment, const ResultFormat result_format) {
+  auto encoded_segment = EncodedSegment{};
+  encoded_segment.value_offsets.reserve(segment.size() + 1);
+  // Enough for most numerical values and short strings, so that the buffer is rarely reallocated
+  encoded_segment.bytes.reserve(segment.size() * 12);
+
+  segment_iterate(segment, [&](const auto& position) {
+    using ColumnDataType = std::decay_t<decltype(position.value())>;
+
+    encoded_segment.value_offsets.emplace_back(encoded_segment.bytes.size());
+    if (position.is_null()) {
+      append_big_endian(encoded_segment.bytes, static_cast<uint32_t>(-1));
+    } else if (result_format == ResultFormat::Binary) {
+      append_binary_value<ColumnDataType>(encoded_segment.bytes, position.value());
+    } else {
+      append_text_value<ColumnDataType>(encoded_segment.bytes, position.value());
+    }
+  });
+  encoded_segment.value_offsets.emplace_back(encoded_segment.bytes.size());
+
+  return encoded_segment;
+}
+
+}  // namespace
+
 namespace opossum {
 
 using opossum::then_operator::then;
 
-std::vector<ColumnDescription> QueryResponseBuilder::build_row_description(const std::shared_ptr<const Table>& table) {
+std::vector<ResultFormat> QueryResponseBuilder::build_result_formats(const std::vector<int16_t>& format_codes,
+                                                                     const size_t column_count) {
+  for (const auto format_code : format_codes) {
+    AssertInput(format_code == static_cast<int16_t>(ResultFormat::Text) ||
+                    format_code == static_cast<int16_t>(ResultFormat::Binary),
+                "Unsupported result format code " + std::to_string(format_code) + ".");
+  }
+
+  if (format_codes.empty()) return std::vector<ResultFormat>(column_count, ResultFormat::Text);
+  if (format_codes.size() == 1) return std::vector<ResultFormat>(column_count, ResultFormat{format_codes.front()});
+
+  AssertInput(format_codes.size() == column_count, "Expected one result format code per column.");
+  auto result_formats = std::vector<ResultFormat>{};
+  result_formats.reserve(column_count);
+  for (const auto format_code : format_codes) {
+    result_formats.emplace_back(ResultFormat{format_code});
+  }
+  return result_formats;
+}
+
+std::vector<ColumnDescription> QueryResponseBuilder::build_row_description(
+    const std::shared_ptr<const Table>& table, const std::vector<ResultFormat>& result_formats) {
+  DebugAssert(result_formats.size() == table->column_count(), "Expected one result format per column");
+
   std::vector<ColumnDescription> result;
 
   const auto& column_names = table->column_names();
@@ -46,7 +174,7 @@ std::vector<ColumnDescription> QueryResponseBuilder::build_row_description(const
         Fail("Bad DataType");
     }
 
-    result.emplace_back(ColumnDescription{column_names[column_id], object_id, type_id});
+    result.emplace_back(ColumnDescription{column_names[column_id], object_id, type_id, result_formats[column_id]});
   }
 
   return result;
@@ -78,38 +206,90 @@ std::string QueryResponseBuilder::build_execution_info_message(const std::shared
   return stream.str();
 }
 
-boost::future<uint64_t> QueryResponseBuilder::send_query_response(const send_row_t& send_row, const Table& table) {
-  // Essentially we're iterating over every row in every chunk in the table, generating and sending
-  // its string representation. However, because of the asynchronous send_row call, we have to
-  // use this two-level recursion instead of two nested for-loops
+void QueryResponseBuilder::build_data_rows(const Chunk& chunk, const std::vector<ResultFormat>& result_formats,
+                                           OutputPacket& packet) {
+  /*
+  DataRow (B)
+  Byte1('D')
+  Identifies the message as a data row.
 
-  return _send_query_response_chunks(send_row, table, ChunkID{0}) >> then >> [&]() { return table.row_count(); };
-}
+  Int32
+  Length of message contents in bytes, including self.
 
-boost::future<void> QueryResponseBuilder::_send_query_response_chunks(const send_row_t& send_row, const Table& table,
-                                                                      ChunkID current_chunk_id) {
-  if (current_chunk_id == table.chunk_count()) return boost::make_ready_future();
+  Int16
+  The number of column values that follow (possibly zero).
+
+  Next, the following pair of fields appear for each column (see EncodedSegment).
+  */
+  const auto column_count = chunk.column_count();
+  const auto row_count = chunk.size();
 
-  const auto& chunk = table.get_chunk(current_chunk_id);
+  // Instead of converting each value to an AllTypeVariant, values are encoded per segment with the type resolved once
+  auto encoded_segments = std::vector<EncodedSegment>{};
+  encoded_segments.reserve(column_count);
+  auto encoded_size = size_t{0};
+  for (auto column_id = ColumnID{0}; column_id < ColumnID{column_count}; ++column_id) {
+    encoded_segments.emplace_back(encode_segment(*chunk.get_segment(column_id), result_formats[column_id]));
+    encoded_size += encoded_segments.back().bytes.size();
+  }
 
-  return _send_query_response_rows(send_row, *chunk, ChunkOffset{0}) >> then >>
-         std::bind(QueryResponseBuilder::_send_query_response_chunks, send_row, std::ref(table),
-                   ChunkID{current_chunk_id + 1});
+  constexpr auto MESSAGE_HEADER_SIZE = sizeof(char) + sizeof(uint32_t) + sizeof(uint16_t);
+
+  auto& data = packet.data;
+  auto write_offset = data.size();
+  data.resize(data.size() + row_count * MESSAGE_HEADER_SIZE + encoded_size);
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    auto message_size = sizeof(uint32_t) + sizeof(uint16_t);
+    for (const auto& encoded_segment : encoded_segments) {
+      message_size += encoded_segment.value_offsets[chunk_offset + 1] - encoded_segment.value_offsets[chunk_offset];
+    }
+
+    data[write_offset] = static_cast<char>(NetworkMessageType::DataRow);
+    write_big_endian(&data[write_offset + 1], static_cast<uint32_t>(message_size));
+    write_big_endian(&data[write_offset + 1 + sizeof(uint32_t)], static_cast<uint16_t>(column_count));
+    write_offset += MESSAGE_HEADER_SIZE;
+
+    for (const auto& encoded_segment : encoded_segments) {
+      const auto value_begin = encoded_segment.value_offsets[chunk_offset];
+      const auto value_size = encoded_segment.value_offsets[chunk_offset + 1] - value_begin;
+      std::memcpy(&data[write_offset], &encoded_segment.bytes[value_begin], value_size);
+      write_offset += value_size;
+    }
+  }
+
+  DebugAssert(write_offset == data.size(), "DataRow messages do not fill the packet");
 }
 
-boost::future<void> QueryResponseBuilder::_send_query_response_rows(const send_row_t& send_row, const Chunk& chunk,
-                                                                    ChunkOffset current_chunk_offset) {
-  if (current_chunk_offset == chunk.size()) return boost::make_ready_future();
+boost::future<uint64_t> QueryResponseBuilder::send_query_response(const send_data_rows_t& send_data_rows,
+                                                                  const Table& table,
+                                                                  const std::vector<ResultFormat>& result_formats) {
+  // Essentially we're iterating over every chunk in the table, generating and sending the DataRow messages of its
+  // rows. However, because of the asynchronous send_data_rows call, we have to use this recursion instead of a loop
+
+  return _send_query_response_chunks(send_data_rows, table, result_formats, ChunkID{0}) >> then >>
+         [&]() { return table.row_count(); };
+}
 
-  std::vector<std::string> row_strings(chunk.column_count());
+boost::future<void> QueryResponseBuilder::_send_query_response_chunks(const send_data_rows_t& send_data_rows,
+                                                                      const Table& table,
+                                                                      const std::vector<ResultFormat>& result_formats,
+                                                                      ChunkID current_chunk_id) {
+  const auto chunk_count = table.chunk_count();
+  if (current_chunk_id == chunk_count) return boost::make_ready_future();
 
-  for (ColumnID column_id{0}; column_id < ColumnID{chunk.column_count()}; ++column_id) {
-    const auto& segment = chunk.get_segment(column_id);
-    row_strings[column_id] = boost::lexical_cast<pmr_string>((*segment)[current_chunk_offset]);
+  // Small chunks (e.g., from selective scans) are combined so that each write sends a reasonable amount of data
+  auto packet = std::make_shared<OutputPacket>();
+  while (current_chunk_id < chunk_count && packet->data.size() < MIN_DATA_ROWS_PACKET_SIZE) {
+    build_data_rows(*table.get_chunk(current_chunk_id), result_formats, *packet);
+    ++current_chunk_id;
   }
 
-  return send_row(row_strings) >> then >> std::bind(QueryResponseBuilder::_send_query_response_rows, send_row,
-                                                    std::ref(chunk), ChunkOffset{current_chunk_offset + 1});
+  if (packet->data.empty()) return boost::make_ready_future();
+
+  return send_data_rows(packet) >> then >>
+         std::bind(QueryResponseBuilder::_send_query_response_chunks, send_data_rows, std::ref(table), result_formats,
+                   current_chunk_id);
 }
 
 }  // namespace opossum
@@ -9,22 +9,37 @@ namespace opossum {
 
 class AbstractOperator;
 class SQLPipeline;
+enum class ResultFormat : int16_t;
 
 class QueryResponseBuilder {
  public:
-  static std::vector<ColumnDescription> build_row_description(const std::shared_ptr<const Table>& table);
+  // Resolves the result format codes of a Bind message to one format per column: Without codes, all columns are sent
+  // as text. A single code applies to all columns. Otherwise, there has to be one code per column.
+  static std::vector<ResultFormat> build_result_formats(const std::vector<int16_t>& format_codes,
+                                                        size_t column_count);
+
+  static std::vector<ColumnDescription> build_row_description(const std::shared_ptr<const Table>& table,
+                                                              const std::vector<ResultFormat>& result_formats);
   static std::string build_command_complete_message(const AbstractOperator& root_op, uint64_t row_count);
   static std::string build_execution_info_message(const std::shared_ptr<SQLPipeline>& sql_pipeline);
 
-  using send_row_t = std::function<boost::future<void>(const std::vector<std::string>&)>;
+  // Appends one DataRow message per row of the chunk to the packet. The values are encoded segment by segment in the
+  // given formats and then copied into the packet, which is resized only once.
+  static void build_data_rows(const Chunk& chunk, const std::vector<ResultFormat>& result_formats,
+                              OutputPacket& packet);
+
+  using send_data_rows_t = std::function<boost::future<void>(const std::shared_ptr<OutputPacket>&)>;
+
+  static boost::future<uint64_t> send_query_response(const send_data_rows_t& send_data_rows, const Table& table,
+                                                     const std::vector<ResultFormat>& result_formats);
 
-  static boost::future<uint64_t> send_query_response(const send_row_t& send_row, const Table& table);
+  // The DataRow messages of consecutive chunks are collected in one packet until it reaches this size
+  static constexpr auto MIN_DATA_ROWS_PACKET_SIZE = size_t{64 * 1024};
 
  protected:
-  static boost::future<void> _send_query_response_chunks(const send_row_t& send_row, const Table& table,
+  static boost::future<void> _send_query_response_chunks(const send_data_rows_t& send_data_rows, const Table& table,
+                                                         const std::vector<ResultFormat>& result_formats,
                                                          ChunkID current_chunk_id);
-  static boost::future<void> _send_query_response_rows(const send_row_t& send_row, const Chunk& chunk,
-                                                       ChunkOffset current_chunk_offset);
 };
 
 }  // namespace opossum
@@ -0,0 +1,109 @@
+#include "result_stream.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+
+#include "expression/expression_utils.hpp"
+#include "operators/abstract_operator.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/table.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+bool contains_subquery(const std::shared_ptr<AbstractExpression>& expression) {
+  auto found_subquery = false;
+  visit_expression(expression, [&](const auto& sub_expression) {
+    if (sub_expression->type == ExpressionType::PQPSubquery) found_subquery = true;
+    return found_subquery ? ExpressionVisitation::DoNotVisitArguments : ExpressionVisitation::VisitArguments;
+  });
+  return found_subquery;
+}
+
+// Whether the operator produces the output for each input chunk independently of the other chunks. Subqueries are
+// excluded, as they would be executed again for each batch.
+bool is_chunk_wise(const AbstractOperator& op) {
+  switch (op.type()) {
+    case OperatorType::Validate:
+      return true;
+    case OperatorType::TableScan:
+      return !contains_subquery(static_cast<const TableScan&>(op).predicate());
+    case OperatorType::Projection: {
+      const auto& expressions = static_cast<const Projection&>(op).expressions;
+      return std::none_of(expressions.begin(), expressions.end(), contains_subquery);
+    }
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::shared_ptr<ResultStream> ResultStream::create(const std::shared_ptr<AbstractOperator>& plan) {
+  auto pipeline = std::vector<std::shared_ptr<AbstractOperator>>{};
+  auto op = plan;
+  while (op && is_chunk_wise(*op)) {
+    pipeline.emplace_back(op);
+    op = op->mutable_input_left();
+  }
+
+  if (pipeline.empty() || !op) return nullptr;
+
+  return std::make_shared<ResultStream>(std::move(pipeline), op);
+}
+
+ResultStream::ResultStream(std::vector<std::shared_ptr<AbstractOperator>> pipeline,
+                           std::shared_ptr<AbstractOperator> input)
+    : _pipeline(std::move(pipeline)), _input(std::move(input)) {}
+
+void ResultStream::execute_input() {
+  CurrentScheduler::schedule_and_wait_for_tasks(
+      OperatorTask::make_tasks_from_operator(_input, CleanupTemporaries::Yes));
+}
+
+std::shared_ptr<const Table> ResultStream::execute_next_batch() {
+  const auto input_table = _input->get_output();
+  Assert(input_table, "The input has to be executed first");
+
+  if (_returned_first_batch && !has_next_batch()) return nullptr;
+
+  // One chunk per core, so that the chunk-parallel operators of the pipeline can use all of them
+  const auto batch_chunk_count = std::max(size_t{1}, Topology::get().num_cpus());
+  const auto chunk_count = input_table->chunk_count();
+
+  auto batch_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  while (_next_chunk_id < chunk_count && batch_chunks.size() < batch_chunk_count) {
+    // The chunks are not modified, the batch table only groups them as input of the pipeline
+    batch_chunks.emplace_back(std::const_pointer_cast<Chunk>(input_table->get_chunk(_next_chunk_id)));
+    ++_next_chunk_id;
+  }
+  const auto batch_table = std::make_shared<Table>(input_table->column_definitions(), input_table->type(),
+                                                   std::move(batch_chunks), input_table->has_mvcc());
+
+  // Instantiate the pipeline on top of the batch instead of the input
+  auto copied_ops = std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>{
+      {_input.get(), std::make_shared<TableWrapper>(batch_table)}};
+  const auto batch_plan = _pipeline.front()->deep_copy(copied_ops);
+
+  CurrentScheduler::schedule_and_wait_for_tasks(
+      OperatorTask::make_tasks_from_operator(batch_plan, CleanupTemporaries::Yes));
+
+  _returned_first_batch = true;
+  return batch_plan->get_output();
+}
+
+bool ResultStream::has_next_batch() const {
+  const auto input_table = _input->get_output();
+  return !_returned_first_batch || (input_table && _next_chunk_id < input_table->chunk_count());
+}
+
+}  // namespace opossum
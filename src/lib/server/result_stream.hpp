@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "../types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class Table;
+
+/**
+ * Executes a PQP in parts so that the server can send the first rows of a large result before the entire result is
+ * materialized. This is possible if the top operators of the PQP process each chunk of their input independently
+ * (Validate, TableScan, and Projection without subqueries). The operators below this top pipeline are executed once by
+ * execute_input(). The top pipeline is then instantiated and executed for one batch of input chunks at a time by
+ * execute_next_batch(). As the server only requests a batch once the one before the previous batch has been sent, a
+ * client that reads slowly throttles the execution instead of letting the result pile up in memory.
+ *
+ * The rows are returned in the same order as by the original PQP.
+ */
+class ResultStream : private Noncopyable {
+ public:
+  // Returns nullptr if the PQP has no top pipeline that can be executed in parts
+  static std::shared_ptr<ResultStream> create(const std::shared_ptr<AbstractOperator>& plan);
+
+  ResultStream(std::vector<std::shared_ptr<AbstractOperator>> pipeline, std::shared_ptr<AbstractOperator> input);
+
+  void execute_input();
+
+  // The output of the top pipeline for the next batch of input chunks. The first batch is returned even if the input
+  // has no chunks, so that the columns of the result can be described.
+  std::shared_ptr<const Table> execute_next_batch();
+  bool has_next_batch() const;
+
+ protected:
+  // The operators of the top pipeline, from the top to the bottom
+  const std::vector<std::shared_ptr<AbstractOperator>> _pipeline;
+  const std::shared_ptr<AbstractOperator> _input;
+
+  ChunkID _next_chunk_id{0};
+  bool _returned_first_batch{false};
+};
+
+}  // namespace opossum
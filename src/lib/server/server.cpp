@@ -12,29 +12,64 @@ namespace opossum {
 
 using opossum::then_operator::then;
 
-Server::Server(boost::asio::io_service& io_service, uint16_t port)
+Server::Server(boost::asio::io_service& io_service, uint16_t port, size_t io_thread_count)
     : _io_service(io_service),
-      _acceptor(io_service, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port)),
-      _socket(io_service) {
+      _acceptor(io_service, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port)) {
+  for (auto thread_index = size_t{0}; thread_index < io_thread_count; ++thread_index) {
+    auto& session_io_service = *_session_io_services.emplace_back(std::make_unique<boost::asio::io_service>());
+    _session_io_service_works.emplace_back(std::make_unique<boost::asio::io_service::work>(session_io_service));
+    _session_io_threads.emplace_back([&session_io_service]() { session_io_service.run(); });
+  }
+
   _accept_next_connection();
 }
 
+Server::~Server() {
+  // Cancel the pending accept before the socket it accepts into is destroyed
+  _acceptor.close();
+  _socket.reset();
+
+  _session_io_service_works.clear();
+  for (auto& session_io_service : _session_io_services) {
+    session_io_service->stop();
+  }
+  for (auto& session_io_thread : _session_io_threads) {
+    session_io_thread.join();
+  }
+}
+
 void Server::_accept_next_connection() {
-  _acceptor.async_accept(_socket, boost::bind(&Server::_start_session, this, boost::asio::placeholders::error));
+  // The socket is created on the io_service of the session, so that its asynchronous operations complete there
+  auto& session_io_service = _next_session_io_service();
+  _socket = std::make_unique<boost::asio::ip::tcp::socket>(session_io_service);
+  _acceptor.async_accept(*_socket, boost::bind(&Server::_start_session, this, boost::ref(session_io_service),
+                                               boost::asio::placeholders::error));
 }
 
-void Server::_start_session(boost::system::error_code error) {
+void Server::_start_session(boost::asio::io_service& session_io_service, boost::system::error_code error) {
   if (!error) {
-    auto connection = std::make_shared<ClientConnection>(std::move(_socket));
-    auto task_runner = std::make_shared<TaskRunner>(_io_service);
+    auto connection = std::make_shared<ClientConnection>(std::move(*_socket));
+    auto task_runner = std::make_shared<TaskRunner>(session_io_service);
     auto session = std::make_shared<ServerSession>(connection, task_runner);
-    // Start the session and release it once it has terminated
-    session->start() >> then >> [=]() mutable { session.reset(); };
+
+    // The session is started on its own thread, so that none of its handlers runs concurrently to another one
+    session_io_service.post([session]() mutable {
+      // Start the session and release it once it has terminated
+      session->start() >> then >> [=]() mutable { session.reset(); };
+    });
   }
 
   _accept_next_connection();
 }
 
+boost::asio::io_service& Server::_next_session_io_service() {
+  if (_session_io_services.empty()) return _io_service;
+
+  auto& session_io_service = *_session_io_services[_next_session_io_service_index];
+  _next_session_io_service_index = (_next_session_io_service_index + 1) % _session_io_services.size();
+  return session_io_service;
+}
+
 uint16_t Server::get_port_number() { return _acceptor.local_endpoint().port(); }
 
 }  // namespace opossum
@@ -3,23 +3,42 @@
 #include <boost/asio/io_service.hpp>
 #include <boost/asio/ip/tcp.hpp>
 
+#include <memory>
+#include <thread>
+#include <vector>
+
 #include "server_session.hpp"
 
 namespace opossum {
 
+// Accepts client connections and starts a ServerSession for each of them. With io_thread_count == 0, the sessions run
+// on the io_service that accepts the connections. Otherwise, the server starts io_thread_count threads with an
+// io_service each and assigns the sessions to them round-robin. As all asynchronous operations of a session run on the
+// same thread, the sessions do not need strands or locks, while different sessions are served by different cores.
 class Server {
  public:
-  Server(boost::asio::io_service& io_service, uint16_t port);
+  Server(boost::asio::io_service& io_service, uint16_t port, size_t io_thread_count = 0);
+  ~Server();
 
   uint16_t get_port_number();
 
  protected:
   void _accept_next_connection();
-  void _start_session(boost::system::error_code error);
+  void _start_session(boost::asio::io_service& session_io_service, boost::system::error_code error);
+
+  boost::asio::io_service& _next_session_io_service();
 
   boost::asio::io_service& _io_service;
   boost::asio::ip::tcp::acceptor _acceptor;
-  boost::asio::ip::tcp::socket _socket;
+
+  std::vector<std::unique_ptr<boost::asio::io_service>> _session_io_services;
+  // Keeps the session io_services running while they have no sessions
+  std::vector<std::unique_ptr<boost::asio::io_service::work>> _session_io_service_works;
+  std::vector<std::thread> _session_io_threads;
+  size_t _next_session_io_service_index{0};
+
+  // The socket of the next connection is created on a session io_service, so it has to be destroyed before them
+  std::unique_ptr<boost::asio::ip::tcp::socket> _socket;
 };
 
 }  // namespace opossum
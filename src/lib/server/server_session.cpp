@@ -15,15 +15,20 @@
 #include "sql/sql_pipeline.hpp"
 #include "sql/sql_translator.hpp"
 #include "storage/storage_manager.hpp"
+#include "tasks/server/append_server_copy_data_task.hpp"
 #include "tasks/server/bind_server_prepared_statement_task.hpp"
 #include "tasks/server/create_pipeline_task.hpp"
 #include "tasks/server/execute_server_prepared_statement_task.hpp"
 #include "tasks/server/execute_server_query_task.hpp"
+#include "tasks/server/execute_server_result_batch_task.hpp"
 #include "tasks/server/load_server_file_task.hpp"
+#include "tasks/server/parse_server_copy_data_task.hpp"
 #include "tasks/server/parse_server_prepared_statement_task.hpp"
 
 #include "client_connection.hpp"
+#include "copy_data_parser.hpp"
 #include "query_response_builder.hpp"
+#include "result_stream.hpp"
 #include "then_operator.hpp"
 #include "types.hpp"
 #include "use_boost_future.hpp"
@@ -119,11 +124,19 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_client_
       return boost::make_ready_future();
     }
 
+    if (_discard_until_sync) {
+      if (request.message_type != NetworkMessageType::SyncCommand) {
+        return _connection->skip_packet_body(request.payload_length) >> then >>
+               [this, self]() { return _handle_client_requests(); };
+      }
+      _discard_until_sync = false;
+    }
+
     // Handle any exceptions that have occurred during process_command. For this, we need to call .then() explicitly,
     // because >> then >> does not handle exceptions
     return process_command(request)
                .then(boost::launch::sync,
-                     [this, self](boost::future<void> result) {
+                     [this, self, request](boost::future<void> result) {
                        try {
                          result.get();
                          return boost::make_ready_future();
@@ -134,6 +147,13 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_client_
                            _transaction.reset();
                          }
 
+                         // In the extended query protocol, the client expects the ReadyForQuery only for its Sync
+                         if (request.message_type != NetworkMessageType::SimpleQueryCommand &&
+                             request.message_type != NetworkMessageType::SyncCommand) {
+                           _discard_until_sync = true;
+                           return _connection->send_error(e.what());
+                         }
+
                          return _connection->send_error(e.what()) >> then >>
                                 [this, self]() { return _connection->send_ready_for_query(); };
                        }
@@ -146,26 +166,28 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_client_
 
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_send_simple_query_response(
-    const std::shared_ptr<SQLPipeline>& sql_pipeline) {
-  const auto result_table_pair = sql_pipeline->get_result_table();
-
-  Assert(result_table_pair.first == SQLPipelineStatus::Success, "Server cannot handle failed transactions yet");
-  const auto result_table = result_table_pair.second;
-
+    const std::shared_ptr<SQLPipeline>& sql_pipeline, const std::shared_ptr<const Table>& result_table,
+    const std::shared_ptr<ResultStream>& result_stream) {
   auto send_row_data = [=]() {
     // If there is no result table, e.g. after an INSERT command, we cannot send row data
     if (!result_table) return boost::make_ready_future<uint64_t>(0);
 
-    auto row_description = QueryResponseBuilder::build_row_description(result_table);
+    // The simple query protocol always returns text
+    const auto result_formats = QueryResponseBuilder::build_result_formats({}, result_table->column_count());
+    auto row_description = QueryResponseBuilder::build_row_description(result_table, result_formats);
 
-    return _connection->send_row_description(row_description) >> then >> [=]() {
-      return QueryResponseBuilder::send_query_response(
-          [=](const std::vector<std::string>& row) { return _connection->send_data_row(row); }, *result_table);
-    };
+    return _connection->send_row_description(row_description) >> then >>
+           [=]() { return _send_result_batches(result_table, result_stream, result_formats, 0); };
   };
 
   auto send_command_complete = [=](uint64_t row_count) {
     auto root_op = sql_pipeline->get_physical_plans().front();
+
+    // The pipeline did not execute a streamed statement, so it did not auto-commit it either
+    if (result_stream) {
+      if (const auto transaction_context = root_op->transaction_context()) transaction_context->commit();
+    }
+
     auto complete_message = QueryResponseBuilder::build_command_complete_message(*root_op, row_count);
     return _connection->send_command_complete(complete_message);
   };
@@ -190,19 +212,105 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_simple_
 
   auto execute_sql_pipeline = [=](std::shared_ptr<SQLPipeline> sql_pipeline) {
     auto task = std::make_shared<ExecuteServerQueryTask>(sql_pipeline);
-    return _task_runner->dispatch_server_task(task) >> then >> [=]() { return sql_pipeline; };
+    return _task_runner->dispatch_server_task(task) >> then >> [=](std::shared_ptr<const Table> result_table) {
+      return _send_simple_query_response(sql_pipeline, result_table, task->result_stream());
+    };
   };
 
   // A simple query command invalidates unnamed statements and portals
-  if (StorageManager::get().has_prepared_plan("")) StorageManager::get().drop_prepared_plan("");
+  _prepared_statements.erase("");
   _portals.erase("");
 
   return create_sql_pipeline() >> then >> [=](std::unique_ptr<CreatePipelineResult> result) {
     if (result->load_table) {
       return load_table_file(result->load_table->first, result->load_table->second);
+    } else if (result->copy_from_stdin) {
+      return _handle_copy_from_stdin(*result->copy_from_stdin);
     } else {
-      return execute_sql_pipeline(result->sql_pipeline) >> then >>
-             [=](std::shared_ptr<SQLPipeline> sql_pipeline) { return _send_simple_query_response(sql_pipeline); };
+      return execute_sql_pipeline(result->sql_pipeline);
+    }
+  };
+}
+
+template <typename TConnection, typename TTaskRunner>
+boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_copy_from_stdin(
+    const CopyFromStdin& copy_from_stdin) {
+  const auto table_name = copy_from_stdin.table_name;
+  // Not using Assert() since it includes file:line info that we don't want to hard code in tests
+  AssertInput(StorageManager::get().has_table(table_name), "Table " + table_name + " does not exist.");
+  const auto table = StorageManager::get().get_table(table_name);
+
+  // The rows are parsed in batches of the size of the table's chunks
+  auto copy_in = std::make_shared<CopyIn>();
+  copy_in->copy_data_parser =
+      std::make_shared<CopyDataParser>(table->column_definitions(), copy_from_stdin.format, table->max_chunk_size());
+
+  return _connection->send_copy_in_response(copy_from_stdin.format, table->column_count()) >> then >>
+         [=]() { return _receive_copy_data(copy_in); } >> then >>
+         [=]() { return boost::when_all(copy_in->parsed_batches.begin(), copy_in->parsed_batches.end()); } >>
+         then >>
+         [=](auto parsed_batches) {
+           auto batches = std::vector<Segments>{};
+           batches.reserve(parsed_batches.size());
+           for (auto& parsed_batch : parsed_batches) {
+             batches.emplace_back(parsed_batch.get());
+           }
+
+           auto task = std::make_shared<AppendServerCopyDataTask>(table_name, std::move(batches));
+           return _task_runner->dispatch_server_task(task);
+         } >>
+         then >> [=](uint64_t row_count) {
+           return _connection->send_command_complete("COPY " + std::to_string(row_count));
+         };
+}
+
+template <typename TConnection, typename TTaskRunner>
+boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_receive_copy_data(
+    const std::shared_ptr<CopyIn>& copy_in) {
+  const auto schedule_batch = [=](std::string batch) {
+    auto task = std::make_shared<ParseServerCopyDataTask>(copy_in->copy_data_parser, std::move(batch));
+    copy_in->parsed_batches.emplace_back(_task_runner->dispatch_server_task(task));
+  };
+
+  return _connection->receive_packet_header() >> then >> [=](RequestHeader request) {
+    switch (request.message_type) {
+      case NetworkMessageType::CopyDataCommand: {
+        return _connection->receive_copy_data_packet_body(request.payload_length) >> then >> [=](std::string data) {
+          if (!copy_in->error) {
+            try {
+              copy_in->copy_data_parser->append(data);
+              while (auto batch = copy_in->copy_data_parser->next_batch()) {
+                schedule_batch(std::move(*batch));
+              }
+            } catch (const std::exception& exception) {
+              copy_in->error = exception.what();
+            }
+          }
+          return _receive_copy_data(copy_in);
+        };
+      }
+
+      case NetworkMessageType::CopyDoneCommand: {
+        return _connection->receive_copy_done_packet_body(request.payload_length) >> then >> [=]() {
+          if (copy_in->error) FailInput(*copy_in->error);
+          schedule_batch(copy_in->copy_data_parser->finish());
+        };
+      }
+
+      case NetworkMessageType::CopyFailCommand: {
+        return _connection->receive_copy_fail_packet_body(request.payload_length) >> then >>
+               [=](std::string message) { FailInput("COPY from stdin failed: " + message); };
+      }
+
+      // PostgreSQL ignores these messages during a COPY, as some clients send them
+      case NetworkMessageType::FlushCommand:
+      case NetworkMessageType::SyncCommand: {
+        return _connection->skip_packet_body(request.payload_length) >> then >>
+               [=]() { return _receive_copy_data(copy_in); };
+      }
+
+      default:
+        FailInput("Unexpected message type during COPY from stdin.");
     }
   };
 }
@@ -211,17 +319,19 @@ template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_parse_command(const ParsePacket& parse_info) {
   // Named prepared statements must be explicitly closed before they can be redefined by another Parse message
   // https://www.postgresql.org/docs/10/static/protocol-flow.html
-  if (StorageManager::get().has_prepared_plan(parse_info.statement_name)) {
+  auto prepared_statement_it = _prepared_statements.find(parse_info.statement_name);
+  if (prepared_statement_it != _prepared_statements.end()) {
     AssertInput(parse_info.statement_name.empty(),
                 "Named prepared statements must be explicitly closed before they can be redefined.");
-    StorageManager::get().drop_prepared_plan(parse_info.statement_name);
+    _prepared_statements.erase(prepared_statement_it);
   }
 
   auto task = std::make_shared<ParseServerPreparedStatementTask>(parse_info.query);
   return _task_runner->dispatch_server_task(task) >> then >>
          [=](std::unique_ptr<PreparedPlan> prepared_plan) {
            // We know that SQLPipeline is set because the load table command is not allowed in this context
-           StorageManager::get().add_prepared_plan(parse_info.statement_name, std::move(prepared_plan));
+           _prepared_statements.emplace(parse_info.statement_name,
+                                        PreparedStatement{std::move(prepared_plan), nullptr});
          } >>
          then >> [=]() { return _connection->send_status_message(NetworkMessageType::ParseComplete); };
 }
@@ -229,12 +339,12 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_parse_c
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_bind_command(const BindPacket& packet) {
   // Not using Assert() since it includes file:line info that we don't want to hard code in tests
-  AssertInput(StorageManager::get().has_prepared_plan(packet.statement_name),
-              "The specified statement does not exist.");
+  const auto prepared_statement_it = _prepared_statements.find(packet.statement_name);
+  AssertInput(prepared_statement_it != _prepared_statements.end(), "The specified statement does not exist.");
 
-  const auto prepared_plan = StorageManager::get().get_prepared_plan(packet.statement_name);
+  const auto prepared_statement = prepared_statement_it->second;
 
-  if (packet.statement_name.empty()) StorageManager::get().drop_prepared_plan(packet.statement_name);
+  if (packet.statement_name.empty()) _prepared_statements.erase(prepared_statement_it);
 
   auto portal_name = packet.destination_portal;
 
@@ -248,9 +358,31 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_bind_co
     _portals.erase(portal_it);
   }
 
-  auto task = std::make_shared<BindServerPreparedStatementTask>(prepared_plan, packet.params);
+  const auto result_format_codes = packet.result_format_codes;
+
+  // Binding the template of the statement only copies its PQP. This is done right away instead of in a task, so that
+  // pipelined point queries do not wait for the scheduler.
+  const auto& statement_template = prepared_statement.prepared_statement_template;
+  if (statement_template && statement_template->parameter_data_types ==
+                                BindServerPreparedStatementTask::parameter_data_types(packet.params)) {
+    const auto physical_plan =
+        BindServerPreparedStatementTask::bind(*statement_template, *prepared_statement.prepared_plan, packet.params);
+    _portals.emplace(portal_name, Portal{physical_plan, result_format_codes});
+    return _connection->send_status_message(NetworkMessageType::BindComplete);
+  }
+
+  const auto statement_name = packet.statement_name;
+  auto task = std::make_shared<BindServerPreparedStatementTask>(prepared_statement.prepared_plan, packet.params);
   return _task_runner->dispatch_server_task(task) >> then >>
-         [=](std::shared_ptr<AbstractOperator> physical_plan) { _portals.emplace(portal_name, physical_plan); } >>
+         [=](std::shared_ptr<AbstractOperator> physical_plan) {
+           // Keep the template for the following Bind messages of the statement (unless it was the unnamed one)
+           const auto bound_statement_it = _prepared_statements.find(statement_name);
+           if (bound_statement_it != _prepared_statements.end() && task->prepared_statement_template()) {
+             bound_statement_it->second.prepared_statement_template = task->prepared_statement_template();
+           }
+
+           _portals.emplace(portal_name, Portal{physical_plan, result_format_codes});
+         } >>
          then >> [=]() { return _connection->send_status_message(NetworkMessageType::BindComplete); };
 }
 
@@ -273,8 +405,7 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_sync_co
 
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_flush_command() {
-  // Ignore this because this message is received in a batch with other commands that handle the response.
-  return boost::make_ready_future();
+  return _connection->flush();
 }
 
 template <typename TConnection, typename TTaskRunner>
@@ -283,7 +414,8 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_execute
   auto portal_it = _portals.find(portal_name);
   Assert(portal_it != _portals.end(), "The specified portal does not exist.");
 
-  const auto physical_plan = portal_it->second;
+  const auto physical_plan = portal_it->second.physical_plan;
+  const auto result_format_codes = portal_it->second.result_format_codes;
 
   if (portal_name.empty()) _portals.erase(portal_it);
 
@@ -291,8 +423,8 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_execute
 
   physical_plan->set_transaction_context_recursively(_transaction);
 
-  return _task_runner->dispatch_server_task(std::make_shared<ExecuteServerPreparedStatementTask>(physical_plan)) >>
-         then >>
+  const auto task = std::make_shared<ExecuteServerPreparedStatementTask>(physical_plan);
+  return _task_runner->dispatch_server_task(task) >> then >>
          [=](std::shared_ptr<const Table> result_table) {
            // The behavior is a little different compared to SimpleQueryCommand: Send a 'No Data' response
            if (!result_table) {
@@ -300,10 +432,12 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_execute
                     []() { return uint64_t(0); };
            }
 
-           const auto row_description = QueryResponseBuilder::build_row_description(result_table);
+           // If the result is streamed, result_table is only its first batch, which has the same columns as the others
+           const auto result_formats =
+               QueryResponseBuilder::build_result_formats(result_format_codes, result_table->column_count());
+           const auto row_description = QueryResponseBuilder::build_row_description(result_table, result_formats);
            return _connection->send_row_description(row_description) >> then >> [=]() {
-             return QueryResponseBuilder::send_query_response(
-                 [=](const std::vector<std::string>& row) { return _connection->send_data_row(row); }, *result_table);
+             return _send_result_batches(result_table, task->result_stream(), result_formats, 0);
            };
          } >>
          then >> [=](uint64_t row_count) {
@@ -312,6 +446,38 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_execute
          };
 }
 
+template <typename TConnection, typename TTaskRunner>
+boost::future<uint64_t> ServerSessionImpl<TConnection, TTaskRunner>::_send_result_batches(
+    const std::shared_ptr<const Table>& batch, const std::shared_ptr<ResultStream>& result_stream,
+    const std::vector<ResultFormat>& result_formats, const uint64_t sent_row_count) {
+  // The next batch is executed while the current one is sent. As the batch after it is only requested once the current
+  // one has been sent, at most two batches are held in memory and a slow client throttles the execution.
+  using BatchFuture = boost::future<std::shared_ptr<const Table>>;
+  const auto next_batch = std::make_shared<BatchFuture>(
+      result_stream && result_stream->has_next_batch()
+          ? _task_runner->dispatch_server_task(std::make_shared<ExecuteServerResultBatchTask>(result_stream))
+          : boost::make_ready_future(std::shared_ptr<const Table>{}));
+
+  // We need a copy of this session to outlive the async operation
+  auto self = this->shared_from_this();
+  return QueryResponseBuilder::send_query_response(
+             [this, self](const std::shared_ptr<OutputPacket>& data_rows) {
+               return _connection->send_data_rows(data_rows);
+             },
+             *batch, result_formats) >>
+         then >>
+         [this, self, batch, next_batch, result_stream, result_formats, sent_row_count](uint64_t /* row_count */) {
+           // batch is captured so that it outlives send_query_response, which only holds a reference to it
+           const auto total_row_count = sent_row_count + batch->row_count();
+           return std::move(*next_batch) >> then >>
+                  [this, self, result_stream, result_formats,
+                   total_row_count](std::shared_ptr<const Table> next_table) {
+                    if (!next_table) return boost::make_ready_future(total_row_count);
+                    return _send_result_batches(next_table, result_stream, result_formats, total_row_count);
+                  };
+         };
+}
+
 template class ServerSessionImpl<ClientConnection, TaskRunner>;
 
 }  // namespace opossum
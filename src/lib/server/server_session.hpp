@@ -5,15 +5,26 @@
 #include <boost/thread/future.hpp>
 
 #include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "client_connection.hpp"
 #include "postgres_wire_handler.hpp"
 #include "sql/sql_pipeline.hpp"
+#include "storage/chunk.hpp"
+#include "storage/prepared_plan.hpp"
 #include "task_runner.hpp"
+#include "tasks/server/bind_server_prepared_statement_task.hpp"
+#include "tasks/server/create_pipeline_task.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
+class CopyDataParser;
+class ResultStream;
+
 template <typename TConnection, typename TTaskRunner>
 class ServerSessionImpl : public std::enable_shared_from_this<ServerSessionImpl<TConnection, TTaskRunner>> {
  public:
@@ -34,14 +45,58 @@ class ServerSessionImpl : public std::enable_shared_from_this<ServerSessionImpl<
   boost::future<void> _handle_sync_command();
   boost::future<void> _handle_flush_command();
 
-  boost::future<void> _send_simple_query_response(const std::shared_ptr<SQLPipeline>& sql_pipeline);
+  // If the result is streamed, result_table is only its first batch. The transaction of the streamed statement is
+  // committed after the last batch has been sent.
+  boost::future<void> _send_simple_query_response(const std::shared_ptr<SQLPipeline>& sql_pipeline,
+                                                  const std::shared_ptr<const Table>& result_table,
+                                                  const std::shared_ptr<ResultStream>& result_stream);
+
+  // State of a COPY ... FROM STDIN while the client is sending the data
+  struct CopyIn {
+    std::shared_ptr<CopyDataParser> copy_data_parser;
+    std::vector<boost::future<Segments>> parsed_batches;
+    // Set if the data cannot be parsed. As the client sends the data without waiting for responses, the error is only
+    // sent once it has finished.
+    std::optional<std::string> error;
+  };
+
+  boost::future<void> _handle_copy_from_stdin(const CopyFromStdin& copy_from_stdin);
+  // Receives CopyData messages until CopyDone (or CopyFail) and schedules the parsing of each batch of rows right away
+  boost::future<void> _receive_copy_data(const std::shared_ptr<CopyIn>& copy_in);
+
+  // Sends the DataRow messages of a batch and, if the result is streamed, of all following batches. Returns the total
+  // number of sent rows.
+  boost::future<uint64_t> _send_result_batches(const std::shared_ptr<const Table>& batch,
+                                               const std::shared_ptr<ResultStream>& result_stream,
+                                               const std::vector<ResultFormat>& result_formats,
+                                               uint64_t sent_row_count);
 
   std::shared_ptr<TConnection> _connection;
   std::shared_ptr<TTaskRunner> _task_runner;
 
   std::shared_ptr<TransactionContext> _transaction;
 
-  std::unordered_map<std::string, std::shared_ptr<AbstractOperator>> _portals;
+  // Set after an error in the extended query protocol. The client may have pipelined further messages without waiting
+  // for the responses, these are discarded until the next Sync, as in PostgreSQL.
+  bool _discard_until_sync = false;
+
+  struct PreparedStatement {
+    std::shared_ptr<PreparedPlan> prepared_plan;
+    // Created by the first Bind, so that the following ones only copy the PQP
+    std::shared_ptr<PreparedStatementTemplate> prepared_statement_template;
+  };
+
+  // Prepared statements are local to the session, as in PostgreSQL. Unlike the prepared plans of the StorageManager,
+  // they can be accessed without synchronization, as the server runs all handlers of a session on the same thread.
+  std::unordered_map<std::string, PreparedStatement> _prepared_statements;
+
+  struct Portal {
+    std::shared_ptr<AbstractOperator> physical_plan;
+    // Resolved to one format per result column once the result is known, see QueryResponseBuilder
+    std::vector<int16_t> result_format_codes;
+  };
+
+  std::unordered_map<std::string, Portal> _portals;
 };
 
 // The corresponding template instantiation takes place in the .cpp
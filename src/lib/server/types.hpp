@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 namespace opossum {
 
 enum class NetworkMessageType : unsigned char {
@@ -20,6 +22,7 @@ enum class NetworkMessageType : unsigned char {
   ReadyForQuery = 'Z',
   RowDescription = 'T',
   DataRow = 'D',
+  CopyInResponse = 'G',
 
   // Errors
   HumanReadableError = 'M',
@@ -35,6 +38,9 @@ enum class NetworkMessageType : unsigned char {
   ParseCommand = 'P',
   SimpleQueryCommand = 'Q',
   CloseCommand = 'C',
+  CopyDataCommand = 'd',
+  CopyDoneCommand = 'c',
+  CopyFailCommand = 'f',
 
   // SSL willingness
   SslYes = 'S',
@@ -48,4 +54,10 @@ enum class TransactionStatusIndicator : unsigned char {
   InFailedTransactionBlock = 'e'
 };
 
+// Format code of a result column, as requested by the client in the Bind message
+enum class ResultFormat : int16_t { Text = 0, Binary = 1 };
+
+// Format of the data of a COPY ... FROM STDIN, see CopyDataParser
+enum class CopyFormat { Text, Csv, Binary };
+
 }  // namespace opossum
@@ -19,9 +19,13 @@ SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionCont
                          const std::shared_ptr<Optimizer>& optimizer,
                          const std::shared_ptr<SQLPhysicalPlanCache>& pqp_cache,
                          const std::shared_ptr<SQLLogicalPlanCache>& lqp_cache,
-                         const CleanupTemporaries cleanup_temporaries)
+                         const std::shared_ptr<SQLResultCache>& result_cache,
+                         const CleanupTemporaries cleanup_temporaries,
+                         const std::optional<float>& reoptimization_threshold,
+                         const std::optional<float>& query_template_threshold)
     : pqp_cache(pqp_cache),
       lqp_cache(lqp_cache),
+      result_cache(result_cache),
       _sql(sql),
       _transaction_context(transaction_context),
       _optimizer(optimizer) {
@@ -83,7 +87,7 @@ SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionCont
 
     auto pipeline_statement = std::make_shared<SQLPipelineStatement>(
         statement_string, std::move(parsed_statement), use_mvcc, transaction_context, lqp_translator, optimizer,
-        pqp_cache, lqp_cache, cleanup_temporaries);
+        pqp_cache, lqp_cache, result_cache, cleanup_temporaries, reoptimization_threshold, query_template_threshold);
     _sql_pipeline_statements.push_back(std::move(pipeline_statement));
   }
 
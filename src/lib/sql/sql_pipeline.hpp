@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 
 #include "SQLParserResult.h"
 #include "concurrency/transaction_context.hpp"
@@ -36,7 +37,10 @@ class SQLPipeline : public Noncopyable {
   SQLPipeline(const std::string& sql, std::shared_ptr<TransactionContext> transaction_context, const UseMvcc use_mvcc,
               const std::shared_ptr<LQPTranslator>& lqp_translator, const std::shared_ptr<Optimizer>& optimizer,
               const std::shared_ptr<SQLPhysicalPlanCache>& pqp_cache,
-              const std::shared_ptr<SQLLogicalPlanCache>& lqp_cache, const CleanupTemporaries cleanup_temporaries);
+              const std::shared_ptr<SQLLogicalPlanCache>& lqp_cache,
+              const std::shared_ptr<SQLResultCache>& result_cache, const CleanupTemporaries cleanup_temporaries,
+              const std::optional<float>& reoptimization_threshold,
+              const std::optional<float>& query_template_threshold);
 
   // Returns the original SQL string
   const std::string get_sql() const;
@@ -88,6 +92,7 @@ class SQLPipeline : public Noncopyable {
 
   const std::shared_ptr<SQLPhysicalPlanCache> pqp_cache;
   const std::shared_ptr<SQLLogicalPlanCache> lqp_cache;
+  const std::shared_ptr<SQLResultCache> result_cache;
 
  private:
   std::string _sql;
@@ -42,6 +42,23 @@ SQLPipelineBuilder& SQLPipelineBuilder::with_lqp_cache(const std::shared_ptr<SQL
   return *this;
 }
 
+SQLPipelineBuilder& SQLPipelineBuilder::with_result_cache(const std::shared_ptr<SQLResultCache>& result_cache) {
+  _result_cache = result_cache;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_reoptimization_threshold(const float q_error_threshold) {
+  Assert(q_error_threshold >= 1.0f, "A q-error is never smaller than 1");
+  _reoptimization_threshold = q_error_threshold;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_query_templates(const float q_error_threshold) {
+  Assert(q_error_threshold >= 1.0f, "A q-error is never smaller than 1");
+  _query_template_threshold = q_error_threshold;
+  return *this;
+}
+
 SQLPipelineBuilder& SQLPipelineBuilder::disable_mvcc() { return with_mvcc(UseMvcc::No); }
 
 SQLPipelineBuilder& SQLPipelineBuilder::dont_cleanup_temporaries() {
@@ -53,8 +70,9 @@ SQLPipeline SQLPipelineBuilder::create_pipeline() const {
   DTRACE_PROBE1(HYRISE, CREATE_PIPELINE, reinterpret_cast<uintptr_t>(this));
   auto lqp_translator = _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>();
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
-  auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, lqp_translator, optimizer, _pqp_cache, _lqp_cache,
-                              _cleanup_temporaries);
+  auto pipeline =
+      SQLPipeline(_sql, _transaction_context, _use_mvcc, lqp_translator, optimizer, _pqp_cache, _lqp_cache,
+                  _result_cache, _cleanup_temporaries, _reoptimization_threshold, _query_template_threshold);
   DTRACE_PROBE3(HYRISE, PIPELINE_CREATION_DONE, pipeline.get_sql_per_statement().size(), _sql.c_str(),
                 reinterpret_cast<uintptr_t>(this));
   return pipeline;
@@ -65,8 +83,18 @@ SQLPipelineStatement SQLPipelineBuilder::create_pipeline_statement(
   auto lqp_translator = _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>();
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
 
-  return {_sql,       std::move(parsed_sql), _use_mvcc, _transaction_context, lqp_translator, optimizer, _pqp_cache,
-          _lqp_cache, _cleanup_temporaries};
+  return {_sql,
+          std::move(parsed_sql),
+          _use_mvcc,
+          _transaction_context,
+          lqp_translator,
+          optimizer,
+          _pqp_cache,
+          _lqp_cache,
+          _result_cache,
+          _cleanup_temporaries,
+          _reoptimization_threshold,
+          _query_template_threshold};
 }
 
 }  // namespace opossum
@@ -1,11 +1,14 @@
 #pragma once
 
+#include <limits>
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "types.hpp"
 
 #include "sql/sql_plan_cache.hpp"
+#include "sql/sql_result_cache.hpp"
 #include "sql_pipeline.hpp"
 #include "sql_pipeline_statement.hpp"
 
@@ -29,6 +32,9 @@ class Optimizer;
  *  - MVCC is enabled
  *  - The default Optimizer (Optimizer::create_default_optimizer()) is used.
  *  - No JIT operators
+ *  - No adaptive re-optimization
+ *  - Plans are cached per SQL string, not per query template
+ *  - No caching of results
  *
  * Favour this interface over calling the SQLPipeline[Statement] constructors with their long parameter list.
  * See SQLPipeline[Statement] doc for these classes, in short SQLPipeline ist for queries with multiple statement,
@@ -52,6 +58,30 @@ class SQLPipelineBuilder final {
   SQLPipelineBuilder& with_pqp_cache(const std::shared_ptr<SQLPhysicalPlanCache>& pqp_cache);
   SQLPipelineBuilder& with_lqp_cache(const std::shared_ptr<SQLLogicalPlanCache>& lqp_cache);
 
+  /**
+   * Serve the results of read-only, auto-committed statements from @param result_cache as long as the tables they read
+   * are not modified, and add the results of such statements to it. See SQLResultCache.
+   */
+  SQLPipelineBuilder& with_result_cache(const std::shared_ptr<SQLResultCache>& result_cache);
+
+  /**
+   * Enable the adaptive re-optimization of queries with multiple joins, see SQLPipelineStatement::get_result_table().
+   * @param q_error_threshold   Maximum factor by which a join's actual row count may deviate from its estimated row
+   *                            count before the rest of the query is re-optimized
+   */
+  SQLPipelineBuilder& with_reoptimization_threshold(const float q_error_threshold);
+
+  /**
+   * Cache plans per query template (see create_sql_query_template()) instead of per SQL string, so that queries that
+   * only differ in the literals of their predicates share their plans. Cached plans are generic, i.e., optimized for
+   * placeholders. They are bound to the literals of the query via AbstractOperator::set_parameters().
+   * @param q_error_threshold   If the row count estimated for the actual literals deviates from the one estimated for
+   *                            the generic plan by more than this factor, the plan is re-optimized for the literals
+   *                            (and not cached). Without a threshold, the generic plan is always used.
+   */
+  SQLPipelineBuilder& with_query_templates(
+      const float q_error_threshold = std::numeric_limits<float>::infinity());
+
   /**
    * Short for with_mvcc(UseMvcc::No)
    */
@@ -79,7 +109,10 @@ class SQLPipelineBuilder final {
   std::shared_ptr<Optimizer> _optimizer;
   std::shared_ptr<SQLPhysicalPlanCache> _pqp_cache;
   std::shared_ptr<SQLLogicalPlanCache> _lqp_cache;
+  std::shared_ptr<SQLResultCache> _result_cache;
   CleanupTemporaries _cleanup_temporaries{true};
+  std::optional<float> _reoptimization_threshold;
+  std::optional<float> _query_template_threshold;
 };
 
 }  // namespace opossum
@@ -2,13 +2,18 @@
 
 #include <boost/algorithm/string.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <iomanip>
+#include <numeric>
 #include <utility>
 
 #include "SQLParser.h"
 #include "concurrency/transaction_manager.hpp"
+#include "constant_mappings.hpp"
 #include "create_sql_parser_error_message.hpp"
 #include "expression/value_expression.hpp"
+#include "logical_query_plan/intermediate_table_node.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
 #include "operators/maintenance/create_prepared_plan.hpp"
 #include "operators/maintenance/create_table.hpp"
@@ -20,6 +25,8 @@
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_plan_cache.hpp"
 #include "sql/sql_translator.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/prepared_plan.hpp"
 #include "storage/storage_manager.hpp"
 #include "utils/assert.hpp"
 #include "utils/tracing/probes.hpp"
@@ -33,9 +40,13 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
                                            const std::shared_ptr<Optimizer>& optimizer,
                                            const std::shared_ptr<SQLPhysicalPlanCache>& pqp_cache,
                                            const std::shared_ptr<SQLLogicalPlanCache>& lqp_cache,
-                                           const CleanupTemporaries cleanup_temporaries)
+                                           const std::shared_ptr<SQLResultCache>& result_cache,
+                                           const CleanupTemporaries cleanup_temporaries,
+                                           const std::optional<float>& reoptimization_threshold,
+                                           const std::optional<float>& query_template_threshold)
     : pqp_cache(pqp_cache),
       lqp_cache(lqp_cache),
+      result_cache(result_cache),
       _sql_string(sql),
       _use_mvcc(use_mvcc),
       _auto_commit(_use_mvcc == UseMvcc::Yes && !transaction_context),
@@ -44,7 +55,9 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
       _optimizer(optimizer),
       _parsed_sql_statement(std::move(parsed_sql)),
       _metrics(std::make_shared<SQLPipelineStatementMetrics>()),
-      _cleanup_temporaries(cleanup_temporaries) {
+      _cleanup_temporaries(cleanup_temporaries),
+      _reoptimization_threshold(reoptimization_threshold),
+      _query_template_threshold(query_template_threshold) {
   Assert(!_parsed_sql_statement || _parsed_sql_statement->size() == 1,
          "SQLPipelineStatement must hold exactly one SQL statement");
   DebugAssert(!_sql_string.empty(), "An SQLPipelineStatement should always contain a SQL statement string for caching");
@@ -52,6 +65,10 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
               "The transaction context cannot have been committed already.");
   DebugAssert(!_transaction_context || use_mvcc == UseMvcc::Yes,
               "Transaction context without MVCC enabled makes no sense");
+
+  if (_query_template_threshold && (pqp_cache || lqp_cache)) {
+    _query_template = create_sql_query_template(_sql_string);
+  }
 }
 
 const std::string& SQLPipelineStatement::get_sql_string() { return _sql_string; }
@@ -106,17 +123,36 @@ const std::shared_ptr<AbstractLQPNode>& SQLPipelineStatement::get_optimized_logi
 
   // Handle logical query plan if statement has been cached
   if (lqp_cache) {
-    if (const auto cached_plan = lqp_cache->try_get(_sql_string)) {
+    if (const auto cached_plan = lqp_cache->try_get(_plan_cache_key())) {
       const auto plan = *cached_plan;
       DebugAssert(plan, "Optimized logical query plan retrieved from cache is empty.");
       // MVCC-enabled and MVCC-disabled LQPs will evict each other
       if (lqp_is_validated(plan) == (_use_mvcc == UseMvcc::Yes)) {
-        _optimized_logical_plan = plan;
+        if (_query_template) {
+          _optimized_template_logical_plan = plan;
+          _optimized_logical_plan = _bind_literals(plan);
+        } else {
+          _optimized_logical_plan = plan;
+        }
         return _optimized_logical_plan;
       }
     }
   }
 
+  // With a query template, the generic LQP is optimized and cached instead of the LQP of the SQL string
+  if (_query_template) {
+    _optimized_template_logical_plan = _optimize_query_template();
+  }
+
+  if (_optimized_template_logical_plan) {
+    if (lqp_cache) {
+      lqp_cache->set(_plan_cache_key(), _optimized_template_logical_plan);
+    }
+
+    _optimized_logical_plan = _bind_literals(_optimized_template_logical_plan);
+    return _optimized_logical_plan;
+  }
+
   const auto& unoptimized_lqp = get_unoptimized_logical_plan();
 
   const auto started = std::chrono::high_resolution_clock::now();
@@ -133,7 +169,7 @@ const std::shared_ptr<AbstractLQPNode>& SQLPipelineStatement::get_optimized_logi
 
   // Cache newly created plan for the according sql statement
   if (lqp_cache) {
-    lqp_cache->set(_sql_string, _optimized_logical_plan);
+    lqp_cache->set(_plan_cache_key(), _optimized_logical_plan);
   }
 
   return _optimized_logical_plan;
@@ -153,9 +189,12 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
   auto started = std::chrono::high_resolution_clock::now();
   auto done = started;  // dummy value needed for initialization
 
+  // Plans that were re-optimized for the literals of a query template are neither taken from nor added to the cache
+  const auto reoptimized_for_literals = _reoptimize_for_literals();
+
   // Try to retrieve the PQP from cache
-  if (pqp_cache) {
-    if (const auto cached_physical_plan = pqp_cache->try_get(_sql_string)) {
+  if (pqp_cache && !reoptimized_for_literals) {
+    if (const auto cached_physical_plan = pqp_cache->try_get(_physical_plan_cache_key())) {
       if ((*cached_physical_plan)->transaction_context_is_set()) {
         Assert(_use_mvcc == UseMvcc::Yes, "Trying to use MVCC cached query without a transaction context.");
       } else {
@@ -163,26 +202,49 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
       }
 
       _physical_plan = (*cached_physical_plan)->deep_copy();
+      if (_query_template) _physical_plan->set_parameters(_literal_parameters());
       _metrics->query_plan_cache_hit = true;
     }
   }
 
+  // For query templates, the generic plan is cached, not the plan with the literals bound
+  auto plan_to_cache = std::shared_ptr<AbstractOperator>{};
+
   if (!_physical_plan) {
     // "Normal" path in which the query plan is created instead of begin retrieved from cache
     const auto& lqp = get_optimized_logical_plan();
 
     // Reset time to exclude previous pipeline steps
     started = std::chrono::high_resolution_clock::now();
-    _physical_plan = _lqp_translator->translate_node(lqp);
+    if (_optimized_template_logical_plan && !reoptimized_for_literals) {
+      // Placeholders cannot be bound in a PQP, parameters of the literals' DataTypes can
+      auto parameter_ids = std::vector<ParameterID>{};
+      auto parameter_data_types = std::vector<DataType>{};
+      for (const auto& [parameter_id, value] : _literal_parameters()) {
+        parameter_ids.emplace_back(parameter_id);
+        parameter_data_types.emplace_back(data_type_from_all_type_variant(value));
+      }
+      const auto generic_lqp =
+          PreparedPlan{_optimized_template_logical_plan, parameter_ids}.instantiate_generic(parameter_data_types);
+      plan_to_cache = _lqp_translator->translate_node(generic_lqp);
+      _physical_plan = plan_to_cache->deep_copy();
+      _physical_plan->set_parameters(_literal_parameters());
+    } else {
+      _physical_plan = _lqp_translator->translate_node(lqp);
+      if (!reoptimized_for_literals) plan_to_cache = _physical_plan;
+    }
   }
 
   done = std::chrono::high_resolution_clock::now();
 
-  if (_use_mvcc == UseMvcc::Yes) _physical_plan->set_transaction_context_recursively(_transaction_context);
+  if (_use_mvcc == UseMvcc::Yes) {
+    _physical_plan->set_transaction_context_recursively(_transaction_context);
+    if (plan_to_cache) plan_to_cache->set_transaction_context_recursively(_transaction_context);
+  }
 
   // Cache newly created plan for the according sql statement (only if not already cached)
-  if (pqp_cache && !_metrics->query_plan_cache_hit) {
-    pqp_cache->set(_sql_string, _physical_plan);
+  if (pqp_cache && plan_to_cache) {
+    pqp_cache->set(_physical_plan_cache_key(), plan_to_cache);
   }
 
   _metrics->lqp_translation_duration = std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
@@ -220,6 +282,40 @@ std::pair<SQLPipelineStatus, const std::shared_ptr<const Table>&> SQLPipelineSta
     return {SQLPipelineStatus::Success, _result_table};
   }
 
+  // The LQP under which the result is added to the result cache. It is copied as the optimized LQP might still change
+  // during execution (e.g., by the adaptive re-optimization).
+  auto result_cache_lqp = std::shared_ptr<AbstractLQPNode>{};
+  if (result_cache && _auto_commit && SQLResultCache::is_cacheable(get_optimized_logical_plan())) {
+    if (!_transaction_context) {
+      _transaction_context = TransactionManager::get().new_transaction_context();
+    }
+
+    const auto& lqp = get_optimized_logical_plan();
+    if (const auto cached_result = result_cache->try_get(lqp, _transaction_context->snapshot_commit_id())) {
+      _result_table = cached_result;
+      _metrics->result_cache_hit = true;
+      _transaction_context->commit();
+      return {SQLPipelineStatus::Success, _result_table};
+    }
+
+    result_cache_lqp = lqp->deep_copy();
+  }
+
+  // The joins executed by the adaptive re-optimization are part of the plan execution. The re-optimizations themselves
+  // are already counted as optimization.
+  auto adaptive_execution_duration = std::chrono::nanoseconds{0};
+  if (_uses_adaptive_reoptimization()) {
+    const auto optimization_duration_before = _metrics->optimization_duration;
+    const auto adaptive_started = std::chrono::high_resolution_clock::now();
+
+    _execute_joins_with_adaptive_reoptimization();
+
+    const auto adaptive_duration = std::chrono::high_resolution_clock::now() - adaptive_started;
+    const auto reoptimization_duration = _metrics->optimization_duration - optimization_duration_before;
+    adaptive_execution_duration =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(adaptive_duration) - reoptimization_duration;
+  }
+
   _precheck_ddl_operators(get_physical_plan());
 
   const auto& tasks = get_tasks();
@@ -245,12 +341,17 @@ std::pair<SQLPipelineStatus, const std::shared_ptr<const Table>&> SQLPipelineSta
   }
 
   const auto done = std::chrono::high_resolution_clock::now();
-  _metrics->plan_execution_duration = std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
+  _metrics->plan_execution_duration =
+      adaptive_execution_duration + std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
 
   // Get output from the last task
   _result_table = tasks.back()->get_operator()->get_output();
   if (!_result_table) _query_has_output = false;
 
+  if (result_cache_lqp && _result_table) {
+    result_cache->set(result_cache_lqp, _result_table, _transaction_context->snapshot_commit_id());
+  }
+
   DTRACE_PROBE8(HYRISE, SUMMARY, _sql_string.c_str(), _metrics->sql_translation_duration.count(),
                 _metrics->optimization_duration.count(), _metrics->lqp_translation_duration.count(),
                 _metrics->plan_execution_duration.count(), _metrics->query_plan_cache_hit, get_tasks().size(),
@@ -307,4 +408,232 @@ void SQLPipelineStatement::_precheck_ddl_operators(const std::shared_ptr<Abstrac
       break;
   }
 }
+
+bool SQLPipelineStatement::_uses_adaptive_reoptimization() {
+  if (!_reoptimization_threshold) return false;
+
+  auto join_count = size_t{0};
+  auto is_supported = true;
+
+  visit_lqp(get_optimized_logical_plan(), [&](const auto& node) {
+    // Executed sub-LQPs are replaced by IntermediateTableNodes. This is only possible if they are not used elsewhere.
+    if (node->output_count() > 1) {
+      is_supported = false;
+      return LQPVisitation::DoNotVisitInputs;
+    }
+
+    switch (node->type) {
+      case LQPNodeType::Join:
+        ++join_count;
+        return LQPVisitation::VisitInputs;
+
+      case LQPNodeType::Aggregate:
+      case LQPNodeType::Alias:
+      case LQPNodeType::DummyTable:
+      case LQPNodeType::Limit:
+      case LQPNodeType::Predicate:
+      case LQPNodeType::Projection:
+      case LQPNodeType::Sort:
+      case LQPNodeType::StoredTable:
+      case LQPNodeType::Validate:
+        return LQPVisitation::VisitInputs;
+
+      default:
+        is_supported = false;
+        return LQPVisitation::DoNotVisitInputs;
+    }
+  });
+
+  // With a single join, there is no join order left to improve once the join has been executed
+  return is_supported && join_count > 1;
+}
+
+void SQLPipelineStatement::_execute_joins_with_adaptive_reoptimization() {
+  // The optimized LQP might be shared with the LQP cache, so we must not modify it
+  auto lqp = get_optimized_logical_plan()->deep_copy();
+
+  if (!_transaction_context && _use_mvcc == UseMvcc::Yes) {
+    _transaction_context = TransactionManager::get().new_transaction_context();
+  }
+
+  const auto contains_join = [](const std::shared_ptr<AbstractLQPNode>& sub_lqp) {
+    auto found_join = false;
+    visit_lqp(sub_lqp, [&](const auto& node) {
+      found_join |= node->type == LQPNodeType::Join;
+      return found_join ? LQPVisitation::DoNotVisitInputs : LQPVisitation::VisitInputs;
+    });
+    return found_join;
+  };
+
+  while (true) {
+    auto join_count = size_t{0};
+    auto lowest_join_nodes = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+    visit_lqp(lqp, [&](const auto& node) {
+      if (node->type != LQPNodeType::Join) return LQPVisitation::VisitInputs;
+
+      ++join_count;
+      if (!contains_join(node->left_input()) && !contains_join(node->right_input())) {
+        lowest_join_nodes.emplace_back(node);
+      }
+      return LQPVisitation::VisitInputs;
+    });
+
+    if (join_count < 2) break;
+
+    // Execute all lowest joins (i.e., those without joins in their inputs) at once. As the LQP has no diamond shapes,
+    // their sub-plans do not share any operators.
+    auto join_operators = std::vector<std::shared_ptr<AbstractOperator>>{};
+    auto tasks = std::vector<std::shared_ptr<OperatorTask>>{};
+    for (const auto& join_node : lowest_join_nodes) {
+      const auto& join_operator = join_operators.emplace_back(_lqp_translator->translate_node(join_node));
+      if (_use_mvcc == UseMvcc::Yes) join_operator->set_transaction_context_recursively(_transaction_context);
+
+      const auto join_tasks = OperatorTask::make_tasks_from_operator(join_operator, _cleanup_temporaries);
+      tasks.insert(tasks.end(), join_tasks.begin(), join_tasks.end());
+    }
+
+    CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+    // Replace the executed joins with their results and check the estimations
+    auto cardinality_misestimated = false;
+    for (auto join_idx = size_t{0}; join_idx < lowest_join_nodes.size(); ++join_idx) {
+      const auto& join_node = lowest_join_nodes[join_idx];
+
+      const auto intermediate_table_node =
+          IntermediateTableNode::make(join_node, join_operators[join_idx]->get_output());
+      for (const auto& [output, input_side] : join_node->output_relations()) {
+        output->set_input(input_side, intermediate_table_node);
+      }
+
+      const auto estimated_row_count = join_node->get_statistics()->row_count();
+      const auto actual_row_count = static_cast<float>(intermediate_table_node->table->row_count());
+      const auto q_error = std::max(estimated_row_count, actual_row_count) /
+                           std::max(std::min(estimated_row_count, actual_row_count), 1.0f);
+      cardinality_misestimated |= q_error > *_reoptimization_threshold;
+    }
+
+    if (cardinality_misestimated) {
+      const auto started = std::chrono::high_resolution_clock::now();
+
+      lqp = _optimizer->optimize(lqp);
+      ++_metrics->reoptimization_count;
+
+      const auto done = std::chrono::high_resolution_clock::now();
+      _metrics->optimization_duration += std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
+    }
+  }
+
+  // Translate the remainder of the LQP. As _physical_plan is set, get_physical_plan() will neither look it up in nor
+  // add it to the PQP cache - it contains the materialized intermediate results.
+  _physical_plan = _lqp_translator->translate_node(lqp);
+  if (_use_mvcc == UseMvcc::Yes) _physical_plan->set_transaction_context_recursively(_transaction_context);
+
+  // Tasks that get_tasks() created before belong to the replaced plan
+  _tasks.clear();
+}
+
+const std::string& SQLPipelineStatement::_plan_cache_key() const {
+  return _query_template ? _query_template->sql : _sql_string;
+}
+
+std::string SQLPipelineStatement::_physical_plan_cache_key() const {
+  if (!_query_template) return _sql_string;
+
+  auto key = _query_template->sql;
+  for (const auto& parameter : _query_template->parameters) {
+    key += ' ' + data_type_to_string.left.at(data_type_from_all_type_variant(parameter));
+  }
+  return key;
+}
+
+std::shared_ptr<AbstractLQPNode> SQLPipelineStatement::_optimize_query_template() {
+  DebugAssert(_query_template, "Expected a query template");
+
+  const auto started = std::chrono::high_resolution_clock::now();
+
+  auto parse_result = hsql::SQLParserResult{};
+  hsql::SQLParser::parse(_query_template->sql, &parse_result);
+
+  // The literals are bound by their position, i.e., the placeholder of the i-th literal must have ParameterID i. This
+  // does not hold if other ParameterIDs (e.g., for correlated subqueries) are allocated in between. In that case, or if
+  // the template is not a valid statement after all, the plans are cached for the SQL string instead.
+  auto template_lqp = std::shared_ptr<AbstractLQPNode>{};
+  if (parse_result.isValid() && parse_result.size() == 1) {
+    SQLTranslator sql_translator{_use_mvcc};
+    template_lqp = sql_translator.translate_parser_result(parse_result).front();
+
+    auto expected_parameter_ids = std::vector<ParameterID>(_query_template->parameters.size());
+    std::iota(expected_parameter_ids.begin(), expected_parameter_ids.end(), ParameterID{0});
+    if (sql_translator.parameter_ids_of_value_placeholders() != expected_parameter_ids) template_lqp = nullptr;
+  }
+
+  if (!template_lqp) {
+    _query_template.reset();
+    return nullptr;
+  }
+
+  const auto translated = std::chrono::high_resolution_clock::now();
+  _metrics->sql_translation_duration = std::chrono::duration_cast<std::chrono::nanoseconds>(translated - started);
+
+  const auto optimized_template_lqp = _optimizer->optimize(template_lqp);
+
+  const auto done = std::chrono::high_resolution_clock::now();
+  _metrics->optimization_duration = std::chrono::duration_cast<std::chrono::nanoseconds>(done - translated);
+
+  return optimized_template_lqp;
+}
+
+std::unordered_map<ParameterID, AllTypeVariant> SQLPipelineStatement::_literal_parameters() const {
+  auto parameters = std::unordered_map<ParameterID, AllTypeVariant>{};
+  for (auto parameter_idx = size_t{0}; parameter_idx < _query_template->parameters.size(); ++parameter_idx) {
+    parameters.emplace(ParameterID{static_cast<ParameterID::base_type>(parameter_idx)},
+                       _query_template->parameters[parameter_idx]);
+  }
+  return parameters;
+}
+
+std::shared_ptr<AbstractLQPNode> SQLPipelineStatement::_bind_literals(
+    const std::shared_ptr<AbstractLQPNode>& lqp) const {
+  auto parameter_ids = std::vector<ParameterID>{};
+  auto values = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (const auto& [parameter_id, value] : _literal_parameters()) {
+    parameter_ids.emplace_back(parameter_id);
+    values.emplace_back(std::make_shared<ValueExpression>(value));
+  }
+
+  return PreparedPlan{lqp, parameter_ids}.instantiate(values);
+}
+
+bool SQLPipelineStatement::_reoptimize_for_literals() {
+  if (!_query_template || std::isinf(*_query_template_threshold)) return false;
+
+  const auto lqp = get_optimized_logical_plan();
+  if (!_optimized_template_logical_plan) return false;
+
+  // Estimating the row count requires statistics for all leaves of the LQP
+  auto has_statistics = true;
+  visit_lqp(lqp, [&](const auto& node) {
+    has_statistics &= node->type != LQPNodeType::DummyTable;
+    return has_statistics ? LQPVisitation::VisitInputs : LQPVisitation::DoNotVisitInputs;
+  });
+  if (!has_statistics) return false;
+
+  const auto generic_row_count = _optimized_template_logical_plan->get_statistics()->row_count();
+  const auto row_count = lqp->get_statistics()->row_count();
+  const auto q_error =
+      std::max(generic_row_count, row_count) / std::max(std::min(generic_row_count, row_count), 1.0f);
+  if (q_error <= *_query_template_threshold) return false;
+
+  const auto started = std::chrono::high_resolution_clock::now();
+
+  // The LQP with the literals bound is a copy that is not shared with the LQP cache
+  _optimized_logical_plan = _optimizer->optimize(lqp);
+  _metrics->reoptimized_for_literals = true;
+
+  const auto done = std::chrono::high_resolution_clock::now();
+  _metrics->optimization_duration += std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
+
+  return true;
+}
+
 }  // namespace opossum
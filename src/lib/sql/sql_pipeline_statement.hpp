@@ -1,6 +1,8 @@
 #pragma once
 
+#include <optional>
 #include <string>
+#include <unordered_map>
 
 #include "SQLParserResult.h"
 #include "cache/cache.hpp"
@@ -8,6 +10,8 @@
 #include "logical_query_plan/lqp_translator.hpp"
 #include "optimizer/optimizer.hpp"
 #include "sql_plan_cache.hpp"
+#include "sql_query_template.hpp"
+#include "sql_result_cache.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
@@ -20,6 +24,13 @@ struct SQLPipelineStatementMetrics {
   std::chrono::nanoseconds plan_execution_duration{};
 
   bool query_plan_cache_hit = false;
+  bool result_cache_hit = false;
+
+  // Number of times the LQP was re-optimized during execution, see SQLPipelineStatement::get_result_table()
+  size_t reoptimization_count = 0;
+
+  // Whether the generic plan of the statement's query template was re-optimized for the statement's literals
+  bool reoptimized_for_literals = false;
 };
 
 enum class SQLPipelineStatus {
@@ -42,6 +53,17 @@ enum class SQLPipelineStatus {
  * NOTE:
  *  If a physical plan for an SQL statement is in the SQLPhysicalPlanCache, it will be used instead of translating the optimized
  *  LQP (get_optimized_logical_plans()) into a PQP. Thus, in this case, the optimized LQP and PQP could be different.
+ *
+ * NOTE:
+ *  If query templates are enabled, plans are cached under the query template of the statement (see
+ *  create_sql_query_template()) instead of its SQL string. The cached LQP contains placeholders, the cached PQP
+ *  contains parameters in their place (see PreparedPlan::instantiate_generic()). The plans of the statement are
+ *  copies of them with the statement's literals bound.
+ *
+ * NOTE:
+ *  If an SQLResultCache is given, get_result_table() serves the results of read-only statements from it and does not
+ *  execute the PQP on a hit. For simplicity, only auto-committed statements use it, as these cannot have modified the
+ *  tables they read themselves.
  */
 class SQLPipelineStatement : public Noncopyable {
  public:
@@ -52,7 +74,10 @@ class SQLPipelineStatement : public Noncopyable {
                        const std::shared_ptr<Optimizer>& optimizer,
                        const std::shared_ptr<SQLPhysicalPlanCache>& pqp_cache,
                        const std::shared_ptr<SQLLogicalPlanCache>& lqp_cache,
-                       const CleanupTemporaries cleanup_temporaries);
+                       const std::shared_ptr<SQLResultCache>& result_cache,
+                       const CleanupTemporaries cleanup_temporaries,
+                       const std::optional<float>& reoptimization_threshold,
+                       const std::optional<float>& query_template_threshold);
 
   // Returns the raw SQL string.
   const std::string& get_sql_string();
@@ -81,6 +106,14 @@ class SQLPipelineStatement : public Noncopyable {
   // The transaction status is somewhat redundant, as it could also be retrieved from the transaction_context. We
   // explicitly return it as part of get_result_table to force the caller to take the possibility of a failed
   // transaction into account.
+  //
+  // If a reoptimization_threshold is set, read-only queries with multiple joins are executed adaptively: The lowest
+  // joins are executed first and their actual row counts are compared to the estimated ones. If the q-error (i.e.,
+  // max(actual, estimated) / min(actual, estimated)) of any of them exceeds the threshold, the remaining LQP is
+  // re-optimized, with the already materialized joins being represented by IntermediateTableNodes. This is repeated
+  // until only one join is left. Only the tasks for the remaining plan are returned by get_tasks() afterwards, even if
+  // get_tasks() or get_physical_plan() were called before. The execution of the joins is part of the
+  // plan_execution_duration, their re-optimization part of the optimization_duration.
   std::pair<SQLPipelineStatus, const std::shared_ptr<const Table>&> get_result_table();
 
   // Returns the TransactionContext that was either passed to or created by the SQLPipelineStatement.
@@ -91,6 +124,7 @@ class SQLPipelineStatement : public Noncopyable {
 
   const std::shared_ptr<SQLPhysicalPlanCache> pqp_cache;
   const std::shared_ptr<SQLLogicalPlanCache> lqp_cache;
+  const std::shared_ptr<SQLResultCache> result_cache;
 
  private:
   // Performs a sanity check in order to prevent an execution of a predictably failing DDL operator (e.g., creating a
@@ -98,6 +132,34 @@ class SQLPipelineStatement : public Noncopyable {
   // Throws an InvalidInputException if an invalid PQP is detected.
   void _precheck_ddl_operators(const std::shared_ptr<AbstractOperator>& pqp) const;
 
+  // Returns whether the adaptive re-optimization is enabled and can be applied to the optimized LQP. This is the case
+  // for read-only LQPs without diamond shapes that contain at least two joins.
+  bool _uses_adaptive_reoptimization();
+
+  // Executes the joins of the optimized LQP bottom-up, re-optimizes the LQP whenever a join's cardinality was
+  // misestimated, and sets _physical_plan to the translation of the not yet executed part of the LQP.
+  void _execute_joins_with_adaptive_reoptimization();
+
+  // The key of the statement's plans in the plan caches: The query template if there is one, the SQL string otherwise
+  const std::string& _plan_cache_key() const;
+
+  // The key of the statement's PQP in the plan cache. The PQP of a query template has parameters of the DataTypes of
+  // the literals in place of the placeholders, so these DataTypes are part of the key.
+  std::string _physical_plan_cache_key() const;
+
+  // Translates and optimizes the query template. Returns nullptr and drops the template if it cannot be used.
+  std::shared_ptr<AbstractLQPNode> _optimize_query_template();
+
+  // The literals of the query template by the ParameterIDs of their placeholders
+  std::unordered_map<ParameterID, AllTypeVariant> _literal_parameters() const;
+
+  // Returns a copy of the generic LQP with the literals bound
+  std::shared_ptr<AbstractLQPNode> _bind_literals(const std::shared_ptr<AbstractLQPNode>& lqp) const;
+
+  // Re-optimizes the optimized LQP if the row count estimated for the literals deviates from the one estimated for the
+  // generic LQP by more than _query_template_threshold. Returns whether the LQP was re-optimized.
+  bool _reoptimize_for_literals();
+
   const std::string _sql_string;
   const UseMvcc _use_mvcc;
 
@@ -124,6 +186,18 @@ class SQLPipelineStatement : public Noncopyable {
 
   // Delete temporary tables
   const CleanupTemporaries _cleanup_temporaries;
+
+  // Maximum q-error of a join's cardinality estimation before the LQP is re-optimized. No adaptive re-optimization if
+  // unset.
+  const std::optional<float> _reoptimization_threshold;
+
+  // Maximum q-error between the estimations for the generic plan and the literals before a plan is re-optimized. No
+  // query templates are used if unset.
+  const std::optional<float> _query_template_threshold;
+  std::optional<SQLQueryTemplate> _query_template;
+
+  // The optimized LQP of the query template, _optimized_logical_plan is a copy of it with the literals bound
+  std::shared_ptr<AbstractLQPNode> _optimized_template_logical_plan;
 };
 
 }  // namespace opossum
@@ -0,0 +1,190 @@
+#include "sql_query_template.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <optional>
+#include <string>
+#include <unordered_set>
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+bool is_digit(const char character) { return std::isdigit(static_cast<unsigned char>(character)); }
+
+bool is_identifier_char(const char character) {
+  return std::isalnum(static_cast<unsigned char>(character)) || character == '_';
+}
+
+// Literals following these tokens are compared to something else. "BETWEEN AND" stands for the AND of a BETWEEN.
+const auto comparison_tokens =
+    std::unordered_set<std::string>{"=", "<", ">", "<=", ">=", "<>", "!=", "LIKE", "BETWEEN", "BETWEEN AND"};
+
+// Converts numeric literals to the same types as the SQLTranslator does: Integers become int32_t if they fit and
+// int64_t otherwise, literals with a decimal point become doubles. Integers that do not fit into int64_t are not
+// extracted.
+std::optional<AllTypeVariant> numeric_literal_value(const std::string& literal, const bool is_integer) {
+  if (!is_integer) return AllTypeVariant{std::strtod(literal.c_str(), nullptr)};
+
+  errno = 0;
+  const auto value = static_cast<int64_t>(std::strtoll(literal.c_str(), nullptr, 10));
+  if (errno == ERANGE) return std::nullopt;
+
+  if (static_cast<int32_t>(value) == value) return AllTypeVariant{static_cast<int32_t>(value)};
+  return AllTypeVariant{value};
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::optional<SQLQueryTemplate> create_sql_query_template(const std::string& sql) {
+  auto query_template = SQLQueryTemplate{};
+  query_template.sql.reserve(sql.size());
+
+  const auto size = sql.size();
+
+  // Literals that are combined with other values (e.g., `a > 5 + b`) need their DataType during translation
+  const auto is_followed_by_operator = [&](auto position) {
+    while (position < size) {
+      if (std::isspace(static_cast<unsigned char>(sql[position]))) {
+        ++position;
+      } else if (sql.compare(position, 2, "--") == 0) {
+        position = std::min(sql.find('\n', position), size);
+      } else if (sql.compare(position, 2, "/*") == 0) {
+        const auto comment_end = sql.find("*/", position + 2);
+        position = comment_end == std::string::npos ? size : comment_end + 2;
+      } else {
+        break;
+      }
+    }
+    return position < size && std::string{"+-*/%|"}.find(sql[position]) != std::string::npos;
+  };
+
+  auto first_token = std::optional<std::string>{};
+  auto follows_comparison = false;
+  auto awaiting_between_and = false;
+
+  auto position = size_t{0};
+  while (position < size) {
+    const auto character = sql[position];
+
+    /**
+     * Whitespace and comments are copied as they are and do not change the context
+     */
+    if (std::isspace(static_cast<unsigned char>(character))) {
+      query_template.sql += character;
+      ++position;
+      continue;
+    }
+
+    if (sql.compare(position, 2, "--") == 0 || sql.compare(position, 2, "/*") == 0) {
+      const auto is_line_comment = sql[position + 1] == '-';
+      const auto comment_end = sql.find(is_line_comment ? "\n" : "*/", position + 2);
+      const auto end = comment_end == std::string::npos ? size : comment_end + (is_line_comment ? 0 : 2);
+      query_template.sql.append(sql, position, end - position);
+      position = end;
+      continue;
+    }
+
+    /**
+     * Determine the next token and, if it is a literal, its value
+     */
+    auto token = std::string{};
+    auto token_end = position + 1;
+    auto literal = std::optional<AllTypeVariant>{};
+
+    if (character == '\'') {
+      // String literal, quotes within it are escaped by doubling them
+      auto value = pmr_string{};
+      while (true) {
+        // Leave unterminated literals to the SQL parser's error handling
+        if (token_end >= size) return std::nullopt;
+
+        if (sql[token_end] == '\'') {
+          if (token_end + 1 < size && sql[token_end + 1] == '\'') {
+            value += '\'';
+            token_end += 2;
+            continue;
+          }
+          ++token_end;
+          break;
+        }
+
+        value += sql[token_end];
+        ++token_end;
+      }
+      literal = AllTypeVariant{value};
+    } else if (character == '"' || character == '`') {
+      // Quoted identifier
+      const auto closing_quote = sql.find(character, position + 1);
+      if (closing_quote == std::string::npos) return std::nullopt;
+      token_end = closing_quote + 1;
+      token = "IDENTIFIER";
+    } else if (is_digit(character) || (character == '.' && position + 1 < size && is_digit(sql[position + 1]))) {
+      token_end = position;
+      while (token_end < size && is_digit(sql[token_end])) ++token_end;
+
+      auto is_integer = true;
+      if (token_end < size && sql[token_end] == '.') {
+        is_integer = false;
+        ++token_end;
+        while (token_end < size && is_digit(sql[token_end])) ++token_end;
+      }
+
+      if (token_end < size && (is_identifier_char(sql[token_end]) || sql[token_end] == '.')) {
+        // Not a plain numeric literal (e.g., `1e5`), leave it as it is
+        while (token_end < size && (is_identifier_char(sql[token_end]) || sql[token_end] == '.')) ++token_end;
+        token = "IDENTIFIER";
+      } else {
+        literal = numeric_literal_value(sql.substr(position, token_end - position), is_integer);
+        if (!literal) token = "IDENTIFIER";
+      }
+    } else if (is_identifier_char(character)) {
+      while (token_end < size && is_identifier_char(sql[token_end])) ++token_end;
+      token = sql.substr(position, token_end - position);
+      std::transform(token.begin(), token.end(), token.begin(), [](const auto c) { return std::toupper(c); });
+    } else if (character == '?') {
+      // The statement is already parameterized (and needs parameters we do not have)
+      return std::nullopt;
+    } else {
+      for (const auto* const two_character_operator : {"<=", ">=", "<>", "!=", "||"}) {
+        if (sql.compare(position, 2, two_character_operator) == 0) token_end = position + 2;
+      }
+      token = sql.substr(position, token_end - position);
+    }
+
+    /**
+     * Replace the literal by a placeholder or copy the token
+     */
+    if (literal && follows_comparison && !is_followed_by_operator(token_end)) {
+      query_template.sql += '?';
+      query_template.parameters.emplace_back(*literal);
+    } else {
+      query_template.sql.append(sql, position, token_end - position);
+    }
+
+    if (!first_token) {
+      first_token = token;
+      if (*first_token != "SELECT") return std::nullopt;
+    }
+
+    if (token == "BETWEEN") {
+      awaiting_between_and = true;
+    } else if (token == "AND" && awaiting_between_and) {
+      awaiting_between_and = false;
+      token = "BETWEEN AND";
+    }
+    follows_comparison = comparison_tokens.count(token) > 0;
+
+    position = token_end;
+  }
+
+  if (query_template.parameters.empty()) return std::nullopt;
+
+  return query_template;
+}
+
+}  // namespace opossum
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+
+namespace opossum {
+
+/**
+ * A query template is an SQL string in which literals have been replaced by value placeholders ("?"). Queries that
+ * only differ in these literals share the same template and can thus share cached query plans. `parameters` holds the
+ * extracted literals, in the order of the placeholders.
+ */
+struct SQLQueryTemplate {
+  std::string sql;
+  std::vector<AllTypeVariant> parameters;
+};
+
+/**
+ * Creates the query template of a SELECT statement by extracting the literals that are compared to something else,
+ * i.e., that directly follow a comparison operator, LIKE or BETWEEN/AND and are not part of an arithmetic expression.
+ * Other literals (e.g., in the SELECT list, in LIMIT or in CAST) are left untouched, as placeholders do not have a
+ * DataType and the SQL translation relies on it there.
+ *
+ * This works on the SQL string, so that the parsed statement is not needed for the plan cache lookup.
+ *
+ * @return std::nullopt if `sql` is not a SELECT statement, has no such literals or already contains placeholders
+ */
+std::optional<SQLQueryTemplate> create_sql_query_template(const std::string& sql);
+
+}  // namespace opossum
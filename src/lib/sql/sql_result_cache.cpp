@@ -0,0 +1,198 @@
+#include "sql_result_cache.hpp"
+
+#include <iterator>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Calls @param visitor for all StoredTableNodes in the LQP, including those in subqueries
+template <typename Visitor>
+void visit_stored_table_nodes(const std::shared_ptr<AbstractLQPNode>& lqp, Visitor visitor) {
+  for (const auto& subplan_root : lqp_find_subplan_roots(lqp)) {
+    visit_lqp(subplan_root, [&](const auto& node) {
+      if (node->type == LQPNodeType::StoredTable) visitor(static_cast<const StoredTableNode&>(*node));
+      return LQPVisitation::VisitInputs;
+    });
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+SQLResultCache::SQLResultCache(const size_t memory_budget) : _memory_budget(memory_budget) {}
+
+bool SQLResultCache::is_cacheable(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto cacheable = true;
+
+  for (const auto& subplan_root : lqp_find_subplan_roots(lqp)) {
+    visit_lqp(subplan_root, [&](const auto& node) {
+      switch (node->type) {
+        // Nodes that only read data
+        case LQPNodeType::Aggregate:
+        case LQPNodeType::Alias:
+        case LQPNodeType::DummyTable:
+        case LQPNodeType::Join:
+        case LQPNodeType::Limit:
+        case LQPNodeType::Predicate:
+        case LQPNodeType::Projection:
+        case LQPNodeType::Root:
+        case LQPNodeType::Sort:
+        case LQPNodeType::Union:
+        case LQPNodeType::Validate:
+          break;
+
+        // Only modifications of tables with MVCC are tracked
+        case LQPNodeType::StoredTable: {
+          const auto& table_name = static_cast<const StoredTableNode&>(*node).table_name;
+          const auto& storage_manager = StorageManager::get();
+          cacheable &= storage_manager.has_table(table_name) &&
+                       storage_manager.get_table(table_name)->has_mvcc() == UseMvcc::Yes;
+        } break;
+
+        default:
+          cacheable = false;
+      }
+
+      return cacheable ? LQPVisitation::VisitInputs : LQPVisitation::DoNotVisitInputs;
+    });
+
+    if (!cacheable) return false;
+  }
+
+  return true;
+}
+
+std::shared_ptr<const Table> SQLResultCache::try_get(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                                     const CommitID snapshot_commit_id) {
+  const auto& storage_manager = StorageManager::get();
+  const auto lqp_hash = lqp->hash();
+
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  const auto [begin, end] = _entries_by_lqp_hash.equal_range(lqp_hash);
+  for (auto iter = begin; iter != end; ++iter) {
+    const auto entry_iter = iter->second;
+    if (*entry_iter->lqp != *lqp) continue;
+
+    auto is_visible = true;
+    for (const auto& [table_name, weak_table] : entry_iter->tables) {
+      const auto table = weak_table.lock();
+      const auto is_stale = !table || !storage_manager.has_table(table_name) ||
+                            storage_manager.get_table(table_name) != table ||
+                            table->last_modified_commit_id() > entry_iter->snapshot_commit_id;
+      if (is_stale) {
+        // The result will never be valid again
+        _erase(entry_iter);
+        return nullptr;
+      }
+
+      // The requesting transaction does not see the latest modification (and the result includes it)
+      is_visible &= table->last_modified_commit_id() <= snapshot_commit_id;
+    }
+
+    if (!is_visible) return nullptr;
+
+    _entries.splice(_entries.begin(), _entries, entry_iter);
+    return entry_iter->result;
+  }
+
+  return nullptr;
+}
+
+void SQLResultCache::set(const std::shared_ptr<AbstractLQPNode>& lqp, const std::shared_ptr<const Table>& result,
+                         const CommitID snapshot_commit_id) {
+  DebugAssert(is_cacheable(lqp), "Result of LQP cannot be cached");
+
+  const auto lqp_hash = lqp->hash();
+  auto entry = Entry{lqp, lqp_hash, result, snapshot_commit_id, result->estimate_memory_usage(), {}};
+
+  // A table might have been dropped since the LQP was executed
+  auto tables_exist = true;
+  const auto& storage_manager = StorageManager::get();
+  visit_stored_table_nodes(lqp, [&](const auto& stored_table_node) {
+    if (!storage_manager.has_table(stored_table_node.table_name)) {
+      tables_exist = false;
+      return;
+    }
+    entry.tables.emplace_back(stored_table_node.table_name, storage_manager.get_table(stored_table_node.table_name));
+  });
+  if (!tables_exist) return;
+
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  if (entry.memory_usage > _memory_budget) return;
+
+  // Replace an older result of the same LQP
+  const auto [begin, end] = _entries_by_lqp_hash.equal_range(lqp_hash);
+  for (auto iter = begin; iter != end; ++iter) {
+    if (*iter->second->lqp != *lqp) continue;
+    if (iter->second->snapshot_commit_id > snapshot_commit_id) return;
+
+    _erase(iter->second);
+    break;
+  }
+
+  _evict_until(_memory_budget - entry.memory_usage);
+
+  _memory_usage += entry.memory_usage;
+  _entries.emplace_front(std::move(entry));
+  _entries_by_lqp_hash.emplace(lqp_hash, _entries.begin());
+}
+
+size_t SQLResultCache::size() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _entries.size();
+}
+
+void SQLResultCache::clear() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _entries.clear();
+  _entries_by_lqp_hash.clear();
+  _memory_usage = 0;
+}
+
+size_t SQLResultCache::memory_usage() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _memory_usage;
+}
+
+size_t SQLResultCache::memory_budget() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _memory_budget;
+}
+
+void SQLResultCache::set_memory_budget(const size_t memory_budget) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _memory_budget = memory_budget;
+  _evict_until(memory_budget);
+}
+
+void SQLResultCache::_erase(const EntryList::iterator entry_iter) {
+  const auto [begin, end] = _entries_by_lqp_hash.equal_range(entry_iter->lqp_hash);
+  for (auto iter = begin; iter != end; ++iter) {
+    if (iter->second != entry_iter) continue;
+    _entries_by_lqp_hash.erase(iter);
+    break;
+  }
+
+  _memory_usage -= entry_iter->memory_usage;
+  _entries.erase(entry_iter);
+}
+
+void SQLResultCache::_evict_until(const size_t memory_budget) {
+  while (_memory_usage > memory_budget) {
+    DebugAssert(!_entries.empty(), "Memory usage without entries");
+    _erase(std::prev(_entries.end()));
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class Table;
+
+/**
+ * Caches the results of read-only statements, keyed on their optimized LQP. A cached result is only served while it
+ * is what executing the LQP would return, i.e., as long as none of the tables read by the LQP was modified by a
+ * transaction that is not visible to both the transaction that computed the result and the one requesting it. For
+ * this, each Table tracks the CommitID of its latest modification (see Table::last_modified_commit_id()). Entries
+ * that became stale are removed on lookup.
+ *
+ * The memory used by the cached results (as estimated by Table::estimate_memory_usage()) is limited to a budget. Once
+ * it is exceeded, the least recently used entries are evicted.
+ *
+ * This class is thread-safe.
+ */
+class SQLResultCache : private Noncopyable {
+ public:
+  static constexpr size_t DEFAULT_MEMORY_BUDGET = 256 * 1024 * 1024;
+
+  explicit SQLResultCache(const size_t memory_budget = DEFAULT_MEMORY_BUDGET);
+
+  // Returns true if the result of the LQP only depends on the data of tables that use MVCC, i.e., if it can be cached
+  static bool is_cacheable(const std::shared_ptr<AbstractLQPNode>& lqp);
+
+  // Returns the result of an LQP equal to @param lqp if it is valid for a transaction with @param snapshot_commit_id
+  std::shared_ptr<const Table> try_get(const std::shared_ptr<AbstractLQPNode>& lqp, const CommitID snapshot_commit_id);
+
+  // Adds the result of @param lqp, computed by a transaction with @param snapshot_commit_id. The cache takes ownership
+  // of the LQP, which must not be modified afterwards.
+  void set(const std::shared_ptr<AbstractLQPNode>& lqp, const std::shared_ptr<const Table>& result,
+           const CommitID snapshot_commit_id);
+
+  size_t size() const;
+  void clear();
+
+  size_t memory_usage() const;
+  size_t memory_budget() const;
+
+  // Evicts entries until the cached results fit into the new budget
+  void set_memory_budget(const size_t memory_budget);
+
+ private:
+  struct Entry {
+    std::shared_ptr<AbstractLQPNode> lqp;
+    size_t lqp_hash;
+    std::shared_ptr<const Table> result;
+    CommitID snapshot_commit_id;
+    size_t memory_usage;
+
+    // The tables read by the LQP, to detect them being dropped or replaced by a table of the same name
+    std::vector<std::pair<std::string, std::weak_ptr<const Table>>> tables;
+  };
+
+  // Most recently used first
+  using EntryList = std::list<Entry>;
+
+  void _erase(const EntryList::iterator entry_iter);
+  void _evict_until(const size_t memory_budget);
+
+  EntryList _entries;
+  std::unordered_multimap<size_t, EntryList::iterator> _entries_by_lqp_hash;
+
+  size_t _memory_usage{0};
+  size_t _memory_budget;
+
+  mutable std::mutex _mutex;
+};
+
+}  // namespace opossum
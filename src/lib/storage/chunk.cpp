@@ -41,6 +41,7 @@ Chunk::Chunk(Segments segments, const std::shared_ptr<MvccData>& mvcc_data,
 #endif
 
   if (alloc) _alloc = *alloc;
+  _reserved_row_count = size();
 }
 
 bool Chunk::is_mutable() const { return _is_mutable; }
@@ -69,6 +70,22 @@ void Chunk::append(const std::vector<AllTypeVariant>& values) {
     DebugAssert(base_value_segment, "Can't append to segment that is not a ValueSegment");
     base_value_segment->append(*value_it);
   }
+
+  ++_reserved_row_count;
+}
+
+std::pair<ChunkOffset, ChunkOffset> Chunk::reserve_rows(const ChunkOffset row_count, const ChunkOffset max_size) {
+  DebugAssert(is_mutable(), "Can't reserve rows in immutable Chunk");
+
+  // A compare-and-swap loop instead of a fetch-add, so that the counter never exceeds max_size and cannot overflow
+  auto begin_offset = _reserved_row_count.load();
+  auto reserved_row_count = ChunkOffset{0};
+  do {
+    if (begin_offset >= max_size) return {begin_offset, 0};
+    reserved_row_count = std::min(row_count, static_cast<ChunkOffset>(max_size - begin_offset));
+  } while (!_reserved_row_count.compare_exchange_weak(begin_offset, begin_offset + reserved_row_count));
+
+  return {begin_offset, reserved_row_count};
 }
 
 std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const {
@@ -11,6 +11,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "all_type_variant.hpp"
@@ -67,6 +68,13 @@ class Chunk : private Noncopyable {
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(const std::vector<AllTypeVariant>& values);
 
+  /**
+   * Atomically reserves up to row_count rows at the end of this mutable chunk, which may hold at most max_size rows.
+   * Returns the offset of the first reserved row and the number of reserved rows, which is zero if the chunk is full.
+   * The reservation does not grow the chunk, see Insert for how the reserved rows are added.
+   */
+  std::pair<ChunkOffset, ChunkOffset> reserve_rows(ChunkOffset row_count, ChunkOffset max_size);
+
   /**
    * Atomically accesses and returns the segment at a given position
    *
@@ -184,6 +192,7 @@ class Chunk : private Noncopyable {
   pmr_vector<std::shared_ptr<BaseIndex>> _indices;
   std::shared_ptr<ChunkStatistics> _statistics;
   bool _is_mutable = true;
+  std::atomic<ChunkOffset> _reserved_row_count{0};
   std::optional<std::pair<ColumnID, OrderByMode>> _ordered_by;
   mutable std::atomic_uint64_t _invalid_row_count = 0;
   std::optional<CommitID> _cleanup_commit_id;
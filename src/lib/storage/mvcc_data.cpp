@@ -1,5 +1,6 @@
 #include "mvcc_data.hpp"
 
+#include <mutex>
 #include <shared_mutex>
 
 #include "concurrency/transaction_manager.hpp"
@@ -44,6 +45,12 @@ void MvccData::grow_by(size_t delta, TransactionID transaction_id, CommitID begi
   end_cids.grow_to_at_least(_size, MAX_COMMIT_ID);
 }
 
+void MvccData::reserve(size_t capacity) {
+  tids.reserve(capacity);
+  begin_cids.reserve(capacity);
+  end_cids.reserve(capacity);
+}
+
 std::ostream& operator<<(std::ostream& stream, const MvccData& mvcc_data) {
   stream << "TIDs: ";
   for (const auto& tid : mvcc_data.tids) stream << tid << ", ";
@@ -37,6 +37,12 @@ struct MvccData {
    */
   void grow_by(size_t delta, TransactionID transaction_id, CommitID begin_commit_id);
 
+  /**
+   * Allocates memory for the given number of rows, so that growing up to it does not allocate.
+   * Not thread-safe, only call it before the mvcc data is shared.
+   */
+  void reserve(size_t capacity);
+
  private:
   /**
    * @brief Mutex used to manage access to MVCC data
@@ -1,5 +1,6 @@
 #include "prepared_plan.hpp"
 
+#include "expression/correlated_parameter_expression.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/lqp_subquery_expression.hpp"
 #include "expression/placeholder_expression.hpp"
@@ -80,6 +81,22 @@ std::shared_ptr<AbstractLQPNode> PreparedPlan::instantiate(
   return instantiated_lqp;
 }
 
+std::shared_ptr<AbstractLQPNode> PreparedPlan::instantiate_generic(
+    const std::vector<DataType>& parameter_data_types) const {
+  Assert(parameter_data_types.size() == parameter_ids.size(), "Incorrect number of parameter data types supplied");
+
+  auto parameters = std::vector<std::shared_ptr<AbstractExpression>>{};
+  parameters.reserve(parameter_data_types.size());
+  for (auto parameter_idx = size_t{0}; parameter_idx < parameter_data_types.size(); ++parameter_idx) {
+    const auto referenced_expression_info =
+        CorrelatedParameterExpression::ReferencedExpressionInfo{parameter_data_types[parameter_idx], "?"};
+    parameters.emplace_back(
+        std::make_shared<CorrelatedParameterExpression>(parameter_ids[parameter_idx], referenced_expression_info));
+  }
+
+  return instantiate(parameters);
+}
+
 bool PreparedPlan::operator==(const PreparedPlan& rhs) const {
   return *lqp == *rhs.lqp && parameter_ids == rhs.parameter_ids;
 }
@@ -4,6 +4,7 @@
 #include <memory>
 #include <vector>
 
+#include "all_type_variant.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -26,6 +27,13 @@ class PreparedPlan final {
   std::shared_ptr<AbstractLQPNode> instantiate(
       const std::vector<std::shared_ptr<AbstractExpression>>& parameters) const;
 
+  /**
+   * @return A copy of the prepared plan, with CorrelatedParameterExpressions of the specified
+   *         @param parameter_data_types filled into the placeholders. The PQP of this generic plan can be bound to values of these types with
+   *         AbstractOperator::set_parameters(), so that it only has to be optimized and translated once.
+   */
+  std::shared_ptr<AbstractLQPNode> instantiate_generic(const std::vector<DataType>& parameter_data_types) const;
+
   bool operator==(const PreparedPlan& rhs) const;
 
   std::shared_ptr<AbstractLQPNode> lqp;
@@ -117,18 +117,21 @@ void Table::append(const std::vector<AllTypeVariant>& values) {
   _chunks.back()->append(values);
 }
 
-void Table::append_mutable_chunk() {
+void Table::append_mutable_chunk(const ChunkOffset reserved_row_count) {
   Segments segments;
   for (const auto& column_definition : _column_definitions) {
     resolve_data_type(column_definition.data_type, [&](auto type) {
       using ColumnDataType = typename decltype(type)::type;
-      segments.push_back(std::make_shared<ValueSegment<ColumnDataType>>(column_definition.nullable));
+      const auto value_segment = std::make_shared<ValueSegment<ColumnDataType>>(column_definition.nullable);
+      if (reserved_row_count > 0) value_segment->reserve(reserved_row_count);
+      segments.push_back(value_segment);
     });
   }
 
   std::shared_ptr<MvccData> mvcc_data;
   if (_use_mvcc == UseMvcc::Yes) {
     mvcc_data = std::make_shared<MvccData>(0, CommitID{0});
+    if (reserved_row_count > 0) mvcc_data->reserve(reserved_row_count);
   }
 
   append_chunk(segments, mvcc_data);
@@ -254,4 +257,14 @@ size_t Table::estimate_memory_usage() const {
   return bytes;
 }
 
+CommitID Table::last_modified_commit_id() const { return _last_modified_commit_id.load(); }
+
+void Table::update_last_modified_commit_id(const CommitID commit_id) const {
+  // Transactions might commit their records out of order, so only ever increase the CommitID
+  auto last_modified_commit_id = _last_modified_commit_id.load();
+  while (last_modified_commit_id < commit_id &&
+         !_last_modified_commit_id.compare_exchange_weak(last_modified_commit_id, commit_id)) {
+  }
+}
+
 }  // namespace opossum
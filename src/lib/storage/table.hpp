@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -108,8 +109,9 @@ class Table : private Noncopyable {
   void append_chunk(const Segments& segments, std::shared_ptr<MvccData> mvcc_data = nullptr,
                     const std::optional<PolymorphicAllocator<Chunk>>& alloc = std::nullopt);
 
-  // Create and append a Chunk consisting of ValueSegments.
-  void append_mutable_chunk();
+  // Create and append a Chunk consisting of ValueSegments. Memory for reserved_row_count rows is allocated up front,
+  // which the Insert operator uses so that concurrent Inserts do not need to allocate while growing the chunk.
+  void append_mutable_chunk(ChunkOffset reserved_row_count = 0);
   /** @} */
 
   /**
@@ -173,6 +175,18 @@ class Table : private Noncopyable {
    */
   size_t estimate_memory_usage() const;
 
+  /**
+   * The CommitID of the latest committed transaction that inserted or deleted rows (see Insert and Delete). Used to
+   * decide whether results computed from the table are still valid. Modifications that bypass transactions (e.g.,
+   * append()) are not tracked.
+   * @{
+   */
+  CommitID last_modified_commit_id() const;
+
+  // Like Chunk::increase_invalid_row_count(), this is const because it does not change the table's contents
+  void update_last_modified_commit_id(const CommitID commit_id) const;
+  /** @} */
+
  protected:
   const TableColumnDefinitions _column_definitions;
   const TableType _type;
@@ -182,5 +196,6 @@ class Table : private Noncopyable {
   std::shared_ptr<TableStatistics> _table_statistics;
   std::unique_ptr<std::mutex> _append_mutex;
   std::vector<IndexInfo> _indexes;
+  mutable std::atomic<CommitID> _last_modified_commit_id{CommitID{0}};
 };
 }  // namespace opossum
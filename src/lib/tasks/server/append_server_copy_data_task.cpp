@@ -0,0 +1,44 @@
+#include "append_server_copy_data_task.hpp"
+
+#include "concurrency/transaction_manager.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+void AppendServerCopyDataTask::_on_execute() {
+  try {
+    const auto target_table = StorageManager::get().get_table(_table_name);
+
+    // The batches have at most as many rows as the chunks of the target table
+    auto values = std::make_shared<Table>(target_table->column_definitions(), TableType::Data,
+                                          target_table->max_chunk_size());
+    for (const auto& segments : _batches) {
+      if (segments.empty() || segments.front()->size() == 0) continue;
+      values->append_chunk(segments);
+    }
+
+    auto table_wrapper = std::make_shared<TableWrapper>(values);
+    table_wrapper->execute();
+
+    const auto transaction_context = TransactionManager::get().new_transaction_context();
+    auto insert = std::make_shared<Insert>(_table_name, table_wrapper);
+    insert->set_transaction_context(transaction_context);
+
+    try {
+      insert->execute();
+    } catch (...) {
+      transaction_context->rollback();
+      throw;
+    }
+    transaction_context->commit();
+
+    _promise.set_value(values->row_count());
+  } catch (const std::exception&) {
+    _promise.set_exception(boost::current_exception());
+  }
+}
+
+}  // namespace opossum
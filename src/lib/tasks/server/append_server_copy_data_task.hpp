@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "abstract_server_task.hpp"
+#include "storage/chunk.hpp"
+
+namespace opossum {
+
+// This task appends the rows of a COPY ... FROM STDIN, which have been parsed batch by batch, to the target table and
+// returns their number. All rows are inserted in a single transaction, so that either all of them become visible or,
+// if one of them cannot be inserted, none.
+class AppendServerCopyDataTask : public AbstractServerTask<uint64_t> {
+ public:
+  AppendServerCopyDataTask(std::string table_name, std::vector<Segments> batches)
+      : _table_name(std::move(table_name)), _batches(std::move(batches)) {}
+
+ protected:
+  void _on_execute() override;
+
+  const std::string _table_name;
+  const std::vector<Segments> _batches;
+};
+
+}  // namespace opossum
@@ -1,12 +1,11 @@
 #include "bind_server_prepared_statement_task.hpp"
 
-#include "concurrency/transaction_manager.hpp"
-#include "expression/value_expression.hpp"
+#include <unordered_map>
+
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/lqp_translator.hpp"
-#include "logical_query_plan/lqp_utils.hpp"
-#include "scheduler/current_scheduler.hpp"
-#include "sql/sql_pipeline.hpp"
+#include "operators/abstract_operator.hpp"
+#include "optimizer/optimizer.hpp"
 #include "storage/prepared_plan.hpp"
 
 namespace opossum {
@@ -15,18 +14,47 @@ void BindServerPreparedStatementTask::_on_execute() {
   try {
     Assert(_params.size() == _prepared_plan->parameter_ids.size(), "Prepared statement parameter count mismatch");
 
-    auto parameter_expressions = std::vector<std::shared_ptr<AbstractExpression>>{_params.size()};
-    for (auto parameter_idx = size_t{0}; parameter_idx < _params.size(); ++parameter_idx) {
-      parameter_expressions[parameter_idx] = std::make_shared<ValueExpression>(_params[parameter_idx]);
-    }
+    // The generic plan is optimized and translated once per statement, the values are only set in copies of its PQP
+    const auto data_types = parameter_data_types(_params);
+    const auto generic_lqp = _prepared_plan->instantiate_generic(data_types);
+    const auto optimized_lqp = Optimizer::create_default_optimizer()->optimize(generic_lqp);
+    const auto pqp = LQPTranslator{}.translate_node(optimized_lqp);
 
-    const auto lqp = _prepared_plan->instantiate(parameter_expressions);
-    const auto pqp = LQPTranslator{}.translate_node(lqp);
+    _prepared_statement_template =
+        std::make_shared<PreparedStatementTemplate>(PreparedStatementTemplate{data_types, pqp});
 
-    _promise.set_value(pqp);
+    _promise.set_value(bind(*_prepared_statement_template, *_prepared_plan, _params));
   } catch (const std::exception&) {
     _promise.set_exception(boost::current_exception());
   }
 }
 
+std::shared_ptr<PreparedStatementTemplate> BindServerPreparedStatementTask::prepared_statement_template() const {
+  return _prepared_statement_template;
+}
+
+std::vector<DataType> BindServerPreparedStatementTask::parameter_data_types(const std::vector<AllTypeVariant>& params) {
+  auto data_types = std::vector<DataType>{};
+  data_types.reserve(params.size());
+  for (const auto& param : params) {
+    data_types.emplace_back(data_type_from_all_type_variant(param));
+  }
+  return data_types;
+}
+
+std::shared_ptr<AbstractOperator> BindServerPreparedStatementTask::bind(
+    const PreparedStatementTemplate& prepared_statement_template, const PreparedPlan& prepared_plan,
+    const std::vector<AllTypeVariant>& params) {
+  DebugAssert(params.size() == prepared_plan.parameter_ids.size(), "Prepared statement parameter count mismatch");
+
+  auto parameters = std::unordered_map<ParameterID, AllTypeVariant>{};
+  for (auto parameter_idx = size_t{0}; parameter_idx < params.size(); ++parameter_idx) {
+    parameters.emplace(prepared_plan.parameter_ids[parameter_idx], params[parameter_idx]);
+  }
+
+  const auto pqp = prepared_statement_template.pqp->deep_copy();
+  pqp->set_parameters(parameters);
+  return pqp;
+}
+
 }  // namespace opossum
@@ -9,18 +9,38 @@ namespace opossum {
 class AbstractOperator;
 class PreparedPlan;
 
-// This task is used to bind the actual variables of a prepared statements and return the corresponding query plan.
+// The optimized PQP of a prepared statement for the data types of the values bound to it (see
+// PreparedPlan::instantiate_generic()). Binding values to it only requires a copy of the PQP.
+struct PreparedStatementTemplate {
+  std::vector<DataType> parameter_data_types;
+  std::shared_ptr<AbstractOperator> pqp;
+};
+
+// This task is used to bind the actual variables of a prepared statements and return the corresponding query plan. It
+// creates the PreparedStatementTemplate for the types of the variables, which the session keeps for the following
+// Bind messages of the statement.
 class BindServerPreparedStatementTask : public AbstractServerTask<std::shared_ptr<AbstractOperator>> {
  public:
   BindServerPreparedStatementTask(const std::shared_ptr<PreparedPlan>& prepared_plan,
                                   std::vector<AllTypeVariant> params)
       : _prepared_plan(prepared_plan), _params(std::move(params)) {}
 
+  // Only set after the execution
+  std::shared_ptr<PreparedStatementTemplate> prepared_statement_template() const;
+
+  static std::vector<DataType> parameter_data_types(const std::vector<AllTypeVariant>& params);
+
+  // Copies the PQP of the template and sets the variables. This is cheap enough to not require a task.
+  static std::shared_ptr<AbstractOperator> bind(const PreparedStatementTemplate& prepared_statement_template,
+                                                const PreparedPlan& prepared_plan,
+                                                const std::vector<AllTypeVariant>& params);
+
  protected:
   void _on_execute() override;
 
   std::shared_ptr<PreparedPlan> _prepared_plan;
   std::vector<AllTypeVariant> _params;
+  std::shared_ptr<PreparedStatementTemplate> _prepared_statement_template;
 };
 
 }  // namespace opossum
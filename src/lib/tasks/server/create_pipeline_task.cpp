@@ -2,7 +2,12 @@
 
 #include <boost/algorithm/string.hpp>
 
+#include <regex>
+#include <string>
+#include <vector>
+
 #include "sql/sql_pipeline_builder.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
@@ -13,6 +18,8 @@ void CreatePipelineTask::_on_execute() {
     if (_allow_load_table && _is_load_table()) {
       // Try LOAD file_name table_name
       result->load_table = std::make_pair(_file_name, _table_name);
+    } else if (_allow_load_table && _is_copy_from_stdin()) {
+      result->copy_from_stdin = CopyFromStdin{_table_name, _copy_format};
     } else {
       result->sql_pipeline = std::make_shared<SQLPipeline>(SQLPipelineBuilder{_sql}.create_pipeline());
     }
@@ -47,4 +54,29 @@ bool CreatePipelineTask::_is_load_table() {
   return true;
 }
 
+bool CreatePipelineTask::_is_copy_from_stdin() {
+  // We expect COPY table_name FROM STDIN, optionally followed by [WITH] (FORMAT text|csv|binary) or the options CSV and
+  // BINARY of older PostgreSQL versions
+  static const auto copy_regex = std::regex{
+      R"(\s*COPY\s+(\w+)\s+FROM\s+STDIN(?:\s+(?:WITH\s*)?(?:\(\s*FORMAT\s+(\w+)\s*\)|(CSV|BINARY)))?\s*;?\s*)",
+      std::regex::icase};
+
+  auto match = std::smatch{};
+  if (!std::regex_match(_sql, match, copy_regex)) return false;
+
+  const auto format = boost::algorithm::to_lower_copy(match[2].matched ? match[2].str() : match[3].str());
+  if (format.empty() || format == "text") {
+    _copy_format = CopyFormat::Text;
+  } else if (format == "csv") {
+    _copy_format = CopyFormat::Csv;
+  } else if (format == "binary") {
+    _copy_format = CopyFormat::Binary;
+  } else {
+    FailInput("Unsupported COPY format: " + format);
+  }
+
+  _table_name = match[1].str();
+  return true;
+}
+
 }  // namespace opossum
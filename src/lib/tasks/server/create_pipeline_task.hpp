@@ -2,15 +2,27 @@
 
 #include <boost/thread/future.hpp>
 
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
 #include "abstract_server_task.hpp"
+#include "server/types.hpp"
 
 namespace opossum {
 
 class SQLPipeline;
 
+struct CopyFromStdin {
+  std::string table_name;
+  CopyFormat format;
+};
+
 struct CreatePipelineResult {
   std::shared_ptr<SQLPipeline> sql_pipeline;
   std::optional<std::pair<std::string, std::string>> load_table;
+  std::optional<CopyFromStdin> copy_from_stdin;
 };
 
 // This task is used to parse an SQL string from a client and wrap it in an SQLPipeline. It is a separate task and not
@@ -29,11 +41,16 @@ class CreatePipelineTask : public AbstractServerTask<std::unique_ptr<CreatePipel
   // interpret it as a LOAD <file-name> <table-name> command. If this doesn't work, we pass on the parse error.
   bool _is_load_table();
 
+  // COPY <table-name> FROM STDIN is not supported by the SQL parser either. The data is sent by the client after the
+  // server has answered the command, which is why COPY, like LOAD, is only allowed in simple queries.
+  bool _is_copy_from_stdin();
+
   const std::string _sql;
   const bool _allow_load_table;
 
   std::string _file_name;
   std::string _table_name;
+  CopyFormat _copy_format = CopyFormat::Text;
 };
 
 }  // namespace opossum
@@ -5,11 +5,20 @@
 #include "operators/abstract_operator.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "server/result_stream.hpp"
 
 namespace opossum {
 
 void ExecuteServerPreparedStatementTask::_on_execute() {
   try {
+    if (auto result_stream = ResultStream::create(_prepared_plan)) {
+      result_stream->execute_input();
+      auto first_batch = result_stream->execute_next_batch();
+      _result_stream = std::move(result_stream);
+      _promise.set_value(std::move(first_batch));
+      return;
+    }
+
     const auto tasks = OperatorTask::make_tasks_from_operator(_prepared_plan, CleanupTemporaries::Yes);
     CurrentScheduler::schedule_and_wait_for_tasks(tasks);
     auto result_table = tasks.back()->get_operator()->get_output();
@@ -19,4 +28,6 @@ void ExecuteServerPreparedStatementTask::_on_execute() {
   }
 }
 
+std::shared_ptr<ResultStream> ExecuteServerPreparedStatementTask::result_stream() const { return _result_stream; }
+
 }  // namespace opossum
@@ -5,19 +5,26 @@
 namespace opossum {
 
 class AbstractOperator;
+class ResultStream;
 class TransactionContext;
 class Table;
 
-// This task takes a query plan of a prepared statement and executes it.
+// This task takes a query plan of a prepared statement and executes it. If the result can be streamed (see
+// ResultStream), only the first batch of the result is returned and the remaining ones are executed on request by
+// ExecuteServerResultBatchTask.
 class ExecuteServerPreparedStatementTask : public AbstractServerTask<std::shared_ptr<const Table>> {
  public:
   explicit ExecuteServerPreparedStatementTask(std::shared_ptr<AbstractOperator> prepared_plan)
       : _prepared_plan(std::move(prepared_plan)) {}
 
+  // Only set after the execution and if the result is streamed
+  std::shared_ptr<ResultStream> result_stream() const;
+
  protected:
   void _on_execute() override;
 
   std::shared_ptr<AbstractOperator> _prepared_plan;
+  std::shared_ptr<ResultStream> _result_stream;
 };
 
 }  // namespace opossum
@@ -1,17 +1,40 @@
 #include "execute_server_query_task.hpp"
 
+#include "server/result_stream.hpp"
 #include "sql/sql_pipeline.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
 void ExecuteServerQueryTask::_on_execute() {
   try {
-    _sql_pipeline->get_result_table();
-    // Indicate that execution is finished. The result is accessed from outside so we need an empty promise.
-    _promise.set_value();
+    if (auto result_stream = _create_result_stream()) {
+      result_stream->execute_input();
+      auto first_batch = result_stream->execute_next_batch();
+      _result_stream = std::move(result_stream);
+      _promise.set_value(std::move(first_batch));
+      return;
+    }
+
+    const auto [status, result_table] = _sql_pipeline->get_result_table();
+    Assert(status == SQLPipelineStatus::Success, "Server cannot handle failed transactions yet");
+    _promise.set_value(result_table);
   } catch (...) {
     _promise.set_exception(boost::current_exception());
   }
 }
 
+std::shared_ptr<ResultStream> ExecuteServerQueryTask::_create_result_stream() {
+  // Statements of a multi-statement pipeline might depend on the execution of the previous ones. An explicit
+  // transaction is committed by its owner, which does not know when the last batch was sent. Results that might be
+  // served from or added to the SQLResultCache are only available from the pipeline.
+  if (_sql_pipeline->statement_count() != 1 || _sql_pipeline->transaction_context() || _sql_pipeline->result_cache) {
+    return nullptr;
+  }
+
+  return ResultStream::create(_sql_pipeline->get_physical_plans().front());
+}
+
+std::shared_ptr<ResultStream> ExecuteServerQueryTask::result_stream() const { return _result_stream; }
+
 }  // namespace opossum
@@ -4,17 +4,29 @@
 
 namespace opossum {
 
+class ResultStream;
 class SQLPipeline;
+class Table;
 
-// This task is used in the SimpleQueryCommand mode where we have a simple pipeline that needs to be executed.
-class ExecuteServerQueryTask : public AbstractServerTask<void> {
+// This task is used in the SimpleQueryCommand mode where we have a simple pipeline that needs to be executed. If the
+// pipeline consists of a single auto-committed statement whose result can be streamed (see ResultStream), only the
+// first batch of the result is returned. The remaining ones are executed on request by ExecuteServerResultBatchTask,
+// and the statement's transaction is only committed once the last of them has been sent.
+class ExecuteServerQueryTask : public AbstractServerTask<std::shared_ptr<const Table>> {
  public:
   explicit ExecuteServerQueryTask(std::shared_ptr<SQLPipeline> sql_pipeline) : _sql_pipeline(sql_pipeline) {}
 
+  // Only set after the execution and if the result is streamed
+  std::shared_ptr<ResultStream> result_stream() const;
+
  protected:
   void _on_execute() override;
 
+  // Returns nullptr if the pipeline has to be executed as a whole
+  std::shared_ptr<ResultStream> _create_result_stream();
+
   std::shared_ptr<SQLPipeline> _sql_pipeline;
+  std::shared_ptr<ResultStream> _result_stream;
 };
 
 }  // namespace opossum
@@ -0,0 +1,15 @@
+#include "execute_server_result_batch_task.hpp"
+
+#include "server/result_stream.hpp"
+
+namespace opossum {
+
+void ExecuteServerResultBatchTask::_on_execute() {
+  try {
+    _promise.set_value(_result_stream->execute_next_batch());
+  } catch (const std::exception&) {
+    _promise.set_exception(boost::current_exception());
+  }
+}
+
+}  // namespace opossum
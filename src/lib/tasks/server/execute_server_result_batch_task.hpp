@@ -0,0 +1,22 @@
+#pragma once
+
+#include "abstract_server_task.hpp"
+
+namespace opossum {
+
+class ResultStream;
+class Table;
+
+// This task executes the next batch of a streamed result, see ResultStream.
+class ExecuteServerResultBatchTask : public AbstractServerTask<std::shared_ptr<const Table>> {
+ public:
+  explicit ExecuteServerResultBatchTask(std::shared_ptr<ResultStream> result_stream)
+      : _result_stream(std::move(result_stream)) {}
+
+ protected:
+  void _on_execute() override;
+
+  std::shared_ptr<ResultStream> _result_stream;
+};
+
+}  // namespace opossum
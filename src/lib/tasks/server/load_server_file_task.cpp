@@ -3,6 +3,7 @@
 #include <boost/algorithm/string/split.hpp>
 #include <operators/import_binary.hpp>
 #include <operators/import_csv.hpp>
+#include <operators/import_parquet.hpp>
 
 #include "storage/chunk.hpp"
 #include "storage/storage_manager.hpp"
@@ -25,8 +26,11 @@ void LoadServerFileTask::_on_execute() {
     } else if (extension == "bin") {
       auto importer = std::make_shared<ImportBinary>(_file_name, _table_name);
       importer->execute();
+    } else if (extension == "parquet") {
+      auto importer = std::make_shared<ImportParquet>(_file_name, _table_name);
+      importer->execute();
     } else {
-      Fail("Unsupported file type could not be loaded. Only csv, tbl, and bin are supported.");
+      Fail("Unsupported file type could not be loaded. Only csv, tbl, bin, and parquet are supported.");
     }
 
     _promise.set_value();
@@ -0,0 +1,15 @@
+#include "parse_server_copy_data_task.hpp"
+
+#include "server/copy_data_parser.hpp"
+
+namespace opossum {
+
+void ParseServerCopyDataTask::_on_execute() {
+  try {
+    _promise.set_value(_copy_data_parser->parse_batch(_batch));
+  } catch (const std::exception&) {
+    _promise.set_exception(boost::current_exception());
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "abstract_server_task.hpp"
+#include "storage/chunk.hpp"
+
+namespace opossum {
+
+class CopyDataParser;
+
+// This task parses a batch of rows of a COPY ... FROM STDIN. The session schedules one task per batch while it is
+// receiving the data, so that the batches are parsed in parallel.
+class ParseServerCopyDataTask : public AbstractServerTask<Segments> {
+ public:
+  ParseServerCopyDataTask(std::shared_ptr<const CopyDataParser> copy_data_parser, std::string batch)
+      : _copy_data_parser(std::move(copy_data_parser)), _batch(std::move(batch)) {}
+
+ protected:
+  void _on_execute() override;
+
+  const std::shared_ptr<const CopyDataParser> _copy_data_parser;
+  const std::string _batch;
+};
+
+}  // namespace opossum
@@ -1,3 +1,6 @@
+#include <thread>
+#include <vector>
+
 #include "base_test.hpp"
 
 #include "cache/cache.hpp"
@@ -6,6 +9,7 @@
 #include "cache/lru_cache.hpp"
 #include "cache/lru_k_cache.hpp"
 #include "cache/random_cache.hpp"
+#include "cache/sharded_cache.hpp"
 
 namespace opossum {
 
@@ -231,6 +235,100 @@ TEST(CachePolicyTest, RandomCacheTest) {
   ASSERT_EQ(53, cache.get(6));  // Hit.
 }
 
+// CLOCK Strategy within a single shard
+TEST(CachePolicyTest, ShardedCacheTest) {
+  ShardedCache<int, int> cache(2);
+  ASSERT_EQ(cache.shard_count(), 1u);
+
+  cache.set(1, 2);  // Miss, insert.
+  cache.set(2, 4);  // Miss, insert.
+
+  ASSERT_EQ(2, cache.get(1));  // Hit, reference 1.
+  cache.set(3, 6);             // Miss, evict 2. The clock hand clears the reference of 1.
+
+  ASSERT_TRUE(cache.has(1));
+  ASSERT_FALSE(cache.has(2));
+  ASSERT_TRUE(cache.has(3));
+
+  cache.set(4, 8);  // Miss, evict 1, which was not referenced since the clock hand passed it.
+
+  ASSERT_FALSE(cache.has(1));
+  ASSERT_TRUE(cache.has(3));
+  ASSERT_TRUE(cache.has(4));
+
+  ASSERT_EQ(cache.try_get(4), 8);
+  ASSERT_EQ(cache.try_get(5), std::nullopt);
+
+  const auto metrics = cache.metrics();
+  EXPECT_EQ(metrics.hit_count, 2u);
+  EXPECT_EQ(metrics.miss_count, 1u);
+  EXPECT_DOUBLE_EQ(metrics.hit_rate(), 2.0 / 3.0);
+}
+
+TEST(CachePolicyTest, ShardedCacheShards) {
+  ShardedCache<int, int> cache(1000, 4);
+  ASSERT_EQ(cache.shard_count(), 4u);
+
+  // Few enough entries for every shard to hold its share
+  for (auto key = 0; key < 200; ++key) {
+    cache.set(key, key * 2);
+  }
+
+  EXPECT_EQ(cache.size(), 200u);
+  for (auto key = 0; key < 200; ++key) {
+    ASSERT_EQ(cache.try_get(key), key * 2);
+  }
+
+  auto element_count = size_t{0};
+  for (const auto& [key, value] : cache) {
+    ++element_count;
+    ASSERT_EQ(value, key * 2);
+  }
+  EXPECT_EQ(element_count, 200u);
+
+  // Each shard holds at most a quarter of the capacity
+  cache.resize(100);
+  EXPECT_EQ(cache.capacity(), 100u);
+  EXPECT_LE(cache.size(), 100u);
+}
+
+TEST(CachePolicyTest, ShardedCacheConcurrentAccess) {
+  Cache<int, int> cache;
+  cache.replace_cache_impl<ShardedCache<int, int>>(256);
+
+  const auto thread_count = 8;
+  const auto operations_per_thread = 10'000;
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < thread_count; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      for (auto operation_idx = 0; operation_idx < operations_per_thread; ++operation_idx) {
+        const auto key = (thread_id * operations_per_thread + operation_idx) % 512;
+        if (const auto value = cache.try_get(key)) {
+          ASSERT_EQ(*value, key + 1);
+        } else {
+          cache.set(key, key + 1);
+        }
+      }
+    });
+  }
+
+  // Resizing concurrently to the accesses must neither lose capacity updates nor invalidate copied values
+  auto resizing_thread = std::thread{[&]() {
+    for (auto resize_idx = 0; resize_idx < 100; ++resize_idx) {
+      cache.resize(resize_idx % 2 == 0 ? 128 : 256);
+    }
+  }};
+  resizing_thread.join();
+  for (auto& thread : threads) thread.join();
+
+  EXPECT_EQ(cache.cache().capacity(), 256u);
+  EXPECT_LE(cache.size(), 256u);
+
+  const auto metrics = static_cast<const ShardedCache<int, int>&>(cache.cache()).metrics();
+  EXPECT_EQ(metrics.hit_count + metrics.miss_count, size_t{thread_count * operations_per_thread});
+}
+
 // Test the default cache (uses GDFS).
 TEST(CachePolicyTest, Iterators) {
   Cache<int, int> cache(2);
@@ -258,7 +356,7 @@ class CacheTest : public BaseTest {};
 
 // Here, all cache types are defined.
 using CacheTypes = ::testing::Types<LRUCache<int, int>, LRUKCache<2, int, int>, GDSCache<int, int>, GDFSCache<int, int>,
-                                    RandomCache<int, int>>;
+                                    RandomCache<int, int>, ShardedCache<int, int>>;
 TYPED_TEST_CASE(CacheTest, CacheTypes, );  // NOLINT(whitespace/parens)
 
 TYPED_TEST(CacheTest, Size) {
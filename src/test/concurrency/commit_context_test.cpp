@@ -45,4 +45,45 @@ TEST_F(CommitContextTest, TrySetNextFailsIfNotNullptr) {
   EXPECT_FALSE(context->try_set_next(next_context));
 }
 
+TEST_F(CommitContextTest, IsPendingOnceSealedAndAllTransactionsArePending) {
+  auto context = std::make_unique<CommitContext>(1u);
+
+  // A context cannot be sealed before a transaction has joined it
+  EXPECT_FALSE(context->try_seal());
+
+  EXPECT_TRUE(context->try_join());
+  EXPECT_TRUE(context->try_join());
+  context->make_pending(TransactionID{1});
+  EXPECT_FALSE(context->is_pending());
+
+  EXPECT_TRUE(context->try_seal());
+  EXPECT_FALSE(context->try_join());
+  EXPECT_FALSE(context->is_pending());
+
+  context->make_pending(TransactionID{2});
+  EXPECT_TRUE(context->is_pending());
+}
+
+TEST_F(CommitContextTest, FireCallbacksOfAllTransactions) {
+  auto context = std::make_unique<CommitContext>(1u);
+
+  auto committed_transaction_ids = std::vector<TransactionID>{};
+  const auto callback = [&](TransactionID transaction_id) { committed_transaction_ids.emplace_back(transaction_id); };
+
+  EXPECT_TRUE(context->try_join());
+  EXPECT_TRUE(context->try_join());
+  context->make_pending(TransactionID{1}, callback);
+  context->make_pending(TransactionID{2}, callback);
+  context->fire_callback();
+
+  EXPECT_EQ(committed_transaction_ids, (std::vector<TransactionID>{TransactionID{1}, TransactionID{2}}));
+}
+
+TEST_F(CommitContextTest, SealedContextCannotBeJoined) {
+  auto context = std::make_unique<CommitContext>(1u, true);
+
+  EXPECT_FALSE(context->try_join());
+  EXPECT_FALSE(context->is_pending());
+}
+
 }  // namespace opossum
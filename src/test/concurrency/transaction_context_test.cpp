@@ -88,6 +88,51 @@ TEST_F(TransactionContextTest, CommitShouldCommitAllFollowingPendingTransactions
   EXPECT_EQ(context_2->commit_id(), manager().last_commit_id());
 }
 
+TEST_F(TransactionContextTest, GroupCommitWhilePreviousTransactionCommits) {
+  auto context_1 = manager().new_transaction_context();
+  auto context_2 = manager().new_transaction_context();
+  auto context_3 = manager().new_transaction_context();
+
+  const auto prev_last_commit_id = manager().last_commit_id();
+
+  auto context_2_committed = false;
+  auto context_3_committed = false;
+
+  auto try_commit_contexts_2_and_3 = [&]() {
+    context_2->commit_async([&](TransactionID) { context_2_committed = true; });
+    context_3->commit_async([&](TransactionID) { context_3_committed = true; });
+
+    EXPECT_EQ(prev_last_commit_id, manager().last_commit_id());
+  };
+
+  auto commit_op = std::make_shared<CommitFuncOp>(try_commit_contexts_2_and_3);
+  commit_op->set_transaction_context(context_1);
+  commit_op->execute();
+
+  /**
+   * Execution order
+   *
+   * - context_1 gets commit ID
+   * - context_2 and context_3 want to commit while context_1 is committing, so that they share the next commit ID
+   * - context_1 commits, followed by context_2 and context_3 at once
+   *
+   */
+  context_1->commit_async([](TransactionID) {});
+
+  EXPECT_EQ(context_2->commit_id(), context_1->commit_id() + 1);
+  EXPECT_EQ(context_3->commit_id(), context_2->commit_id());
+  EXPECT_EQ(manager().last_commit_id(), context_3->commit_id());
+  EXPECT_TRUE(context_2_committed);
+  EXPECT_TRUE(context_3_committed);
+  EXPECT_EQ(context_3->phase(), TransactionPhase::Committed);
+
+  // Without a commit in progress, the next transaction does not wait for others and gets a commit ID of its own
+  auto context_4 = manager().new_transaction_context();
+  context_4->commit();
+  EXPECT_EQ(context_4->commit_id(), context_3->commit_id() + 1);
+  EXPECT_EQ(manager().last_commit_id(), context_4->commit_id());
+}
+
 TEST_F(TransactionContextTest, CallbackFiresWhenCommitted) {
   auto context_1 = manager().new_transaction_context();
   auto context_2 = manager().new_transaction_context();
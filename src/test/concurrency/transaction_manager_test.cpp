@@ -1,4 +1,6 @@
 #include <algorithm>
+#include <atomic>
+#include <memory>
 #include <vector>
 
 #include "base_test.hpp"
@@ -13,23 +15,31 @@ class TransactionManagerTest : public BaseTest {
  protected:
   void SetUp() override {}
 
-  static std::unordered_multiset<CommitID>& get_active_snapshot_commit_ids() {
-    return TransactionManager::get()._active_snapshot_commit_ids;
+  static std::vector<CommitID> get_active_snapshot_commit_ids() {
+    auto snapshot_commit_ids = std::vector<CommitID>{};
+    for (auto* block = &TransactionManager::get()._first_snapshot_slot_block; block; block = block->next.load()) {
+      for (const auto& slot : block->slots) {
+        if (slot.snapshot_commit_id != TransactionManager::UNUSED_SNAPSHOT_SLOT) {
+          snapshot_commit_ids.emplace_back(slot.snapshot_commit_id);
+        }
+      }
+    }
+    return snapshot_commit_ids;
   }
 
-  static void register_transaction(CommitID snapshot_commit_id) {
-    TransactionManager::get()._register_transaction(snapshot_commit_id);
+  static std::atomic<CommitID>* register_transaction(CommitID snapshot_commit_id) {
+    return TransactionManager::get()._register_transaction(snapshot_commit_id);
   }
-  static void deregister_transaction(CommitID snapshot_commit_id) {
-    TransactionManager::get()._deregister_transaction(snapshot_commit_id);
+  static void deregister_transaction(std::atomic<CommitID>* snapshot_slot) {
+    TransactionManager::get()._deregister_transaction(*snapshot_slot);
   }
 };
 
 /** Check if all active snapshot commit ids of uncommitted
  * transaction contexts are tracked correctly.
- * Normally, deregister_transaction() is called in the
- * destructor of the transaction context but is called
- * manually for this test.
+ * deregister_transaction() is called in the destructor of the
+ * transaction context, so that the contexts are reset once
+ * they have been committed.
  */
 TEST_F(TransactionManagerTest, TrackActiveCommitIDs) {
   auto& manager = TransactionManager::get();
@@ -37,9 +47,9 @@ TEST_F(TransactionManagerTest, TrackActiveCommitIDs) {
   EXPECT_EQ(get_active_snapshot_commit_ids().size(), 0);
   EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), std::nullopt);
 
-  const auto t1_context = manager.new_transaction_context();
-  const auto t2_context = manager.new_transaction_context();
-  const auto t3_context = manager.new_transaction_context();
+  auto t1_context = manager.new_transaction_context();
+  auto t2_context = manager.new_transaction_context();
+  auto t3_context = manager.new_transaction_context();
 
   const CommitID t1_snapshot_commit_id = t1_context->snapshot_commit_id();
   const CommitID t2_snapshot_commit_id = t2_context->snapshot_commit_id();
@@ -56,17 +66,17 @@ TEST_F(TransactionManagerTest, TrackActiveCommitIDs) {
   EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), *std::min_element(vec.cbegin(), vec.cend()));
 
   t1_context->commit();
-  deregister_transaction(t1_context->snapshot_commit_id());
+  t1_context = nullptr;
 
   EXPECT_EQ(get_active_snapshot_commit_ids().size(), 2);
   EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t1_context->snapshot_commit_id()) != get_active_snapshot_commit_ids().cend());
+                        t1_snapshot_commit_id) != get_active_snapshot_commit_ids().cend());
   EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
                         t3_context->snapshot_commit_id()) != get_active_snapshot_commit_ids().cend());
   EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), t2_context->snapshot_commit_id());
 
   t3_context->commit();
-  deregister_transaction(t3_context->snapshot_commit_id());
+  t3_context = nullptr;
 
   EXPECT_EQ(get_active_snapshot_commit_ids().size(), 1);
   EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
@@ -74,15 +84,49 @@ TEST_F(TransactionManagerTest, TrackActiveCommitIDs) {
   EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), t2_context->snapshot_commit_id());
 
   t2_context->commit();
-  deregister_transaction(t2_context->snapshot_commit_id());
+  t2_context = nullptr;
 
   EXPECT_EQ(get_active_snapshot_commit_ids().size(), 0);
   EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), std::nullopt);
+}
+
+TEST_F(TransactionManagerTest, LowestActiveSnapshotCommitID) {
+  auto& manager = TransactionManager::get();
+
+  auto* slot_1 = register_transaction(CommitID{7});
+  auto* slot_2 = register_transaction(CommitID{3});
+  auto* slot_3 = register_transaction(CommitID{5});
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), CommitID{3});
+
+  deregister_transaction(slot_2);
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), CommitID{5});
+
+  // A free slot is reused
+  auto* slot_4 = register_transaction(CommitID{4});
+  EXPECT_EQ(slot_4, slot_2);
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), CommitID{4});
+
+  deregister_transaction(slot_1);
+  deregister_transaction(slot_3);
+  deregister_transaction(slot_4);
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), std::nullopt);
+  EXPECT_THROW(deregister_transaction(slot_4), std::logic_error);
+}
+
+TEST_F(TransactionManagerTest, MoreActiveTransactionsThanSlotsPerBlock) {
+  auto& manager = TransactionManager::get();
 
-  // To prevent exceptions in TransactionContext destructor
-  register_transaction(t1_snapshot_commit_id);
-  register_transaction(t2_snapshot_commit_id);
-  register_transaction(t3_snapshot_commit_id);
+  // The slots are not limited, more blocks are appended as needed
+  auto contexts = std::vector<std::shared_ptr<TransactionContext>>{};
+  for (auto index = size_t{0}; index < 200; ++index) {
+    contexts.emplace_back(manager.new_transaction_context());
+  }
+  EXPECT_EQ(get_active_snapshot_commit_ids().size(), 200);
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), contexts.front()->snapshot_commit_id());
+
+  contexts.clear();
+  EXPECT_EQ(get_active_snapshot_commit_ids().size(), 0);
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), std::nullopt);
 }
 
 }  // namespace opossum
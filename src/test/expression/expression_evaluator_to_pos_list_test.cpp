@@ -40,7 +40,7 @@ class ExpressionEvaluatorToPosListTest : public ::testing::Test {
     x = PQPColumnExpression::from_table(*table_b, "x");
   }
 
-  bool test_expression(const std::shared_ptr<Table>& table, const ChunkID chunk_id,
+  bool test_expression(const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
                        const AbstractExpression& expression, const std::vector<ChunkOffset>& matching_chunk_offsets) {
     const auto actual_pos_list = ExpressionEvaluator{table, chunk_id}.evaluate_expression_to_pos_list(expression);
 
@@ -191,4 +191,49 @@ TEST_F(ExpressionEvaluatorToPosListTest, ExistsUncorrelated) {
   EXPECT_TRUE(test_expression(table_b, ChunkID{0}, *not_exists_(subquery_returning_none), {0, 1, 2, 3}));
 }
 
+TEST_F(ExpressionEvaluatorToPosListTest, LogicalWithSelectionVector) {
+  // Few rows match the left operand, so the right operand is only evaluated for them
+  EXPECT_TRUE(test_expression(table_a, ChunkID{0}, *and_(less_than_(d, 6), is_null_(c)), {1}));
+  EXPECT_TRUE(test_expression(table_a, ChunkID{0}, *and_(equals_(d, 5), less_than_(c, 40)), {}));
+  EXPECT_TRUE(test_expression(table_a, ChunkID{0}, *and_(equals_(d, 9), less_than_(c, 40)), {}));
+  EXPECT_TRUE(test_expression(table_a, ChunkID{0}, *and_(equals_(d, 2), and_(less_than_(c, 40), is_null_(s3))), {0}));
+
+  // Correlated subqueries are only executed for the selected rows, with the parameters of these rows
+  const auto table_wrapper = std::make_shared<TableWrapper>(table_a);
+  const auto table_scan =
+      std::make_shared<TableScan>(table_wrapper, equals_(d, correlated_parameter_(ParameterID{0}, x)));
+  const auto subquery = pqp_subquery_(table_scan, DataType::Int, false, std::make_pair(ParameterID{0}, ColumnID{0}));
+  EXPECT_TRUE(test_expression(table_b, ChunkID{1}, *and_(less_than_(x, 8), exists_(subquery)), {1}));
+  EXPECT_TRUE(test_expression(table_b, ChunkID{1}, *and_(greater_than_(x, 7), exists_(subquery)), {}));
+
+  // ReferenceSegments
+  const auto reference_table_wrapper = std::make_shared<TableWrapper>(table_a);
+  const auto reference_table_scan = std::make_shared<TableScan>(reference_table_wrapper, greater_than_(d, 0));
+  reference_table_wrapper->execute();
+  reference_table_scan->execute();
+  EXPECT_TRUE(
+      test_expression(reference_table_scan->get_output(), ChunkID{0}, *and_(less_than_(d, 6), is_null_(c)), {1}));
+}
+
+TEST_F(ExpressionEvaluatorToPosListTest, Batched) {
+  const auto expressions = std::vector<std::shared_ptr<AbstractExpression>>{
+      and_(less_than_(d, 6), is_null_(c)),
+      and_(greater_than_(d, 4), less_than_(d, 7)),
+      or_(is_null_(c), equals_(c, 33)),
+      in_(c, list_(0, null_(), 33)),
+      like_(s1, "%a%"),
+      value_(1)};
+
+  for (const auto& expression : expressions) {
+    const auto expected_pos_list =
+        ExpressionEvaluator{table_a, ChunkID{0}}.evaluate_expression_to_pos_list(*expression);
+
+    for (const auto batch_size : {ChunkOffset{1}, ChunkOffset{3}, ChunkOffset{4}}) {
+      const auto actual_pos_list =
+          ExpressionEvaluator{table_a, ChunkID{0}}.evaluate_expression_to_pos_list_batched(*expression, batch_size);
+      EXPECT_EQ(actual_pos_list, expected_pos_list) << expression->as_column_name() << ", batch size " << batch_size;
+    }
+  }
+}
+
 }  // namespace opossum
@@ -802,4 +802,42 @@ TEST_F(ExpressionEvaluatorToValuesTest, CastSeries) {
       test_expression<pmr_string>(table_a, *cast_(c, DataType::String), {"33", std::nullopt, "34", std::nullopt}));
 }
 
+TEST_F(ExpressionEvaluatorToValuesTest, SegmentsBatched) {
+  const auto expressions = std::vector<std::shared_ptr<AbstractExpression>>{
+      a_plus_b, a_plus_c, s1_gt_s2, case_(greater_than_(c, 33), s1, s3), substr_(s1, 2, 3), value_(5)};
+
+  for (const auto batch_size : {ChunkOffset{1}, ChunkOffset{3}, ChunkOffset{4}}) {
+    const auto actual_segments =
+        ExpressionEvaluator{table_a, ChunkID{0}}.evaluate_expressions_to_segments_batched(expressions, batch_size);
+    ASSERT_EQ(actual_segments.size(), expressions.size());
+
+    for (auto expression_idx = size_t{0}; expression_idx < expressions.size(); ++expression_idx) {
+      const auto expected_segment =
+          ExpressionEvaluator{table_a, ChunkID{0}}.evaluate_expression_to_segment(*expressions[expression_idx]);
+      EXPECT_EQ(actual_segments[expression_idx]->is_nullable(), expected_segment->is_nullable());
+      EXPECT_SEGMENT_EQ_ORDERED(actual_segments[expression_idx], expected_segment);
+    }
+  }
+}
+
+TEST_F(ExpressionEvaluatorToValuesTest, SegmentsBatchedWithCommonSubexpressions) {
+  // a + b and a + c occur repeatedly, also with a different result type (in the CASE) and within a repeated expression
+  const auto expressions = std::vector<std::shared_ptr<AbstractExpression>>{
+      a_plus_b, mul_(a_plus_b, a_plus_c), mul_(a_plus_b, a_plus_c), case_(greater_than_(a_plus_c, 5), a_plus_b, 0.5),
+      substr_(s1, a_plus_b, 2)};
+
+  // A batch size of 100 evaluates the entire Chunk at once
+  for (const auto batch_size : {ChunkOffset{1}, ChunkOffset{3}, ChunkOffset{100}}) {
+    const auto actual_segments =
+        ExpressionEvaluator{table_a, ChunkID{0}}.evaluate_expressions_to_segments_batched(expressions, batch_size);
+    ASSERT_EQ(actual_segments.size(), expressions.size());
+
+    for (auto expression_idx = size_t{0}; expression_idx < expressions.size(); ++expression_idx) {
+      const auto expected_segment =
+          ExpressionEvaluator{table_a, ChunkID{0}}.evaluate_expression_to_segment(*expressions[expression_idx]);
+      EXPECT_SEGMENT_EQ_ORDERED(actual_segments[expression_idx], expected_segment);
+    }
+  }
+}
+
 }  // namespace opossum
@@ -54,4 +54,34 @@ TEST_F(LikeMatcherTest, NotMatching) {
   EXPECT_FALSE(match("Hello", "He_o"));
 }
 
+TEST_F(LikeMatcherTest, GenericPattern) {
+  EXPECT_TRUE(std::holds_alternative<LikeMatcher::GenericPattern>(
+      LikeMatcher::pattern_string_to_pattern_variant("H_llo%W%d")));
+
+  EXPECT_TRUE(match("", ""));
+  EXPECT_TRUE(match("", "%"));
+  EXPECT_TRUE(match("", "%%"));
+  EXPECT_TRUE(match("a", "_"));
+  EXPECT_TRUE(match("Hello World", "H_llo%W%d"));
+  EXPECT_TRUE(match("Hello World", "H%o%o%"));
+  EXPECT_TRUE(match("Hello World", "%o_W%"));
+  EXPECT_TRUE(match("Hello World", "%l_o%l_%"));
+  EXPECT_TRUE(match("aaab", "%a_b"));
+  EXPECT_TRUE(match("abcabd", "a%ab_"));
+  EXPECT_TRUE(match("abab", "ab%ab"));
+  EXPECT_TRUE(match("Line\nbreak", "Line_break"));
+  EXPECT_TRUE(match("Line\nbreak", "%\n%"));
+
+  EXPECT_FALSE(match("", "_"));
+  EXPECT_FALSE(match("", "a%"));
+  EXPECT_FALSE(match("ab", "_"));
+  EXPECT_FALSE(match("Hello World", "H_llo%X%d"));
+  EXPECT_FALSE(match("Hello World", "%o_W"));
+  EXPECT_FALSE(match("aab", "%a_a%"));
+  EXPECT_FALSE(match("aba", "ab%ba"));
+  EXPECT_FALSE(match("abc", "ab%_bc"));
+  EXPECT_FALSE(match("b", ""));
+  EXPECT_FALSE(match("xaxbx", "%a%b"));
+}
+
 }  // namespace opossum
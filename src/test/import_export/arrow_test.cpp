@@ -0,0 +1,200 @@
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "import_export/arrow.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class ArrowExportTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("a", DataType::Int, true);
+    column_definitions.emplace_back("b", DataType::Double);
+    column_definitions.emplace_back("c", DataType::String, true);
+
+    // The values of chunks with reserved rows are stored contiguously
+    table = std::make_shared<Table>(column_definitions, TableType::Data, 4, UseMvcc::Yes);
+    table->append_mutable_chunk(ChunkOffset{4});
+    table->append({1, 1.5, "one"});
+    table->append({NULL_VALUE, 2.5, NULL_VALUE});
+    table->append({3, 3.5, ""});
+    table->append({3, 4.5, "four"});
+    table->append_mutable_chunk(ChunkOffset{4});
+    table->append({5, 5.5, "five"});
+  }
+
+  void TearDown() override {
+    if (schema.release) schema.release(&schema);
+    if (array.release) array.release(&array);
+  }
+
+  static bool is_valid(const ArrowArray& array, const size_t index) {
+    const auto* bitmap = static_cast<const uint8_t*>(array.buffers[0]);
+    return !bitmap || (bitmap[index / 8] >> (index % 8)) & 1;
+  }
+
+  static std::string string_at(const ArrowArray& array, const size_t index) {
+    const auto* offsets = static_cast<const int32_t*>(array.buffers[1]);
+    const auto* data = static_cast<const char*>(array.buffers[2]);
+    return std::string(data + offsets[index], data + offsets[index + 1]);
+  }
+
+  std::shared_ptr<Table> table;
+  ArrowSchema schema{};
+  ArrowArray array{};
+};
+
+TEST_F(ArrowExportTest, ValueSegments) {
+  export_chunk_to_arrow(*table, ChunkID{0}, &schema, &array);
+
+  EXPECT_STREQ(schema.format, "+s");
+  ASSERT_EQ(schema.n_children, 3);
+  EXPECT_STREQ(schema.children[0]->format, "i");
+  EXPECT_STREQ(schema.children[0]->name, "a");
+  EXPECT_EQ(schema.children[0]->flags, ARROW_FLAG_NULLABLE);
+  EXPECT_STREQ(schema.children[1]->format, "g");
+  EXPECT_EQ(schema.children[1]->flags, 0);
+  EXPECT_STREQ(schema.children[2]->format, "u");
+
+  EXPECT_EQ(array.length, 4);
+  ASSERT_EQ(array.n_children, 3);
+
+  // Numbers are not copied, only the validity bitmap is created
+  const auto& int_array = *array.children[0];
+  const auto int_segment =
+      std::static_pointer_cast<ValueSegment<int32_t>>(table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  EXPECT_EQ(int_array.n_buffers, 2);
+  EXPECT_EQ(int_array.buffers[1], &int_segment->values()[0]);
+  EXPECT_EQ(int_array.null_count, 1);
+  EXPECT_TRUE(is_valid(int_array, 0));
+  EXPECT_FALSE(is_valid(int_array, 1));
+  EXPECT_EQ(static_cast<const int32_t*>(int_array.buffers[1])[3], 3);
+
+  const auto& double_array = *array.children[1];
+  EXPECT_EQ(double_array.null_count, 0);
+  EXPECT_EQ(double_array.buffers[0], nullptr);
+  EXPECT_EQ(static_cast<const double*>(double_array.buffers[1])[2], 3.5);
+
+  const auto& string_array = *array.children[2];
+  EXPECT_EQ(string_array.n_buffers, 3);
+  EXPECT_EQ(string_array.null_count, 1);
+  EXPECT_FALSE(is_valid(string_array, 1));
+  EXPECT_EQ(string_at(string_array, 0), "one");
+  EXPECT_EQ(string_at(string_array, 1), "");
+  EXPECT_EQ(string_at(string_array, 2), "");
+  EXPECT_EQ(string_at(string_array, 3), "four");
+}
+
+TEST_F(ArrowExportTest, NonContiguousValueSegments) {
+  auto appended_table = std::make_shared<Table>(table->column_definitions(), TableType::Data, 4);
+  appended_table->append({1, 1.5, "one"});
+  appended_table->append({2, 2.5, "two"});
+  appended_table->append({3, 3.5, "three"});
+
+  // Values that were appended without reserving memory are spread over multiple allocations and have to be copied
+  export_chunk_to_arrow(*appended_table, ChunkID{0}, &schema, &array);
+  const auto int_segment =
+      std::static_pointer_cast<ValueSegment<int32_t>>(appended_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  EXPECT_NE(array.children[0]->buffers[1], &int_segment->values()[0]);
+
+  const auto* values = static_cast<const int32_t*>(array.children[0]->buffers[1]);
+  EXPECT_EQ(values[0], 1);
+  EXPECT_EQ(values[2], 3);
+  EXPECT_EQ(static_cast<const double*>(array.children[1]->buffers[1])[2], 3.5);
+}
+
+TEST_F(ArrowExportTest, DictionarySegments) {
+  ChunkEncoder::encode_all_chunks(table, {EncodingType::Dictionary, VectorCompressionType::FixedSizeByteAligned});
+  export_chunk_to_arrow(*table, ChunkID{0}, &schema, &array);
+
+  // The dictionaries are sorted, so that the dictionary arrays are ordered
+  const auto& int_schema = *schema.children[0];
+  EXPECT_STREQ(int_schema.format, "C");
+  EXPECT_EQ(int_schema.flags, ARROW_FLAG_NULLABLE | ARROW_FLAG_DICTIONARY_ORDERED);
+  ASSERT_TRUE(int_schema.dictionary);
+  EXPECT_STREQ(int_schema.dictionary->format, "i");
+
+  const auto& int_array = *array.children[0];
+  EXPECT_EQ(int_array.null_count, 1);
+  EXPECT_FALSE(is_valid(int_array, 1));
+  const auto* indices = static_cast<const uint8_t*>(int_array.buffers[1]);
+  ASSERT_TRUE(int_array.dictionary);
+  EXPECT_EQ(int_array.dictionary->length, 2);
+  const auto* dictionary = static_cast<const int32_t*>(int_array.dictionary->buffers[1]);
+  EXPECT_EQ(dictionary[indices[0]], 1);
+  EXPECT_EQ(dictionary[indices[2]], 3);
+  EXPECT_EQ(indices[2], indices[3]);
+
+  const auto& string_schema = *schema.children[2];
+  EXPECT_STREQ(string_schema.format, "C");
+  EXPECT_STREQ(string_schema.dictionary->format, "u");
+
+  const auto& string_array = *array.children[2];
+  const auto* string_indices = static_cast<const uint8_t*>(string_array.buffers[1]);
+  EXPECT_EQ(string_array.dictionary->length, 3);
+  EXPECT_EQ(string_at(*string_array.dictionary, string_indices[0]), "one");
+  EXPECT_EQ(string_at(*string_array.dictionary, string_indices[3]), "four");
+}
+
+TEST_F(ArrowExportTest, MaterializedSegments) {
+  ChunkEncoder::encode_all_chunks(table, {EncodingType::Dictionary, VectorCompressionType::SimdBp128});
+  export_chunk_to_arrow(*table, ChunkID{1}, &schema, &array);
+
+  // SIMD-BP128-compressed attribute vectors cannot be shared, so the values are materialized
+  EXPECT_STREQ(schema.children[0]->format, "i");
+  EXPECT_EQ(schema.children[0]->dictionary, nullptr);
+  EXPECT_EQ(array.length, 1);
+  EXPECT_EQ(static_cast<const int32_t*>(array.children[0]->buffers[1])[0], 5);
+  EXPECT_EQ(string_at(*array.children[2], 0), "five");
+}
+
+TEST_F(ArrowExportTest, ReferenceSegments) {
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto scan = create_table_scan(table_wrapper, ColumnID{1}, PredicateCondition::GreaterThan, 2.0);
+  scan->execute();
+
+  export_chunk_to_arrow(*scan->get_output(), ChunkID{0}, &schema, &array);
+
+  EXPECT_EQ(array.length, 3);
+  EXPECT_EQ(array.children[0]->null_count, 1);
+  EXPECT_FALSE(is_valid(*array.children[0], 0));
+  EXPECT_EQ(static_cast<const int32_t*>(array.children[0]->buffers[1])[1], 3);
+  EXPECT_EQ(static_cast<const double*>(array.children[1]->buffers[1])[2], 4.5);
+  EXPECT_EQ(string_at(*array.children[2], 2), "four");
+}
+
+TEST_F(ArrowExportTest, ArraysOutliveTable) {
+  export_chunk_to_arrow(*table, ChunkID{0}, &schema, &array);
+  table = nullptr;
+
+  EXPECT_EQ(static_cast<const int32_t*>(array.children[0]->buffers[1])[3], 3);
+  EXPECT_EQ(string_at(*array.children[2], 3), "four");
+}
+
+TEST_F(ArrowExportTest, ReleaseMovedChild) {
+  export_chunk_to_arrow(*table, ChunkID{0}, &schema, &array);
+
+  // Consumers may move a child out of its parent and release it independently
+  auto child = ArrowArray{};
+  std::memcpy(&child, array.children[0], sizeof(ArrowArray));
+  array.children[0]->release = nullptr;
+
+  array.release(&array);
+  EXPECT_EQ(array.release, nullptr);
+  EXPECT_EQ(static_cast<const int32_t*>(child.buffers[1])[0], 1);
+  child.release(&child);
+  EXPECT_EQ(child.release, nullptr);
+}
+
+}  // namespace opossum
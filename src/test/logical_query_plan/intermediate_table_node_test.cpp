@@ -0,0 +1,91 @@
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/intermediate_table_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/table_wrapper.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/storage_manager.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class IntermediateTableNodeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("int_float", load_table("resources/test_data/tbl/int_float.tbl", 2));
+    StorageManager::get().add_table("int_float2", load_table("resources/test_data/tbl/int_float2.tbl", 2));
+
+    _stored_table_node_a = StoredTableNode::make("int_float");
+    _stored_table_node_b = StoredTableNode::make("int_float2");
+    _a_a = _stored_table_node_a->get_column("a");
+    _b_a = _stored_table_node_b->get_column("a");
+
+    _join_node = JoinNode::make(JoinMode::Inner, equals_(_a_a, _b_a), _stored_table_node_a, _stored_table_node_b);
+
+    // Mimics the result of the join, the node does not care about its content
+    _table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false},
+                                                            {"b", DataType::Float, false},
+                                                            {"a", DataType::Int, false},
+                                                            {"b", DataType::Float, false}},
+                                     TableType::Data);
+    _table->append({12345, 458.7f, 12345, 456.7f});
+
+    _intermediate_table_node = IntermediateTableNode::make(_join_node, _table);
+  }
+
+  std::shared_ptr<StoredTableNode> _stored_table_node_a, _stored_table_node_b;
+  std::shared_ptr<JoinNode> _join_node;
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<IntermediateTableNode> _intermediate_table_node;
+  LQPColumnReference _a_a, _b_a;
+};
+
+TEST_F(IntermediateTableNodeTest, Description) {
+  const auto estimated_row_count = _join_node->get_statistics()->row_count();
+
+  std::ostringstream expected_description;
+  expected_description << "[IntermediateTable] 1 row(s), estimated " << estimated_row_count << " row(s)";
+  EXPECT_EQ(_intermediate_table_node->description(), expected_description.str());
+}
+
+TEST_F(IntermediateTableNodeTest, ColumnExpressions) {
+  EXPECT_EQ(_intermediate_table_node->column_expressions(), _join_node->column_expressions());
+  EXPECT_EQ(_intermediate_table_node->find_column_id(*lqp_column_(_b_a)), ColumnID{2});
+  EXPECT_TRUE(_intermediate_table_node->node_expressions.empty());
+}
+
+TEST_F(IntermediateTableNodeTest, Statistics) {
+  const auto statistics = _intermediate_table_node->get_statistics();
+  EXPECT_FLOAT_EQ(statistics->row_count(), 1.0f);
+  EXPECT_EQ(statistics->column_statistics().size(), 4u);
+}
+
+TEST_F(IntermediateTableNodeTest, Equals) {
+  EXPECT_EQ(*_intermediate_table_node, *_intermediate_table_node);
+  EXPECT_EQ(*_intermediate_table_node, *IntermediateTableNode::make(_join_node, _table));
+
+  const auto other_table = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+  EXPECT_NE(*_intermediate_table_node, *IntermediateTableNode::make(_join_node, other_table));
+}
+
+TEST_F(IntermediateTableNodeTest, Copy) {
+  EXPECT_EQ(*_intermediate_table_node->deep_copy(), *_intermediate_table_node);
+}
+
+TEST_F(IntermediateTableNodeTest, Translation) {
+  const auto pqp = LQPTranslator{}.translate_node(_intermediate_table_node);
+  ASSERT_EQ(pqp->type(), OperatorType::TableWrapper);
+
+  pqp->execute();
+  EXPECT_EQ(pqp->get_output(), _table);
+}
+
+}  // namespace opossum
@@ -3,6 +3,7 @@
 #include "base_test.hpp"
 #include "expression/expression_functional.hpp"
 #include "logical_query_plan/jit_aware_lqp_translator.hpp"
+#include "logical_query_plan/join_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/projection_node.hpp"
 #include "logical_query_plan/sort_node.hpp"
@@ -12,6 +13,8 @@
 #include "operators/jit_operator/operators/jit_aggregate.hpp"
 #include "operators/jit_operator/operators/jit_compute.hpp"
 #include "operators/jit_operator/operators/jit_filter.hpp"
+#include "operators/jit_operator/operators/jit_hash_join_build.hpp"
+#include "operators/jit_operator/operators/jit_hash_join_probe.hpp"
 #include "operators/jit_operator/operators/jit_limit.hpp"
 #include "operators/jit_operator/operators/jit_read_tuples.hpp"
 #include "operators/jit_operator/operators/jit_validate.hpp"
@@ -419,6 +422,66 @@ TEST_F(JitAwareLQPTranslatorTest, CheckOperatorOrderValidateBeforeFilter) {
   ASSERT_TRUE(jit_write_references);
 }
 
+TEST_F(JitAwareLQPTranslatorTest, HashJoin) {
+  const auto b_a = stored_table_node_b->get_column("a");
+
+  // clang-format off
+  const auto lqp = PredicateNode::make(greater_than_(b_a, a_b),
+                     JoinNode::make(JoinMode::Inner, equals_(a_a, b_a),
+                       PredicateNode::make(greater_than_(a_a, 1), stored_table_node_a),
+                       stored_table_node_b));
+  // clang-format on
+
+  const auto jit_operator_wrapper = translate_lqp(lqp);
+  ASSERT_TRUE(jit_operator_wrapper);
+  ASSERT_TRUE(jit_operator_wrapper->input_right());
+
+  // The build pipeline stores the key and the two columns of table_b that are accessed after the join
+  const auto build_jit_operators = jit_operator_wrapper->build_jit_operators();
+  ASSERT_EQ(build_jit_operators.size(), 2u);
+  ASSERT_TRUE(std::dynamic_pointer_cast<JitReadTuples>(build_jit_operators[0]));
+  const auto jit_hash_join_build = std::dynamic_pointer_cast<JitHashJoinBuild>(build_jit_operators[1]);
+  ASSERT_TRUE(jit_hash_join_build);
+  ASSERT_EQ(jit_hash_join_build->key_columns().size(), 1u);
+  ASSERT_EQ(jit_hash_join_build->value_columns().size(), 2u);
+
+  // The predicate below the join is evaluated before, the one above the join after probing the hash table
+  const auto jit_operators = jit_operator_wrapper->jit_operators();
+  ASSERT_EQ(jit_operators.size(), 5u);
+  ASSERT_TRUE(std::dynamic_pointer_cast<JitReadTuples>(jit_operators[0]));
+  ASSERT_TRUE(std::dynamic_pointer_cast<JitFilter>(jit_operators[1]));
+  const auto jit_hash_join_probe = std::dynamic_pointer_cast<JitHashJoinProbe>(jit_operators[2]);
+  ASSERT_TRUE(jit_hash_join_probe);
+  ASSERT_EQ(jit_hash_join_probe->hash_join_build, jit_hash_join_build);
+  ASSERT_EQ(jit_hash_join_probe->key_columns().size(), 1u);
+  ASSERT_EQ(jit_hash_join_probe->value_columns().size(), 2u);
+  ASSERT_TRUE(std::dynamic_pointer_cast<JitFilter>(jit_operators[3]));
+
+  // Columns of the build input are not part of the input table and must be materialized
+  ASSERT_TRUE(std::dynamic_pointer_cast<JitWriteTuples>(jit_operators[4]));
+}
+
+TEST_F(JitAwareLQPTranslatorTest, HashJoinExcludesValidateAboveJoin) {
+  const auto b_a = stored_table_node_b->get_column("a");
+
+  // clang-format off
+  const auto lqp = ValidateNode::make(
+                     JoinNode::make(JoinMode::Inner, equals_(a_a, b_a),
+                       PredicateNode::make(greater_than_(a_a, 1), stored_table_node_a),
+                       stored_table_node_b));
+  // clang-format on
+
+  // A JitValidate after the JitHashJoinProbe would not validate the build input, so the ValidateNode is translated to
+  // a Validate operator on top of the jitted join
+  JitAwareLQPTranslator lqp_translator;
+  const auto validate = lqp_translator.translate_node(lqp);
+  ASSERT_FALSE(std::dynamic_pointer_cast<const JitOperatorWrapper>(validate));
+
+  const auto jit_operator_wrapper = std::dynamic_pointer_cast<const JitOperatorWrapper>(validate->input_left());
+  ASSERT_TRUE(jit_operator_wrapper);
+  ASSERT_EQ(jit_operator_wrapper->build_jit_operators().size(), 2u);
+}
+
 TEST_F(JitAwareLQPTranslatorTest, AMoreComplexQuery) {
   // clang-format off
   const auto lqp = ProjectionNode::make(expression_vector(a_a, mul_(add_(a_a, a_b), a_c)),  // SELECT a, (a + b) * c
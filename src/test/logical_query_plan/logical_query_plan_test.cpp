@@ -323,6 +323,28 @@ TEST_F(LogicalQueryPlanTest, DeepCopyBasics) {
   EXPECT_EQ(copied_expression_b->column_reference.original_node(), copied_node_int_int);
 }
 
+TEST_F(LogicalQueryPlanTest, Hash) {
+  const auto lqp = PredicateNode::make(greater_than_(a1, 5), ProjectionNode::make(expression_vector(a1), node_int_int));
+
+  // Equal LQPs have equal hashes, even though their LQPColumnExpressions reference different nodes
+  const auto copied_lqp = lqp->deep_copy();
+  EXPECT_EQ(*copied_lqp, *lqp);
+  EXPECT_EQ(copied_lqp->hash(), lqp->hash());
+
+  const auto other_node_int_int = StoredTableNode::make("int_int");
+  const auto other_a1 = other_node_int_int->get_column("a");
+  const auto equal_lqp = PredicateNode::make(greater_than_(other_a1, 5),
+                                             ProjectionNode::make(expression_vector(other_a1), other_node_int_int));
+  EXPECT_EQ(equal_lqp->hash(), lqp->hash());
+
+  // Different literals, columns, and tables lead to different hashes
+  EXPECT_NE(PredicateNode::make(greater_than_(a1, 6), lqp->left_input())->hash(), lqp->hash());
+  EXPECT_NE(PredicateNode::make(greater_than_(b1, 5), lqp->left_input())->hash(), lqp->hash());
+  EXPECT_NE(PredicateNode::make(greater_than_(a2, 5), ProjectionNode::make(expression_vector(a2), node_int_int_int))
+                ->hash(),
+            lqp->hash());
+}
+
 TEST_F(LogicalQueryPlanTest, PrintWithoutSubquery) {
   // clang-format off
   const auto lqp =
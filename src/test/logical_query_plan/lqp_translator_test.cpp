@@ -43,7 +43,10 @@
 #include "operators/projection.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_positions.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
 #include "storage/prepared_plan.hpp"
@@ -327,28 +330,72 @@ TEST_F(LQPTranslatorTest, Sort) {
   const auto projection_a = std::dynamic_pointer_cast<const Projection>(pqp);
   ASSERT_TRUE(projection_a);
 
-  const auto sort_a = std::dynamic_pointer_cast<const Sort>(pqp->input_left());
-  ASSERT_TRUE(sort_a);
-  EXPECT_EQ(sort_a->column_id(), ColumnID{1});
-  EXPECT_EQ(sort_a->order_by_mode(), OrderByMode::Ascending);
+  const auto sort = std::dynamic_pointer_cast<const Sort>(pqp->input_left());
+  ASSERT_TRUE(sort);
+  const auto& sort_definitions = sort->sort_definitions();
+  ASSERT_EQ(sort_definitions.size(), 3u);
+  EXPECT_EQ(sort_definitions[0].column, ColumnID{1});
+  EXPECT_EQ(sort_definitions[0].order_by_mode, OrderByMode::Ascending);
+  EXPECT_EQ(sort_definitions[1].column, ColumnID{0});
+  EXPECT_EQ(sort_definitions[1].order_by_mode, OrderByMode::Descending);
+  EXPECT_EQ(sort_definitions[2].column, ColumnID{2});
+  EXPECT_EQ(sort_definitions[2].order_by_mode, OrderByMode::AscendingNullsLast);
+
+  const auto projection_b = std::dynamic_pointer_cast<const Projection>(sort->input_left());
+  ASSERT_TRUE(projection_b);
 
-  const auto sort_a_plus_b = std::dynamic_pointer_cast<const Sort>(sort_a->input_left());
-  ASSERT_TRUE(sort_a_plus_b);
-  EXPECT_EQ(sort_a_plus_b->column_id(), ColumnID{0});
-  EXPECT_EQ(sort_a_plus_b->order_by_mode(), OrderByMode::Descending);
+  const auto get_table = std::dynamic_pointer_cast<const GetTable>(projection_b->input_left());
+  ASSERT_TRUE(get_table);
+}
 
-  const auto sort_b = std::dynamic_pointer_cast<const Sort>(sort_a_plus_b->input_left());
-  ASSERT_TRUE(sort_b);
-  EXPECT_EQ(sort_b->column_id(), ColumnID{2});
-  EXPECT_EQ(sort_b->order_by_mode(), OrderByMode::AscendingNullsLast);
+TEST_F(LQPTranslatorTest, LimitOnSortIsTopK) {
+  /**
+   * Build LQP and translate to PQP
+   *
+   * LQP resembles:
+   *   SELECT * FROM int_float ORDER BY b DESC, a LIMIT 10
+   */
+  const auto order_by_modes = std::vector<OrderByMode>{OrderByMode::Descending, OrderByMode::Ascending};
 
-  const auto projection_b = std::dynamic_pointer_cast<const Projection>(sort_b->input_left());
-  ASSERT_TRUE(projection_b);
+  // clang-format off
+  const auto lqp =
+  LimitNode::make(value_(int64_t{10}),
+    SortNode::make(expression_vector(int_float_b, int_float_a), order_by_modes,
+      int_float_node));
+  // clang-format on
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
 
-  const auto get_table = std::dynamic_pointer_cast<const GetTable>(projection_b->input_left());
+  /**
+   * Check PQP
+   */
+  const auto top_k = std::dynamic_pointer_cast<const TopK>(pqp);
+  ASSERT_TRUE(top_k);
+  const auto& sort_definitions = top_k->sort_definitions();
+  ASSERT_EQ(sort_definitions.size(), 2u);
+  EXPECT_EQ(sort_definitions[0].column, ColumnID{1});
+  EXPECT_EQ(sort_definitions[0].order_by_mode, OrderByMode::Descending);
+  EXPECT_EQ(sort_definitions[1].column, ColumnID{0});
+  EXPECT_EQ(sort_definitions[1].order_by_mode, OrderByMode::Ascending);
+  EXPECT_EQ(*top_k->row_count_expression(), *value_(int64_t{10}));
+
+  const auto get_table = std::dynamic_pointer_cast<const GetTable>(top_k->input_left());
   ASSERT_TRUE(get_table);
 }
 
+TEST_F(LQPTranslatorTest, LimitOnSharedSortIsNotTopK) {
+  /**
+   * The fully sorted table is needed by the UnionNode, too
+   */
+  const auto sort_node =
+      SortNode::make(expression_vector(int_float_a), std::vector<OrderByMode>{OrderByMode::Ascending}, int_float_node);
+  const auto lqp = UnionNode::make(UnionMode::Positions, LimitNode::make(value_(int64_t{10}), sort_node), sort_node);
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  const auto limit = std::dynamic_pointer_cast<const Limit>(pqp->input_left());
+  ASSERT_TRUE(limit);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const Sort>(limit->input_left()));
+}
+
 TEST_F(LQPTranslatorTest, LimitLiteral) {
   /**
    * Build LQP and translate to PQP
@@ -664,6 +711,66 @@ TEST_F(LQPTranslatorTest, JoinAndPredicates) {
   EXPECT_EQ(get_table_op_right->table_name(), "table_int_float2");
 }
 
+TEST_F(LQPTranslatorTest, JoinWithRuntimeChunkPruning) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  const auto stored_table_node = StoredTableNode::make("int_float_chunked");
+  const auto chunked_a = stored_table_node->get_column("a");
+
+  // clang-format off
+  const auto lqp =
+  JoinNode::make(JoinMode::Inner, equals_(chunked_a, int_float2_a),
+    stored_table_node,
+    PredicateNode::make(equals_(int_float2_a, 123), int_float2_node));
+  // clang-format on
+
+  const auto op = LQPTranslator{}.translate_node(lqp);
+
+  /**
+   * Check PQP: The keys of the (smaller) right input are used to prune the Chunks of the left input at runtime
+   */
+  const auto join_op = std::dynamic_pointer_cast<const JoinHash>(op);
+  ASSERT_TRUE(join_op);
+
+  const auto get_table_op = std::dynamic_pointer_cast<const GetTable>(join_op->input_left());
+  ASSERT_TRUE(get_table_op);
+  EXPECT_EQ(get_table_op->runtime_pruning_column_id(), ColumnID{0});
+  EXPECT_EQ(get_table_op->input_left(), join_op->input_right());
+
+  const auto get_table_op_right = std::dynamic_pointer_cast<const GetTable>(join_op->input_right()->input_left());
+  ASSERT_TRUE(get_table_op_right);
+  EXPECT_FALSE(get_table_op_right->runtime_pruning_column_id());
+
+  /**
+   * Check execution: Only the Chunk with a = 123 is retrieved
+   */
+  CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(op, CleanupTemporaries::No));
+  EXPECT_EQ(get_table_op->runtime_pruned_chunk_ids(), std::vector({ChunkID{0}, ChunkID{2}}));
+  EXPECT_EQ(op->get_output()->row_count(), 1u);
+}
+
+TEST_F(LQPTranslatorTest, JoinWithoutRuntimeChunkPruning) {
+  // No runtime pruning for outer joins - the pruned input would lose rows that are part of the result
+  const auto outer_join_node = JoinNode::make(JoinMode::Left, equals_(int_float_a, int_float2_a), int_float_node,
+                                              PredicateNode::make(equals_(int_float2_a, 123), int_float2_node));
+  const auto outer_join_op = LQPTranslator{}.translate_node(outer_join_node);
+  const auto outer_get_table_op = std::dynamic_pointer_cast<const GetTable>(outer_join_op->input_left());
+  ASSERT_TRUE(outer_get_table_op);
+  EXPECT_FALSE(outer_get_table_op->runtime_pruning_column_id());
+
+  // No runtime pruning if the StoredTableNode is used elsewhere, because the other users would observe the pruning
+  const auto stored_table_node = StoredTableNode::make("table_int_float");
+  const auto a = stored_table_node->get_column("a");
+  const auto shared_join_node = JoinNode::make(JoinMode::Inner, equals_(a, int_float2_a), stored_table_node,
+                                               PredicateNode::make(equals_(int_float2_a, 123), int_float2_node));
+  const auto other_output_node = PredicateNode::make(greater_than_(a, 5), stored_table_node);
+  const auto shared_get_table_op =
+      std::dynamic_pointer_cast<const GetTable>(LQPTranslator{}.translate_node(shared_join_node)->input_left());
+  ASSERT_TRUE(shared_get_table_op);
+  EXPECT_FALSE(shared_get_table_op->runtime_pruning_column_id());
+}
+
 TEST_F(LQPTranslatorTest, LimitNode) {
   /**
    * Build LQP and translate to PQP
@@ -0,0 +1,109 @@
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/export_parquet.hpp"
+#include "operators/import_parquet.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsExportParquetTest : public BaseTest {
+ protected:
+  void SetUp() override { table = create_table(); }
+
+  void TearDown() override { std::remove(filename.c_str()); }
+
+  static std::shared_ptr<Table> create_table() {
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("a", DataType::String, true);
+    column_definitions.emplace_back("b", DataType::Int);
+    column_definitions.emplace_back("c", DataType::Long, true);
+    column_definitions.emplace_back("d", DataType::Float);
+    column_definitions.emplace_back("e", DataType::Double, true);
+
+    auto table = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+    table->append({"AAAAA", 1, int64_t{100}, 1.1f, 11.1});
+    table->append({NULL_VALUE, 2, int64_t{200}, 2.2f, NULL_VALUE});
+    table->append({"", 3, NULL_VALUE, 3.3f, 33.3});
+    table->append({"DDDDDDDDDDDDDDDDDDDD", -4, int64_t{-400}, -4.4f, -44.4});
+    table->append({NULL_VALUE, 5, NULL_VALUE, 5.5f, NULL_VALUE});
+    return table;
+  }
+
+  std::shared_ptr<const Table> export_and_import(const std::shared_ptr<AbstractOperator>& input) {
+    auto ex = std::make_shared<ExportParquet>(input, filename);
+    ex->execute();
+
+    auto importer = std::make_shared<ImportParquet>(filename);
+    importer->execute();
+    return importer->get_output();
+  }
+
+  std::shared_ptr<TableWrapper> wrap(const std::shared_ptr<Table>& table) {
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  std::shared_ptr<Table> table;
+  const std::string filename = test_data_path + "export_test.parquet";
+};
+
+TEST_F(OperatorsExportParquetTest, ValueSegments) {
+  const auto imported_table = export_and_import(wrap(table));
+
+  EXPECT_TABLE_EQ_ORDERED(imported_table, table);
+  // Each chunk is written as a row group, which becomes a chunk again
+  EXPECT_EQ(imported_table->chunk_count(), 3u);
+  EXPECT_EQ(imported_table->max_chunk_size(), 2u);
+}
+
+TEST_F(OperatorsExportParquetTest, EncodedSegments) {
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}}, EncodingType::Dictionary);
+  ChunkEncoder::encode_chunks(table, {ChunkID{1}}, EncodingType::RunLength);
+
+  EXPECT_TABLE_EQ_ORDERED(export_and_import(wrap(table)), create_table());
+}
+
+TEST_F(OperatorsExportParquetTest, ReferenceSegments) {
+  auto scan = create_table_scan(wrap(table), ColumnID{1}, PredicateCondition::GreaterThan, 1);
+  scan->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(export_and_import(scan), scan->get_output());
+}
+
+TEST_F(OperatorsExportParquetTest, EmptyTable) {
+  const auto empty_table = Table::create_dummy_table(table->column_definitions());
+
+  const auto imported_table = export_and_import(wrap(empty_table));
+
+  EXPECT_EQ(imported_table->column_definitions(), table->column_definitions());
+  EXPECT_EQ(imported_table->row_count(), 0u);
+}
+
+TEST_F(OperatorsExportParquetTest, PrunableStatistics) {
+  const auto imported_table = export_and_import(wrap(table));
+
+  // The first row group contains b = 1 and b = 2, the second one b = 3 and b = -4
+  const auto first_statistics = imported_table->get_chunk(ChunkID{0})->statistics();
+  ASSERT_TRUE(first_statistics);
+  EXPECT_TRUE(first_statistics->can_prune(ColumnID{1}, PredicateCondition::GreaterThan, 2));
+  EXPECT_FALSE(first_statistics->can_prune(ColumnID{1}, PredicateCondition::Equals, 2));
+  EXPECT_TRUE(first_statistics->can_prune(ColumnID{0}, PredicateCondition::Equals, pmr_string{"B"}));
+
+  const auto second_statistics = imported_table->get_chunk(ChunkID{1})->statistics();
+  ASSERT_TRUE(second_statistics);
+  EXPECT_TRUE(second_statistics->can_prune(ColumnID{1}, PredicateCondition::LessThan, -4));
+  EXPECT_FALSE(second_statistics->can_prune(ColumnID{1}, PredicateCondition::BetweenInclusive, 0, 1));
+  EXPECT_TRUE(second_statistics->can_prune(ColumnID{2}, PredicateCondition::LessThan, int64_t{-400}));
+}
+
+}  // namespace opossum
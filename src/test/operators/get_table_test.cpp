@@ -6,8 +6,10 @@
 #include "concurrency/transaction_context.hpp"
 #include "operators/delete.hpp"
 #include "operators/get_table.hpp"
+#include "operators/table_wrapper.hpp"
 #include "operators/validate.hpp"
 #include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 
@@ -54,6 +56,17 @@ TEST_F(OperatorsGetTableTest, Description) {
             "GetTable\n(int_int_float)\npruned:\n1/4 chunk(s)\n1/3 column(s)");
 }
 
+TEST_F(OperatorsGetTableTest, DescriptionWithRuntimePruning) {
+  const auto key_source = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int.tbl"));
+  const auto get_table = std::make_shared<opossum::GetTable>("int_int_float");
+  get_table->set_runtime_pruning(key_source, ColumnID{0}, ColumnID{0});
+
+  EXPECT_EQ(get_table->description(DescriptionMode::SingleLine),
+            "GetTable (int_int_float) pruned: 0/4 chunk(s), 0/3 column(s), runtime pruning on a");
+  EXPECT_EQ(get_table->description(DescriptionMode::MultiLine),
+            "GetTable\n(int_int_float)\npruned:\n0/4 chunk(s)\n0/3 column(s)\nruntime pruning on a");
+}
+
 TEST_F(OperatorsGetTableTest, PrunedChunks) {
   auto get_table = std::make_shared<opossum::GetTable>("int_int_float", std::vector{ChunkID{0}, ChunkID{2}},
                                                        std::vector<ColumnID>{});
@@ -199,6 +212,32 @@ TEST_F(OperatorsGetTableTest, PrunedChunksCombined) {
   EXPECT_EQ(get_table_2->get_output()->chunk_count(), 1);
 }
 
+TEST_F(OperatorsGetTableTest, RuntimePrunedChunks) {
+  // Runtime pruning relies on the ChunkStatistics created during encoding
+  ChunkEncoder::encode_all_chunks(StorageManager::get().get_table("int_int_float"));
+
+  const auto keys = std::make_shared<Table>(TableColumnDefinitions{{"key", DataType::Int, true}}, TableType::Data);
+  keys->append({11});
+  keys->append({NULL_VALUE});
+  keys->append({9});
+  const auto key_source = std::make_shared<TableWrapper>(keys);
+  key_source->execute();
+
+  const auto get_table =
+      std::make_shared<GetTable>("int_int_float", std::vector{ChunkID{3}}, std::vector<ColumnID>{ColumnID{1}});
+  get_table->set_runtime_pruning(key_source, ColumnID{0}, ColumnID{0});
+  get_table->execute();
+
+  // Chunk 1 (a = 10) lies within the range of the keys, but matches none of them. Chunk 3 was pruned statically.
+  EXPECT_EQ(get_table->runtime_pruned_chunk_ids(), std::vector{ChunkID{1}});
+
+  const auto table = get_table->get_output();
+  EXPECT_EQ(table->chunk_count(), 2u);
+  EXPECT_EQ(table->column_count(), 2u);
+  EXPECT_EQ(table->get_value<int>(ColumnID{0}, 0u), 9);
+  EXPECT_EQ(table->get_value<int>(ColumnID{0}, 1u), 11);
+}
+
 TEST_F(OperatorsGetTableTest, Copy) {
   const auto get_table_a = std::make_shared<GetTable>("int_int_float");
   const auto get_table_a_copy = std::dynamic_pointer_cast<GetTable>(get_table_a->deep_copy());
@@ -212,6 +251,15 @@ TEST_F(OperatorsGetTableTest, Copy) {
   EXPECT_EQ(get_table_b_copy->table_name(), "int_int_float");
   EXPECT_EQ(get_table_b_copy->pruned_chunk_ids(), std::vector{ChunkID{1}});
   EXPECT_EQ(get_table_b_copy->pruned_column_ids(), std::vector{ColumnID{0}});
+
+  const auto key_source = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int.tbl"));
+  const auto get_table_c = std::make_shared<GetTable>("int_int_float");
+  get_table_c->set_runtime_pruning(key_source, ColumnID{0}, ColumnID{1});
+  const auto get_table_c_copy = std::dynamic_pointer_cast<GetTable>(get_table_c->deep_copy());
+  EXPECT_EQ(get_table_c_copy->runtime_pruning_column_id(), ColumnID{1});
+  ASSERT_TRUE(get_table_c_copy->input_left());
+  EXPECT_NE(get_table_c_copy->input_left(), key_source);
+  EXPECT_EQ(get_table_c_copy->input_left()->type(), OperatorType::TableWrapper);
 }
 
 }  // namespace opossum
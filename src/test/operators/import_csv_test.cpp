@@ -58,6 +58,25 @@ TEST_F(OperatorsImportCsvTest, StringEscaping) {
   EXPECT_TABLE_EQ_ORDERED(importer->get_output(), expected_table);
 }
 
+TEST_F(OperatorsImportCsvTest, LongQuotedStrings) {
+  // The quoted fields contain separators, delimiters, and escaped quotes and span the blocks in which the parser
+  // searches for the ends of fields. The file does not end with a delimiter.
+  auto importer = std::make_shared<ImportCsv>("resources/test_data/csv/string_long_quotes.csv", 3);
+  importer->execute();
+
+  auto x_string = std::string{};
+  for (auto index = 0; index < 40; ++index) x_string += "x,";
+
+  auto expected_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::String}, {"b", DataType::Int}}, TableType::Data, 3);
+  expected_table->append({pmr_string{std::string(70, 'a') + ",\n\"" + std::string(10, 'b')}, 1});
+  expected_table->append({"short", 2});
+  expected_table->append({pmr_string{std::string(63, 'c') + "\""}, 3});
+  expected_table->append({pmr_string{x_string}, 4});
+
+  EXPECT_TABLE_EQ_ORDERED(importer->get_output(), expected_table);
+}
+
 TEST_F(OperatorsImportCsvTest, NoRows) {
   auto importer = std::make_shared<ImportCsv>("resources/test_data/csv/float_int_empty.csv");
   importer->execute();
@@ -0,0 +1,109 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/import_parquet.hpp"
+#include "optimizer/strategy/chunk_pruning_rule.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsImportParquetTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("a", DataType::Int, true);
+    column_definitions.emplace_back("b", DataType::Long, true);
+    column_definitions.emplace_back("c", DataType::Float, true);
+    column_definitions.emplace_back("d", DataType::Double, true);
+    column_definitions.emplace_back("e", DataType::String, true);
+
+    expected_table = std::make_shared<Table>(column_definitions, TableType::Data, 3);
+    expected_table->append({1, int64_t{10}, 1.5f, 0.25, "one"});
+    expected_table->append({NULL_VALUE, int64_t{20}, NULL_VALUE, 0.5, NULL_VALUE});
+    expected_table->append({3, NULL_VALUE, 3.5f, NULL_VALUE, "three"});
+    expected_table->append({40, int64_t{400}, 4.5f, 4.25, "four"});
+    expected_table->append({50, int64_t{500}, 5.5f, 5.25, "five"});
+  }
+
+  std::shared_ptr<Table> expected_table;
+};
+
+// The file was written by an independent implementation of the format. Its first row group uses bit-packed definition
+// levels in column a, two data pages in column b, and the deprecated min and max statistics in column c.
+TEST_F(OperatorsImportParquetTest, AllDataTypesNullable) {
+  auto importer = std::make_shared<ImportParquet>("resources/test_data/parquet/all_data_types_nullable.parquet");
+  importer->execute();
+
+  const auto table = importer->get_output();
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+  EXPECT_EQ(table->chunk_count(), 2u);
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->size(), 3u);
+  EXPECT_EQ(table->has_mvcc(), UseMvcc::Yes);
+}
+
+TEST_F(OperatorsImportParquetTest, RowGroupStatistics) {
+  auto importer = std::make_shared<ImportParquet>("resources/test_data/parquet/all_data_types_nullable.parquet");
+  importer->execute();
+  const auto table = importer->get_output();
+
+  const auto first_statistics = table->get_chunk(ChunkID{0})->statistics();
+  const auto second_statistics = table->get_chunk(ChunkID{1})->statistics();
+  ASSERT_TRUE(first_statistics && second_statistics);
+
+  EXPECT_TRUE(first_statistics->can_prune(ColumnID{0}, PredicateCondition::GreaterThan, 3));
+  EXPECT_FALSE(second_statistics->can_prune(ColumnID{0}, PredicateCondition::GreaterThan, 3));
+  EXPECT_TRUE(second_statistics->can_prune(ColumnID{1}, PredicateCondition::LessThan, int64_t{400}));
+  EXPECT_TRUE(first_statistics->can_prune(ColumnID{2}, PredicateCondition::Equals, 4.5f));
+  EXPECT_TRUE(first_statistics->can_prune(ColumnID{3}, PredicateCondition::GreaterThanEquals, 1.0));
+  EXPECT_TRUE(second_statistics->can_prune(ColumnID{4}, PredicateCondition::Equals, pmr_string{"one"}));
+}
+
+TEST_F(OperatorsImportParquetTest, ChunkPruning) {
+  auto importer = std::make_shared<ImportParquet>("resources/test_data/parquet/all_data_types_nullable.parquet",
+                                                  "parquet_table");
+  importer->execute();
+
+  // The ChunkPruningRule uses the statistics of the row groups, so that GetTable skips the first one
+  const auto stored_table_node = StoredTableNode::make("parquet_table");
+  const auto predicate_node =
+      PredicateNode::make(greater_than_(LQPColumnReference(stored_table_node, ColumnID{0}), 10), stored_table_node);
+  ChunkPruningRule{}.apply_to(predicate_node);
+  EXPECT_EQ(stored_table_node->pruned_chunk_ids(), std::vector<ChunkID>{ChunkID{0}});
+
+  const auto get_table = LQPTranslator{}.translate_node(stored_table_node);
+  get_table->execute();
+  EXPECT_EQ(get_table->get_output()->chunk_count(), 1u);
+  EXPECT_EQ(get_table->get_output()->row_count(), 2u);
+}
+
+TEST_F(OperatorsImportParquetTest, SaveToStorageManager) {
+  auto importer = std::make_shared<ImportParquet>("resources/test_data/parquet/int_float.parquet", "int_float");
+  importer->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(StorageManager::get().get_table("int_float"),
+                          load_table("resources/test_data/tbl/int_float.tbl"));
+}
+
+TEST_F(OperatorsImportParquetTest, FileDoesNotExist) {
+  auto importer = std::make_shared<ImportParquet>("not_existing_file");
+  EXPECT_THROW(importer->execute(), std::exception);
+}
+
+TEST_F(OperatorsImportParquetTest, NoParquetFile) {
+  auto importer = std::make_shared<ImportParquet>("resources/test_data/tbl/int_float.tbl");
+  EXPECT_THROW(importer->execute(), std::exception);
+}
+
+}  // namespace opossum
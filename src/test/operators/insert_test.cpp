@@ -1,5 +1,8 @@
+#include <map>
 #include <memory>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "base_test.hpp"
@@ -283,4 +286,71 @@ TEST_F(OperatorsInsertTest, InsertIntoEmptyTable) {
   EXPECT_TABLE_EQ_ORDERED(target_table, table_int_float);
 }
 
+TEST_F(OperatorsInsertTest, ConcurrentInserts) {
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("a", DataType::Int, false);
+  column_definitions.emplace_back("b", DataType::Int, true);
+
+  // A small chunk size, so that the Inserts often have to append Chunks and some rows are split across Chunks
+  const auto target_table = std::make_shared<Table>(column_definitions, TableType::Data, 7u, UseMvcc::Yes);
+  StorageManager::get().add_table("target_table", target_table);
+
+  constexpr auto thread_count = 8;
+  constexpr auto inserts_per_thread = 50;
+  constexpr auto rows_per_insert = 3;
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_index = 0; thread_index < thread_count; ++thread_index) {
+    threads.emplace_back([&, thread_index]() {
+      for (auto insert_index = 0; insert_index < inserts_per_thread; ++insert_index) {
+        const auto values = std::make_shared<Table>(column_definitions, TableType::Data);
+        for (auto row_index = 0; row_index < rows_per_insert; ++row_index) {
+          values->append({thread_index, insert_index});
+        }
+
+        const auto table_wrapper = std::make_shared<TableWrapper>(values);
+        table_wrapper->execute();
+
+        const auto insert = std::make_shared<Insert>("target_table", table_wrapper);
+        auto context = TransactionManager::get().new_transaction_context();
+        insert->set_transaction_context(context);
+        insert->execute();
+
+        // Roll back every other Insert to check that this does not affect the concurrent ones
+        if (insert_index % 2 == 0) {
+          context->commit();
+        } else {
+          context->rollback();
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(target_table->row_count(), thread_count * inserts_per_thread * rows_per_insert);
+  for (auto chunk_id = ChunkID{0}; chunk_id < target_table->chunk_count(); ++chunk_id) {
+    EXPECT_LE(target_table->get_chunk(chunk_id)->size(), 7u);
+  }
+
+  // Only the committed rows are visible and each committed Insert contributed all of its rows
+  const auto get_table = std::make_shared<GetTable>("target_table");
+  const auto validate = std::make_shared<Validate>(get_table);
+  const auto context = TransactionManager::get().new_transaction_context();
+  validate->set_transaction_context(context);
+  get_table->execute();
+  validate->execute();
+
+  auto row_counts = std::map<std::pair<int32_t, int32_t>, size_t>{};
+  for (const auto& row : validate->get_output()->get_rows()) {
+    ++row_counts[{boost::get<int32_t>(row[0]), boost::get<int32_t>(row[1])}];
+  }
+  EXPECT_EQ(row_counts.size(), thread_count * inserts_per_thread / 2);
+  for (const auto& [key, row_count] : row_counts) {
+    EXPECT_EQ(key.second % 2, 0);
+    EXPECT_EQ(row_count, rows_per_insert);
+  }
+}
+
 }  // namespace opossum
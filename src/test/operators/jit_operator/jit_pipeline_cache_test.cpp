@@ -0,0 +1,109 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "logical_query_plan/jit_aware_lqp_translator.hpp"
+#include "operators/jit_operator/jit_pipeline_cache.hpp"
+#include "operators/jit_operator_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/storage_manager.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class JitPipelineCacheTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_int_int.tbl"));
+    _pipeline_cache = std::make_shared<JitPipelineCache>();
+  }
+
+  // Translates the query with a JitAwareLQPTranslator using _pipeline_cache and returns the topmost JitOperatorWrapper
+  std::shared_ptr<const JitOperatorWrapper> translate_query(
+      const std::string& sql, const JitExecutionMode execution_mode = JitExecutionMode::Compile) const {
+    const auto lqp = SQLPipelineBuilder(sql).create_pipeline_statement(nullptr).get_unoptimized_logical_plan();
+
+    JitAwareLQPTranslator lqp_translator{_pipeline_cache, execution_mode};
+    std::shared_ptr<const AbstractOperator> current_node = lqp_translator.translate_node(lqp);
+    while (current_node && !std::dynamic_pointer_cast<const JitOperatorWrapper>(current_node)) {
+      current_node = current_node->input_left();
+    }
+    return std::dynamic_pointer_cast<const JitOperatorWrapper>(current_node);
+  }
+
+  std::shared_ptr<JitPipelineCache> _pipeline_cache;
+};
+
+TEST_F(JitPipelineCacheTest, EqualSubplansSharePipeline) {
+  const auto first_wrapper = translate_query("SELECT a FROM table_a WHERE a > 1 AND b > 2");
+  ASSERT_TRUE(first_wrapper);
+  EXPECT_EQ(_pipeline_cache->size(), 1u);
+  EXPECT_EQ(_pipeline_cache->miss_count(), 1u);
+
+  // Different statements with the same jitted subplan
+  const auto second_wrapper = translate_query("SELECT a FROM table_a WHERE a > 1 AND b > 2;");
+  ASSERT_TRUE(second_wrapper);
+  EXPECT_NE(second_wrapper, first_wrapper);
+  EXPECT_EQ(second_wrapper->specialized_function_wrapper(), first_wrapper->specialized_function_wrapper());
+  EXPECT_EQ(_pipeline_cache->hit_count(), 1u);
+
+  // Literals are part of the pipeline
+  const auto third_wrapper = translate_query("SELECT a FROM table_a WHERE a > 2 AND b > 2");
+  ASSERT_TRUE(third_wrapper);
+  EXPECT_NE(third_wrapper->specialized_function_wrapper(), first_wrapper->specialized_function_wrapper());
+  EXPECT_EQ(_pipeline_cache->size(), 2u);
+}
+
+TEST_F(JitPipelineCacheTest, ExecutionModeIsPartOfKey) {
+  const auto interpreted_wrapper =
+      translate_query("SELECT a FROM table_a WHERE a > 1 AND b > 2", JitExecutionMode::Interpret);
+  const auto compiled_wrapper = translate_query("SELECT a FROM table_a WHERE a > 1 AND b > 2");
+  ASSERT_TRUE(interpreted_wrapper && compiled_wrapper);
+  EXPECT_NE(compiled_wrapper->specialized_function_wrapper(), interpreted_wrapper->specialized_function_wrapper());
+  EXPECT_EQ(compiled_wrapper->execution_mode(), JitExecutionMode::Compile);
+  EXPECT_EQ(_pipeline_cache->size(), 2u);
+  EXPECT_EQ(_pipeline_cache->hit_count(), 0u);
+}
+
+TEST_F(JitPipelineCacheTest, InvalidateOnReplacedTable) {
+  const auto first_wrapper = translate_query("SELECT a FROM table_a WHERE a > 1 AND b > 2");
+
+  StorageManager::get().drop_table("table_a");
+  StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_int_int_null.tbl"));
+
+  const auto second_wrapper = translate_query("SELECT a FROM table_a WHERE a > 1 AND b > 2");
+  ASSERT_TRUE(second_wrapper);
+  EXPECT_NE(second_wrapper->specialized_function_wrapper(), first_wrapper->specialized_function_wrapper());
+  EXPECT_EQ(_pipeline_cache->size(), 1u);
+}
+
+TEST_F(JitPipelineCacheTest, EvictsLeastRecentlyUsed) {
+  _pipeline_cache = std::make_shared<JitPipelineCache>(1);
+
+  translate_query("SELECT a FROM table_a WHERE a > 1 AND b > 2");
+  translate_query("SELECT a FROM table_a WHERE a > 2 AND b > 2");
+  EXPECT_EQ(_pipeline_cache->size(), 1u);
+
+  translate_query("SELECT a FROM table_a WHERE a > 1 AND b > 2");
+  EXPECT_EQ(_pipeline_cache->hit_count(), 0u);
+}
+
+TEST_F(JitPipelineCacheTest, CachedPipelinesKeepExecutionMode) {
+  const auto first_wrapper = translate_query("SELECT a FROM table_a WHERE a > 1 AND b > 2", JitExecutionMode::Tiered);
+  const auto second_wrapper = translate_query("SELECT a FROM table_a WHERE a > 1 AND b > 2", JitExecutionMode::Tiered);
+  ASSERT_TRUE(first_wrapper && second_wrapper);
+  EXPECT_EQ(second_wrapper->execution_mode(), JitExecutionMode::Tiered);
+
+  // Executions of both wrappers count towards the shared pipeline becoming hot
+  for (const auto& wrapper : {first_wrapper, second_wrapper}) {
+    CurrentScheduler::schedule_and_wait_for_tasks(
+        OperatorTask::make_tasks_from_operator(wrapper->deep_copy(), CleanupTemporaries::No));
+  }
+  EXPECT_EQ(second_wrapper->specialized_function_wrapper()->execution_count, 2u);
+}
+
+}  // namespace opossum
@@ -288,6 +288,16 @@ TEST_F(JitExpressionTest, PredicateOperations) {
   ASSERT_FALSE(lte_expression.compute<bool>(context).value());
   ASSERT_TRUE(e_expression.compute<bool>(context).value());
   ASSERT_FALSE(ne_expression.compute<bool>(context).value());
+
+  // Actual values are compared if the current chunk has no value ids for the left operand
+  context.tuple_entries_without_value_ids.resize(3, false);
+  context.tuple_entries_without_value_ids[left_tuple_entry.tuple_index] = true;
+  left_tuple_entry.set(int32_t{1}, context);
+  right_tuple_entry.set(int32_t{1}, context);
+
+  ASSERT_FALSE(gt_expression.compute<bool>(context).value());
+  ASSERT_TRUE(lte_expression.compute<bool>(context).value());
+  ASSERT_TRUE(gt_expression.use_value_ids);
 }
 
 TEST_F(JitExpressionTest, StringComparison) {
@@ -0,0 +1,145 @@
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "operators/jit_operator/operators/jit_hash_join_build.hpp"
+#include "operators/jit_operator/operators/jit_hash_join_probe.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Mock JitOperator that passes individual tuples into the chain
+class MockHashJoinSource : public AbstractJittable {
+ public:
+  std::string description() const final { return "MockHashJoinSource"; }
+
+  void emit(JitRuntimeContext& context) { _emit(context); }
+
+ private:
+  void _consume(JitRuntimeContext& context) const final {}
+};
+
+// Mock JitOperator that records the values of a tuple entry of all tuples passed to it (NULL values as -1)
+class MockHashJoinSink : public AbstractJittable {
+ public:
+  explicit MockHashJoinSink(const JitTupleEntry& tuple_entry) : _tuple_entry{tuple_entry} {}
+
+  std::string description() const final { return "MockHashJoinSink"; }
+
+  void reset() const { _consumed_values.clear(); }
+
+  const std::vector<int32_t>& consumed_values() const { return _consumed_values; }
+
+ private:
+  void _consume(JitRuntimeContext& context) const final {
+    _consumed_values.emplace_back(_tuple_entry.is_null(context) ? -1 : _tuple_entry.get<int32_t>(context));
+  }
+
+  const JitTupleEntry _tuple_entry;
+
+  // Must be static, since _consume is const
+  static std::vector<int32_t> _consumed_values;
+};
+
+std::vector<int32_t> MockHashJoinSink::_consumed_values;
+
+}  // namespace
+
+class JitHashJoinTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Build pipeline: key in x0, value in x1
+    _build_source = std::make_shared<MockHashJoinSource>();
+    _build = std::make_shared<JitHashJoinBuild>();
+    _build->add_key_column(_build_key);
+    _build->add_value_column(_build_value);
+    _build_source->set_next_operator(_build);
+
+    // Probe pipeline: key in x0, joined value in x1
+    _probe_source = std::make_shared<MockHashJoinSource>();
+    _probe = std::make_shared<JitHashJoinProbe>(_build);
+    _probe->add_key_column(_probe_key);
+    _probe->add_value_column(_probe_value);
+    _sink = std::make_shared<MockHashJoinSink>(_probe_value);
+    _probe_source->set_next_operator(_probe);
+    _probe->set_next_operator(_sink);
+  }
+
+  // Builds the hash table from the given (key, value) rows and moves it to the probe context
+  void _build_hash_table(const std::vector<std::pair<std::optional<int32_t>, int32_t>>& rows) {
+    JitRuntimeContext build_context;
+    build_context.tuple.resize(2);
+    _build->before_query(build_context);
+
+    for (const auto& [key, value] : rows) {
+      _build_key.set_is_null(!key, build_context);
+      if (key) _build_key.set<int32_t>(*key, build_context);
+      _build_value.set_is_null(false, build_context);
+      _build_value.set<int32_t>(value, build_context);
+      _build_source->emit(build_context);
+    }
+
+    _probe_context.tuple.resize(2);
+    _probe_context.limit_rows = std::numeric_limits<size_t>::max();
+    _probe_context.join_hashmap = std::move(build_context.hashmap);
+  }
+
+  // Emits a probe tuple and returns the joined values passed to the sink
+  std::vector<int32_t> _probe_key_value(const std::optional<int32_t>& key) {
+    _sink->reset();
+    _probe_key.set_is_null(!key, _probe_context);
+    if (key) _probe_key.set<int32_t>(*key, _probe_context);
+    _probe_source->emit(_probe_context);
+    return _sink->consumed_values();
+  }
+
+  const JitTupleEntry _build_key{DataType::Int, false, 0};
+  const JitTupleEntry _build_value{DataType::Int, false, 1};
+  const JitTupleEntry _probe_key{DataType::Int, false, 0};
+  const JitTupleEntry _probe_value{DataType::Int, false, 1};
+
+  std::shared_ptr<MockHashJoinSource> _build_source;
+  std::shared_ptr<JitHashJoinBuild> _build;
+  std::shared_ptr<MockHashJoinSource> _probe_source;
+  std::shared_ptr<JitHashJoinProbe> _probe;
+  std::shared_ptr<MockHashJoinSink> _sink;
+
+  JitRuntimeContext _probe_context;
+};
+
+TEST_F(JitHashJoinTest, BuildSkipsNullKeys) {
+  _build_hash_table({{1, 10}, {2, 20}, {1, 30}, {std::nullopt, 40}});
+
+  // One hashmap column for the key and one for the value, each holding the three rows with non-NULL keys
+  ASSERT_EQ(_probe_context.join_hashmap.columns.size(), 2u);
+  EXPECT_EQ(_probe_context.join_hashmap.columns[0].get_is_null_vector().size(), 3u);
+  EXPECT_EQ(_probe_context.join_hashmap.columns[1].get_is_null_vector().size(), 3u);
+
+  auto row_count = size_t{0};
+  for (const auto& [hash, row_indices] : _probe_context.join_hashmap.indices) row_count += row_indices.size();
+  EXPECT_EQ(row_count, 3u);
+}
+
+TEST_F(JitHashJoinTest, EmitsOneTuplePerMatch) {
+  _build_hash_table({{1, 10}, {2, 20}, {1, 30}, {std::nullopt, 40}});
+
+  EXPECT_EQ(_probe_key_value(1), std::vector<int32_t>({10, 30}));
+  EXPECT_EQ(_probe_key_value(2), std::vector<int32_t>({20}));
+  EXPECT_TRUE(_probe_key_value(3).empty());
+
+  // NULL never matches, not even NULL
+  EXPECT_TRUE(_probe_key_value(std::nullopt).empty());
+}
+
+TEST_F(JitHashJoinTest, StopsWhenLimitIsReached) {
+  _build_hash_table({{1, 10}, {1, 20}, {1, 30}});
+
+  // Mimics a JitLimit operator that emitted its last tuple
+  _probe_context.limit_rows = 0;
+  EXPECT_EQ(_probe_key_value(1), std::vector<int32_t>({10}));
+}
+
+}  // namespace opossum
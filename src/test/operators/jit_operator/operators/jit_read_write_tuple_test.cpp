@@ -211,8 +211,8 @@ TEST_F(JitReadWriteTupleTest, BeforeSpecialization) {
 }
 
 TEST_F(JitReadWriteTupleTest, BeforeChunkUpdatesPossibleValueIDExpressions) {
-  // Check that the before_chunk() function correctly updates the possible value id expressions if the specialized
-  // function cannot be used
+  // Check that the before_chunk() function correctly marks the columns for which the possible value id expressions
+  // cannot use value ids if the specialized function cannot be used
 
   // Prepare input table
   auto input_table = load_table("resources/test_data/tbl/int_float2.tbl", 1);
@@ -251,15 +251,25 @@ TEST_F(JitReadWriteTupleTest, BeforeChunkUpdatesPossibleValueIDExpressions) {
 
   // Column b is unencoded in chunks 1 and 2 -> specialized function cannot be used for these chunks
 
+  const auto& tuple_entries_without_value_ids = context.tuple_entries_without_value_ids;
+
   // Column a is unencoded in chunk 1 -> use actual values in comparison expression
   read_tuples.before_chunk(*input_table, ChunkID{1}, parameters, context);
-  ASSERT_FALSE(literal_expression->use_value_ids);
+  ASSERT_TRUE(tuple_entries_without_value_ids[a_tuple_entry.tuple_index]);
 
-  ASSERT_FALSE(parameter_expression->use_value_ids);
+  ASSERT_TRUE(tuple_entries_without_value_ids[b_tuple_entry.tuple_index]);
 
-  // Column a is dicitonary-encoded in chunk 1 -> use value ids in comparison expression
+  // Column a is dicitonary-encoded in chunk 2 -> use value ids in comparison expression
   read_tuples.before_chunk(*input_table, ChunkID{2}, parameters, context);
-  ASSERT_TRUE(literal_expression->use_value_ids);
+  ASSERT_FALSE(tuple_entries_without_value_ids[a_tuple_entry.tuple_index]);
+
+  // All columns are dictionary-encoded in chunk 0 -> the specialized function uses value ids in all expressions
+  read_tuples.before_chunk(*input_table, ChunkID{0}, parameters, context);
+  ASSERT_TRUE(tuple_entries_without_value_ids.empty());
+
+  // The expressions are shared by all executions of the pipeline and are not modified per chunk
+  ASSERT_FALSE(literal_expression->use_value_ids);
+  ASSERT_FALSE(parameter_expression->use_value_ids);
 }
 
 TEST_F(JitReadWriteTupleTest, BeforeChunkCanUseSpecializedFunction) {
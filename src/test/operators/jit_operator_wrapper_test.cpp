@@ -11,6 +11,10 @@
 #include "operators/jit_operator/operators/jit_write_tuples.hpp"
 #include "operators/jit_operator_wrapper.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/chunk_encoder.hpp"
 
 namespace opossum {
@@ -26,6 +30,33 @@ class JitOperatorWrapperTest : public BaseTest {
     _int_table_wrapper->execute();
   }
 
+  // Creates a Tiered wrapper for SELECT a+a FROM resources/test_data/tbl/10_ints.tbl
+  std::shared_ptr<JitOperatorWrapper> _create_tiered_doubling_wrapper(
+      const std::shared_ptr<JitOperatorWrapper::SpecializedFunctionWrapper>& specialized_function_wrapper) const {
+    auto read_operator = std::make_shared<JitReadTuples>();
+    auto tuple_entry = read_operator->add_input_column(DataType::Int, false, ColumnID(0));
+    auto column_expression = std::make_shared<JitExpression>(tuple_entry);
+    auto expression = std::make_shared<JitExpression>(column_expression, JitExpressionType::Addition,
+                                                      column_expression, read_operator->add_temporary_value());
+    auto compute_operator = std::make_shared<JitCompute>(expression);
+    auto write_operator = std::make_shared<JitWriteTuples>();
+    write_operator->add_output_column_definition("a+a", expression->result_entry);
+
+    auto wrapper = std::make_shared<JitOperatorWrapper>(_int_table_wrapper, JitExecutionMode::Tiered,
+                                                        specialized_function_wrapper);
+    wrapper->add_jit_operator(read_operator);
+    wrapper->add_jit_operator(compute_operator);
+    wrapper->add_jit_operator(write_operator);
+    return wrapper;
+  }
+
+  void _expect_doubled_int_table(const Table& table) const {
+    ASSERT_EQ(table.row_count(), _int_table->row_count());
+    for (auto row = size_t{0}; row < table.row_count(); ++row) {
+      EXPECT_EQ(table.get_value<int>(ColumnID{0}, row), 2 * _int_table->get_value<int>(ColumnID{0}, row));
+    }
+  }
+
   std::shared_ptr<Table> _empty_table;
   std::shared_ptr<Table> _int_table;
   std::shared_ptr<TableWrapper> _empty_table_wrapper;
@@ -36,10 +67,11 @@ class MockJitSource : public JitReadTuples {
  public:
   MOCK_METHOD2(before_specialization, void(const Table&, std::vector<bool>&));
   MOCK_CONST_METHOD3(before_query, void(const Table&, const std::vector<AllTypeVariant>&, JitRuntimeContext&));
-  MOCK_METHOD4(before_chunk, bool(const Table&, const ChunkID, const std::vector<AllTypeVariant>&, JitRuntimeContext&));
+  MOCK_CONST_METHOD4(before_chunk,
+                     bool(const Table&, const ChunkID, const std::vector<AllTypeVariant>&, JitRuntimeContext&));
 
   bool forward_before_chunk(const Table& in_table, const ChunkID chunk_id,
-                            const std::vector<AllTypeVariant>& parameter_values, JitRuntimeContext& context) {
+                            const std::vector<AllTypeVariant>& parameter_values, JitRuntimeContext& context) const {
     return JitReadTuples::before_chunk(in_table, chunk_id, parameter_values, context);
   }
 };
@@ -344,4 +376,67 @@ TEST_F(JitOperatorWrapperTest, JitOperatorsSpecializedWithMultipleInliningOfSame
   ASSERT_EQ(result->get_value<int>(ColumnID(0), 1), 48);
 }
 
+TEST_F(JitOperatorWrapperTest, TieredExecutionCompilesHotPipeline) {
+  const auto specialized_function_wrapper = std::make_shared<JitOperatorWrapper::SpecializedFunctionWrapper>();
+  const auto first_wrapper = _create_tiered_doubling_wrapper(specialized_function_wrapper);
+
+  // The pipeline is interpreted until it was executed often enough
+  const auto threshold = JitOperatorWrapper::TIERED_COMPILATION_EXECUTION_THRESHOLD;
+  for (auto execution = size_t{1}; execution < threshold; ++execution) {
+    auto wrapper = first_wrapper->deep_copy();
+    wrapper->execute();
+    _expect_doubled_int_table(*wrapper->get_output());
+    EXPECT_FALSE(specialized_function_wrapper->compilation_started);
+    EXPECT_FALSE(std::atomic_load(&specialized_function_wrapper->compiled_functions));
+  }
+
+  // The next execution is interpreted as well, but starts the compilation. Without a scheduler, it runs on a thread of
+  // its own.
+  auto hot_wrapper = first_wrapper->deep_copy();
+  hot_wrapper->execute();
+  _expect_doubled_int_table(*hot_wrapper->get_output());
+  ASSERT_TRUE(specialized_function_wrapper->compilation_started);
+  EXPECT_TRUE(specialized_function_wrapper->compilation_thread.joinable());
+
+  specialized_function_wrapper->wait_for_compilation();
+  EXPECT_TRUE(std::atomic_load(&specialized_function_wrapper->compiled_functions));
+
+  auto compiled_wrapper = first_wrapper->deep_copy();
+  compiled_wrapper->execute();
+  _expect_doubled_int_table(*compiled_wrapper->get_output());
+}
+
+TEST_F(JitOperatorWrapperTest, TieredExecutionSwitchesToCompiledFunctionConcurrently) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto specialized_function_wrapper = std::make_shared<JitOperatorWrapper::SpecializedFunctionWrapper>();
+  const auto first_wrapper = _create_tiered_doubling_wrapper(specialized_function_wrapper);
+
+  // The executions that make the pipeline hot start the compilation as a JobTask. The other executions are scheduled
+  // at the same time, so that they interpret the pipeline or use the compiled function depending on when they run.
+  auto wrappers = std::vector<std::shared_ptr<AbstractOperator>>{};
+  auto tasks = std::vector<std::shared_ptr<OperatorTask>>{};
+  for (auto execution = size_t{0}; execution < 64; ++execution) {
+    wrappers.emplace_back(first_wrapper->deep_copy());
+    const auto execution_tasks = OperatorTask::make_tasks_from_operator(wrappers.back(), CleanupTemporaries::No);
+    tasks.insert(tasks.end(), execution_tasks.begin(), execution_tasks.end());
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+  for (const auto& wrapper : wrappers) {
+    _expect_doubled_int_table(*wrapper->get_output());
+  }
+  ASSERT_TRUE(specialized_function_wrapper->compilation_started);
+  EXPECT_FALSE(specialized_function_wrapper->compilation_thread.joinable());
+
+  specialized_function_wrapper->wait_for_compilation();
+  ASSERT_TRUE(std::atomic_load(&specialized_function_wrapper->compiled_functions));
+
+  const auto compiled_wrapper = first_wrapper->deep_copy();
+  CurrentScheduler::schedule_and_wait_for_tasks(
+      OperatorTask::make_tasks_from_operator(compiled_wrapper, CleanupTemporaries::No));
+  _expect_doubled_int_table(*compiled_wrapper->get_output());
+}
+
 }  // namespace opossum
@@ -0,0 +1,90 @@
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_key_filter.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "statistics/chunk_statistics/min_max_filter.hpp"
+#include "statistics/chunk_statistics/range_filter.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class JoinKeyFilterTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String, false}},
+                                    TableType::Data, 2);
+    table->append({7, "x"});
+    table->append({NULL_VALUE, "y"});
+    table->append({3, "x"});
+    table->append({7, "z"});
+    table->append({5, "x"});
+
+    // The Chunk holds the values 0-10 and 20-30
+    const auto segment_statistics = std::make_shared<SegmentStatistics>();
+    segment_statistics->add_filter(std::make_shared<MinMaxFilter<int32_t>>(0, 30));
+    segment_statistics->add_filter(
+        std::make_shared<RangeFilter<int32_t>>(std::vector<std::pair<int32_t, int32_t>>{{0, 10}, {20, 30}}));
+    chunk_statistics = std::make_shared<ChunkStatistics>(std::vector{segment_statistics});
+  }
+
+  std::shared_ptr<Table> table;
+  std::shared_ptr<ChunkStatistics> chunk_statistics;
+};
+
+TEST_F(JoinKeyFilterTest, Build) {
+  const auto filter_a = JoinKeyFilter::build(*table, ColumnID{0});
+  ASSERT_TRUE(filter_a->min_max());
+  EXPECT_EQ(filter_a->min_max()->first, AllTypeVariant{3});
+  EXPECT_EQ(filter_a->min_max()->second, AllTypeVariant{7});
+  ASSERT_TRUE(filter_a->membership_values());
+  EXPECT_EQ(*filter_a->membership_values(), std::vector<AllTypeVariant>({3, 5, 7}));
+
+  const auto filter_b = JoinKeyFilter::build(*table, ColumnID{1});
+  ASSERT_TRUE(filter_b->min_max());
+  EXPECT_EQ(filter_b->min_max()->first, AllTypeVariant{"x"});
+  EXPECT_EQ(filter_b->min_max()->second, AllTypeVariant{"z"});
+}
+
+TEST_F(JoinKeyFilterTest, BuildWithTooManyDistinctValues) {
+  const auto filter = JoinKeyFilter::build(*table, ColumnID{0}, 2);
+  ASSERT_TRUE(filter->min_max());
+  EXPECT_EQ(filter->min_max()->first, AllTypeVariant{3});
+  EXPECT_EQ(filter->min_max()->second, AllTypeVariant{7});
+  EXPECT_FALSE(filter->membership_values());
+}
+
+TEST_F(JoinKeyFilterTest, BuildWithoutKeys) {
+  const auto null_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data);
+  null_table->append({NULL_VALUE});
+
+  const auto filter = JoinKeyFilter::build(*null_table, ColumnID{0});
+  EXPECT_FALSE(filter->min_max());
+  EXPECT_TRUE(filter->can_prune(*chunk_statistics, ColumnID{0}));
+}
+
+TEST_F(JoinKeyFilterTest, CanPrune) {
+  // Keys outside of the Chunk's min/max
+  EXPECT_TRUE(JoinKeyFilter(std::pair<AllTypeVariant, AllTypeVariant>{31, 40}, std::nullopt)
+                  .can_prune(*chunk_statistics, ColumnID{0}));
+
+  // Keys overlapping with the Chunk's ranges
+  EXPECT_FALSE(JoinKeyFilter(std::pair<AllTypeVariant, AllTypeVariant>{5, 40}, std::nullopt)
+                   .can_prune(*chunk_statistics, ColumnID{0}));
+
+  // Keys within the gap between the Chunk's ranges
+  EXPECT_TRUE(JoinKeyFilter(std::pair<AllTypeVariant, AllTypeVariant>{12, 18}, std::nullopt)
+                  .can_prune(*chunk_statistics, ColumnID{0}));
+
+  // The range of the keys overlaps with the Chunk, but none of the keys is contained in it
+  EXPECT_TRUE(JoinKeyFilter(std::pair<AllTypeVariant, AllTypeVariant>{-5, 35}, std::vector<AllTypeVariant>{-5, 15, 35})
+                  .can_prune(*chunk_statistics, ColumnID{0}));
+  EXPECT_FALSE(JoinKeyFilter(std::pair<AllTypeVariant, AllTypeVariant>{-5, 35}, std::vector<AllTypeVariant>{-5, 25, 35})
+                   .can_prune(*chunk_statistics, ColumnID{0}));
+}
+
+}  // namespace opossum
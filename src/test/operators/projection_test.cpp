@@ -14,6 +14,7 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -82,18 +83,31 @@ TEST_F(OperatorsProjectionTest, ForwardsIfPossibleDataTableAndExpression) {
   EXPECT_EQ(input_chunk->get_segment(ColumnID{0}), output_chunk->get_segment(ColumnID{1}));
 }
 
-TEST_F(OperatorsProjectionTest, DontForwardReferencesWithExpression) {
+TEST_F(OperatorsProjectionTest, ForwardsReferencesWithExpression) {
+  // Columns are forwarded even if other columns are computed. The computed columns reference a data table, so that the
+  // output is a reference table.
   const auto table_scan = create_table_scan(table_wrapper_a, ColumnID{0}, PredicateCondition::LessThan, 100'000);
   table_scan->execute();
-  const auto projection =
-      std::make_shared<opossum::Projection>(table_scan, expression_vector(a_b, a_a, add_(a_b, a_a)));
+  const auto projection = std::make_shared<opossum::Projection>(table_scan, expression_vector(a_a, add_(a_a, a_b)));
   projection->execute();
 
-  const auto input_chunk = table_wrapper_a->get_output()->get_chunk(ChunkID{0});
-  const auto output_chunk = projection->get_output()->get_chunk(ChunkID{0});
-
-  EXPECT_NE(input_chunk->get_segment(ColumnID{1}), output_chunk->get_segment(ColumnID{0}));
-  EXPECT_NE(input_chunk->get_segment(ColumnID{0}), output_chunk->get_segment(ColumnID{1}));
+  const auto output_table = projection->get_output();
+  EXPECT_EQ(output_table->type(), TableType::References);
+  EXPECT_EQ(table_scan->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{0}),
+            output_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+
+  const auto computed_segment =
+      std::dynamic_pointer_cast<ReferenceSegment>(output_table->get_chunk(ChunkID{0})->get_segment(ColumnID{1}));
+  ASSERT_TRUE(computed_segment);
+  EXPECT_EQ(computed_segment->referenced_table()->type(), TableType::Data);
+  EXPECT_TRUE(computed_segment->pos_list()->references_single_chunk());
+
+  const auto expected_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"a + b", DataType::Float, false}}, TableType::Data);
+  expected_table->append({12345, 12345 + 458.7f});
+  expected_table->append({123, 123 + 456.7f});
+  expected_table->append({1234, 1234 + 457.7f});
+  EXPECT_TABLE_EQ_UNORDERED(output_table, expected_table);
 }
 
 TEST_F(OperatorsProjectionTest, ForwardsIfPossibleReferenceTable) {
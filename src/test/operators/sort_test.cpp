@@ -149,6 +149,79 @@ TEST_P(OperatorsSortTest, MultipleColumnSortIsStableMixedOrder) {
   EXPECT_TABLE_EQ_ORDERED(sort_after_a->get_output(), expected_result);
 }
 
+TEST_P(OperatorsSortTest, MultipleColumnSort) {
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float4.tbl", 2));
+  table_wrapper->execute();
+
+  auto sort = std::make_shared<Sort>(
+      table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending},
+                                                       SortColumnDefinition{ColumnID{1}, OrderByMode::Ascending}},
+      2u);
+  sort->execute();
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), load_table("resources/test_data/tbl/int_float2_sorted.tbl", 2));
+
+  auto sort_mixed = std::make_shared<Sort>(
+      table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending},
+                                                       SortColumnDefinition{ColumnID{1}, OrderByMode::Descending}},
+      2u);
+  sort_mixed->execute();
+  EXPECT_TABLE_EQ_ORDERED(sort_mixed->get_output(),
+                          load_table("resources/test_data/tbl/int_float2_sorted_mixed.tbl", 2));
+}
+
+TEST_P(OperatorsSortTest, MultipleColumnSortWithStringsAndNulls) {
+  const auto column_definitions = TableColumnDefinitions{{"s", DataType::String, true},
+                                                         {"i", DataType::Int, true},
+                                                         {"d", DataType::Double, false},
+                                                         {"l", DataType::Long, false}};
+
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+  table->append({"b", 3, 1.5, int64_t{1}});
+  table->append({NULL_VALUE, 1, 0.0, int64_t{2}});
+  table->append({"a", NULL_VALUE, -2.5, int64_t{1}});
+  table->append({"b", NULL_VALUE, 3.0, int64_t{2}});
+  table->append({"a", 7, -1.0, int64_t{1}});
+  table->append({"b", 3, -0.5, int64_t{2}});
+  table->append({NULL_VALUE, 2, 2.0, int64_t{1}});
+  ChunkEncoder::encode_all_chunks(table, _encoding_type);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // The normalized keys are 18 bytes wide and therefore sorted without the radix sort
+  auto sort = std::make_shared<Sort>(
+      table_wrapper,
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::AscendingNullsLast},
+                                        SortColumnDefinition{ColumnID{1}, OrderByMode::Descending},
+                                        SortColumnDefinition{ColumnID{2}, OrderByMode::Descending}},
+      3u);
+  sort->execute();
+
+  auto expected_result = std::make_shared<Table>(column_definitions, TableType::Data, 3);
+  expected_result->append({"a", NULL_VALUE, -2.5, int64_t{1}});
+  expected_result->append({"a", 7, -1.0, int64_t{1}});
+  expected_result->append({"b", NULL_VALUE, 3.0, int64_t{2}});
+  expected_result->append({"b", 3, 1.5, int64_t{1}});
+  expected_result->append({"b", 3, -0.5, int64_t{2}});
+  expected_result->append({NULL_VALUE, 2, 2.0, int64_t{1}});
+  expected_result->append({NULL_VALUE, 1, 0.0, int64_t{2}});
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
+
+  // Rows with equal keys are spread over all chunks and have to keep their order when the runs are merged
+  auto sort_stable = std::make_shared<Sort>(table_wrapper, ColumnID{3}, OrderByMode::Descending, 3u);
+  sort_stable->execute();
+
+  auto expected_stable_result = std::make_shared<Table>(column_definitions, TableType::Data, 3);
+  expected_stable_result->append({NULL_VALUE, 1, 0.0, int64_t{2}});
+  expected_stable_result->append({"b", NULL_VALUE, 3.0, int64_t{2}});
+  expected_stable_result->append({"b", 3, -0.5, int64_t{2}});
+  expected_stable_result->append({"b", 3, 1.5, int64_t{1}});
+  expected_stable_result->append({"a", NULL_VALUE, -2.5, int64_t{1}});
+  expected_stable_result->append({"a", 7, -1.0, int64_t{1}});
+  expected_stable_result->append({NULL_VALUE, 2, 2.0, int64_t{1}});
+  EXPECT_TABLE_EQ_ORDERED(sort_stable->get_output(), expected_stable_result);
+}
+
 TEST_P(OperatorsSortTest, AscendingSortOfOneColumnWithNull) {
   std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float_null_sorted_asc.tbl", 2);
 
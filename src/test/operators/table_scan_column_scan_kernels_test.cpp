@@ -0,0 +1,129 @@
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/table_scan/column_scan_kernels.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/value_segment.hpp"
+#include "type_comparison.hpp"
+
+namespace opossum {
+
+class ColumnScanKernelsTest : public BaseTestWithParam<SegmentEncodingSpec> {
+ protected:
+  void SetUp() override {
+    // 0, 1, ..., 9, 0, 1, ... with every seventh value being NULL
+    auto values = std::vector<int32_t>{};
+    auto null_values = std::vector<bool>{};
+    for (auto index = 0; index < 5000; ++index) {
+      values.emplace_back(index % 10);
+      null_values.emplace_back(index % 7 == 0);
+    }
+    _values = values;
+    _null_values = null_values;
+
+    const auto value_segment = std::make_shared<ValueSegment<int32_t>>(std::move(values), std::move(null_values));
+    const auto encoding_spec = GetParam();
+    if (encoding_spec.encoding_type == EncodingType::Unencoded) {
+      _segment = value_segment;
+    } else {
+      _segment = encode_and_compress_segment(value_segment, DataType::Int, encoding_spec);
+    }
+  }
+
+  // The offsets within @param positions whose values match the predicate, computed without a kernel
+  std::vector<ChunkOffset> expected_matches(const PredicateCondition predicate_condition, const int32_t value,
+                                            const int32_t second_value, const std::vector<ChunkOffset>& positions) {
+    auto matches = std::vector<ChunkOffset>{};
+    for (auto index = ChunkOffset{0}; index < positions.size(); ++index) {
+      const auto position = positions[index];
+      if (_null_values[position]) continue;
+
+      auto row_matches = false;
+      if (is_between_predicate_condition(predicate_condition)) {
+        with_between_comparator(predicate_condition, [&](const auto comparator) {
+          row_matches = comparator(_values[position], value, second_value);
+        });
+      } else {
+        with_comparator(predicate_condition, [&](const auto comparator) {
+          row_matches = comparator(_values[position], value);
+        });
+      }
+      if (row_matches) matches.emplace_back(index);
+    }
+    return matches;
+  }
+
+  std::vector<int32_t> _values;
+  std::vector<bool> _null_values;
+  std::shared_ptr<BaseSegment> _segment;
+};
+
+INSTANTIATE_TEST_CASE_P(ColumnScanKernelsTestInstances, ColumnScanKernelsTest,
+                        ::testing::Values(SegmentEncodingSpec{EncodingType::Unencoded},
+                                          SegmentEncodingSpec{EncodingType::Dictionary,
+                                                              VectorCompressionType::FixedSizeByteAligned},
+                                          SegmentEncodingSpec{EncodingType::Dictionary,
+                                                              VectorCompressionType::SimdBp128},
+                                          SegmentEncodingSpec{EncodingType::FrameOfReference,
+                                                              VectorCompressionType::FixedSizeByteAligned},
+                                          SegmentEncodingSpec{EncodingType::FrameOfReference,
+                                                              VectorCompressionType::SimdBp128}), );  // NOLINT
+
+TEST_P(ColumnScanKernelsTest, MatchesGenericScan) {
+  auto all_positions = std::vector<ChunkOffset>(_values.size());
+  std::iota(all_positions.begin(), all_positions.end(), ChunkOffset{0});
+
+  // Every third position, in reverse order
+  auto position_filter = PosList{};
+  auto filtered_positions = std::vector<ChunkOffset>{};
+  for (auto position = static_cast<ChunkOffset>(_values.size()); position >= 3; position -= 3) {
+    position_filter.emplace_back(RowID{ChunkID{0}, position - 1});
+    filtered_positions.emplace_back(position - 1);
+  }
+
+  const auto predicate_conditions = {PredicateCondition::Equals,
+                                     PredicateCondition::LessThan,
+                                     PredicateCondition::LessThanEquals,
+                                     PredicateCondition::GreaterThan,
+                                     PredicateCondition::GreaterThanEquals,
+                                     PredicateCondition::BetweenInclusive,
+                                     PredicateCondition::BetweenLowerExclusive,
+                                     PredicateCondition::BetweenUpperExclusive,
+                                     PredicateCondition::BetweenExclusive};
+
+  // Values below, within, and above the value range of the segment
+  for (const auto predicate_condition : predicate_conditions) {
+    for (const auto& [value, second_value] : std::vector<std::pair<int32_t, int32_t>>{{-1, 3}, {3, 7}, {7, 12}}) {
+      const auto kernel = get_column_scan_kernel(*_segment, predicate_condition);
+      ASSERT_TRUE(kernel);
+
+      auto matches = PosList{};
+      kernel(*_segment, value, second_value, nullptr, ChunkID{2}, matches);
+      auto match_offsets = std::vector<ChunkOffset>{};
+      for (const auto& match : matches) {
+        EXPECT_EQ(match.chunk_id, ChunkID{2});
+        match_offsets.emplace_back(match.chunk_offset);
+      }
+      EXPECT_EQ(match_offsets, expected_matches(predicate_condition, value, second_value, all_positions));
+
+      auto filtered_matches = PosList{};
+      kernel(*_segment, value, second_value, &position_filter, ChunkID{2}, filtered_matches);
+      auto filtered_match_offsets = std::vector<ChunkOffset>{};
+      for (const auto& match : filtered_matches) filtered_match_offsets.emplace_back(match.chunk_offset);
+      EXPECT_EQ(filtered_match_offsets,
+                expected_matches(predicate_condition, value, second_value, filtered_positions));
+    }
+  }
+}
+
+TEST_P(ColumnScanKernelsTest, NoKernelForUncommonPredicates) {
+  EXPECT_FALSE(get_column_scan_kernel(*_segment, PredicateCondition::NotEquals));
+  EXPECT_FALSE(get_column_scan_kernel(*_segment, PredicateCondition::IsNull));
+}
+
+}  // namespace opossum
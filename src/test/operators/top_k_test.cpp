@@ -0,0 +1,129 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "operators/limit.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
+#include "operators/union_all.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsTopKTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Ten chunks with ascending values in column a, so that the chunk statistics can be used to skip chunks
+    _column_definitions = TableColumnDefinitions{
+        {"a", DataType::Int, false}, {"b", DataType::String, true}, {"c", DataType::Double, true}};
+    _table = std::make_shared<Table>(_column_definitions, TableType::Data, 10);
+    for (auto row_index = 0; row_index < 100; ++row_index) {
+      const auto b = row_index % 7 == 0 ? NULL_VALUE : AllTypeVariant{pmr_string(1, 'a' + row_index % 5)};
+      const auto c = row_index % 11 == 0 ? NULL_VALUE : AllTypeVariant{static_cast<double>(row_index % 3)};
+      _table->append({row_index / 2, b, c});
+    }
+  }
+
+  // Checks that TopK returns the same rows in the same order as a Sort followed by a Limit
+  void test_top_k(const std::shared_ptr<AbstractOperator>& input,
+                  const std::vector<SortColumnDefinition>& definitions) {
+    for (const auto k : {int64_t{0}, int64_t{1}, int64_t{5}, int64_t{17}, int64_t{150}}) {
+      auto sort = std::make_shared<Sort>(input, definitions);
+      sort->execute();
+      auto limit = std::make_shared<Limit>(sort, value_(k));
+      limit->execute();
+
+      auto top_k = std::make_shared<TopK>(input, definitions, value_(k));
+      top_k->execute();
+
+      EXPECT_TABLE_EQ_ORDERED(top_k->get_output(), limit->get_output());
+    }
+  }
+
+  TableColumnDefinitions _column_definitions;
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsTopKTest, MatchesSortAndLimit) {
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+
+  test_top_k(table_wrapper, {SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending}});
+  test_top_k(table_wrapper, {SortColumnDefinition{ColumnID{0}, OrderByMode::Descending}});
+  test_top_k(table_wrapper, {SortColumnDefinition{ColumnID{1}, OrderByMode::AscendingNullsLast},
+                             SortColumnDefinition{ColumnID{2}, OrderByMode::Descending}});
+  test_top_k(table_wrapper, {SortColumnDefinition{ColumnID{2}, OrderByMode::DescendingNullsLast},
+                             SortColumnDefinition{ColumnID{1}, OrderByMode::Ascending},
+                             SortColumnDefinition{ColumnID{0}, OrderByMode::Descending}});
+}
+
+TEST_F(OperatorsTopKTest, MatchesSortAndLimitOnEncodedChunks) {
+  // Encoded chunks have statistics, which TopK uses to skip chunks that cannot contain any of the top rows
+  ChunkEncoder::encode_all_chunks(_table, EncodingType::Dictionary);
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+
+  test_top_k(table_wrapper, {SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending}});
+  test_top_k(table_wrapper, {SortColumnDefinition{ColumnID{0}, OrderByMode::DescendingNullsLast},
+                             SortColumnDefinition{ColumnID{2}, OrderByMode::Ascending}});
+  test_top_k(table_wrapper, {SortColumnDefinition{ColumnID{2}, OrderByMode::AscendingNullsLast}});
+}
+
+TEST_F(OperatorsTopKTest, MatchesSortAndLimitOnReferences) {
+  ChunkEncoder::encode_all_chunks(_table, EncodingType::Dictionary);
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+
+  auto table_scan = create_table_scan(table_wrapper, ColumnID{2}, PredicateCondition::GreaterThan, 0.0);
+  table_scan->execute();
+
+  test_top_k(table_scan, {SortColumnDefinition{ColumnID{0}, OrderByMode::Descending}});
+  test_top_k(table_scan, {SortColumnDefinition{ColumnID{1}, OrderByMode::Ascending},
+                          SortColumnDefinition{ColumnID{0}, OrderByMode::AscendingNullsLast}});
+
+  auto top_k = std::make_shared<TopK>(table_scan, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}},
+                                      value_(int64_t{3}));
+  top_k->execute();
+  EXPECT_EQ(top_k->get_output()->type(), TableType::References);
+}
+
+TEST_F(OperatorsTopKTest, MatchesSortAndLimitOnReferencesToDifferentTables) {
+  // The chunks of a UnionAll reference different tables, so the rows of the result are resolved per input chunk
+  auto other_table = std::make_shared<Table>(_column_definitions, TableType::Data, 10);
+  for (auto row_index = 0; row_index < 50; ++row_index) {
+    other_table->append({row_index + 3, pmr_string{"b"}, static_cast<double>(row_index % 4)});
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  auto other_table_wrapper = std::make_shared<TableWrapper>(other_table);
+  other_table_wrapper->execute();
+
+  auto table_scan = create_table_scan(table_wrapper, ColumnID{2}, PredicateCondition::GreaterThan, 0.0);
+  table_scan->execute();
+  auto other_table_scan = create_table_scan(other_table_wrapper, ColumnID{2}, PredicateCondition::GreaterThan, 0.0);
+  other_table_scan->execute();
+
+  auto union_all = std::make_shared<UnionAll>(table_scan, other_table_scan);
+  union_all->execute();
+
+  test_top_k(union_all, {SortColumnDefinition{ColumnID{0}, OrderByMode::Descending}});
+  test_top_k(union_all, {SortColumnDefinition{ColumnID{2}, OrderByMode::Ascending},
+                         SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending}});
+
+  // The best rows alternate between both tables
+  auto top_k = std::make_shared<TopK>(union_all, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}},
+                                      value_(int64_t{20}));
+  top_k->execute();
+  EXPECT_GT(top_k->get_output()->chunk_count(), 1u);
+}
+
+}  // namespace opossum
@@ -76,6 +76,24 @@ TEST_F(ColumnPruningRuleTest, NoUnion) {
   EXPECT_LQP_EQ(actual_lqp, expected_lqp);
 }
 
+TEST_F(ColumnPruningRuleTest, PrunedColumnsStayPruned) {
+  // clang-format off
+  const auto lqp =
+  ProjectionNode::make(expression_vector(a),
+    PredicateNode::make(greater_than_(a, 5),
+      node_a));
+  // clang-format on
+
+  node_a->set_pruned_column_ids({ColumnID{1}});
+
+  // Applying the rule again (e.g., when re-optimizing) must not bring back previously pruned columns
+  const auto actual_lqp = apply_rule(rule, lqp);
+  EXPECT_EQ(node_a->pruned_column_ids(), std::vector<ColumnID>({ColumnID{1}, ColumnID{2}}));
+
+  apply_rule(rule, actual_lqp);
+  EXPECT_EQ(node_a->pruned_column_ids(), std::vector<ColumnID>({ColumnID{1}, ColumnID{2}}));
+}
+
 TEST_F(ColumnPruningRuleTest, WithUnion) {
   // clang-format off
   auto lqp = std::shared_ptr<AbstractLQPNode>{};
@@ -0,0 +1,104 @@
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "optimizer/strategy/common_subexpression_elimination_rule.hpp"
+
+#include "strategy_base_test.hpp"
+#include "testing_assert.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class CommonSubexpressionEliminationRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    node_a = MockNode::make(
+        MockNode::ColumnDefinitions{{DataType::Int, "a"}, {DataType::Int, "b"}, {DataType::Int, "c"}}, "a");
+
+    a = node_a->get_column("a");
+    b = node_a->get_column("b");
+    c = node_a->get_column("c");
+
+    rule = std::make_shared<CommonSubexpressionEliminationRule>();
+  }
+
+  std::shared_ptr<CommonSubexpressionEliminationRule> rule;
+  std::shared_ptr<MockNode> node_a;
+  LQPColumnReference a, b, c;
+};
+
+TEST_F(CommonSubexpressionEliminationRuleTest, NoCommonSubexpressions) {
+  // clang-format off
+  const auto lqp =
+  ProjectionNode::make(expression_vector(a, add_(a, b), add_(b, c), mul_(a, 2)),
+    node_a);
+  // clang-format on
+
+  const auto expected_lqp = lqp->deep_copy();
+  const auto actual_lqp = apply_rule(rule, lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(CommonSubexpressionEliminationRuleTest, ExtractCommonSubexpression) {
+  // Resembles the pre-aggregate projection of TPC-H Q1
+  const auto discounted_price = mul_(a, sub_(1, b));
+
+  // clang-format off
+  const auto lqp =
+  ProjectionNode::make(expression_vector(discounted_price, mul_(discounted_price, add_(1, c))),
+    node_a);
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(discounted_price, mul_(discounted_price, add_(1, c))),
+    ProjectionNode::make(expression_vector(c, discounted_price),
+      node_a));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(CommonSubexpressionEliminationRuleTest, NestedCommonSubexpressions) {
+  // a + b is shared by the common sub-expression (a + b) + 1 and by (a + b) * 4
+  const auto a_plus_b = add_(a, b);
+  const auto a_plus_b_plus_1 = add_(a_plus_b, 1);
+
+  // clang-format off
+  const auto lqp =
+  ProjectionNode::make(expression_vector(mul_(a_plus_b_plus_1, 2), mul_(a_plus_b_plus_1, 3), mul_(a_plus_b, 4)),
+    node_a);
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(mul_(a_plus_b_plus_1, 2), mul_(a_plus_b_plus_1, 3), mul_(a_plus_b, 4)),
+    ProjectionNode::make(expression_vector(a_plus_b_plus_1, a_plus_b),
+      ProjectionNode::make(expression_vector(a_plus_b),
+        node_a)));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(CommonSubexpressionEliminationRuleTest, IgnoreExpressionsProvidedByInput) {
+  const auto a_plus_b = add_(a, b);
+
+  // clang-format off
+  const auto lqp =
+  ProjectionNode::make(expression_vector(mul_(a_plus_b, 2), mul_(a_plus_b, 3)),
+    ProjectionNode::make(expression_vector(a_plus_b),
+      node_a));
+  // clang-format on
+
+  const auto expected_lqp = lqp->deep_copy();
+  const auto actual_lqp = apply_rule(rule, lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+}  // namespace opossum
@@ -0,0 +1,89 @@
+#include "strategy_base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/alias_node.hpp"
+#include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/union_node.hpp"
+#include "optimizer/strategy/limit_pushdown_rule.hpp"
+#include "testing_assert.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class LimitPushdownRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    node_a = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}, {DataType::Int, "b"}});
+    a_a = node_a->get_column("a");
+    a_b = node_a->get_column("b");
+
+    rule = std::make_shared<LimitPushdownRule>();
+  }
+
+  std::shared_ptr<MockNode> node_a;
+  LQPColumnReference a_a, a_b;
+  std::shared_ptr<LimitPushdownRule> rule;
+};
+
+TEST_F(LimitPushdownRuleTest, PushesBelowProjectionsAndAliases) {
+  // clang-format off
+  const auto input_lqp =
+  AliasNode::make(expression_vector(add_(a_a, a_b)), std::vector<std::string>{"x"},
+    LimitNode::make(value_(10),
+      ProjectionNode::make(expression_vector(add_(a_a, a_b)),
+        ProjectionNode::make(expression_vector(a_a, a_b),
+          PredicateNode::make(greater_than_(a_a, 5),
+            node_a)))));
+
+  const auto expected_lqp =
+  AliasNode::make(expression_vector(add_(a_a, a_b)), std::vector<std::string>{"x"},
+    ProjectionNode::make(expression_vector(add_(a_a, a_b)),
+      ProjectionNode::make(expression_vector(a_a, a_b),
+        LimitNode::make(value_(10),
+          PredicateNode::make(greater_than_(a_a, 5),
+            node_a)))));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(LimitPushdownRuleTest, KeepsLimitAboveRowChangingNodes) {
+  // clang-format off
+  const auto input_lqp =
+  LimitNode::make(value_(10),
+    SortNode::make(expression_vector(a_a), std::vector<OrderByMode>{OrderByMode::Ascending},
+      ProjectionNode::make(expression_vector(add_(a_a, a_b), a_a),
+        node_a)));
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(LimitPushdownRuleTest, KeepsLimitAboveSharedProjection) {
+  const auto projection_node = ProjectionNode::make(expression_vector(add_(a_a, a_b)), node_a);
+
+  // clang-format off
+  const auto input_lqp =
+  UnionNode::make(UnionMode::Positions,
+    LimitNode::make(value_(10),
+      projection_node),
+    projection_node);
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+}  // namespace opossum
@@ -0,0 +1,154 @@
+#include <arpa/inet.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "server/copy_data_parser.hpp"
+#include "server/types.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class CopyDataParserTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _column_definitions = TableColumnDefinitions{{"a", DataType::Int, false},
+                                                 {"b", DataType::Double, true},
+                                                 {"c", DataType::String, true}};
+    _expected_table = std::make_shared<Table>(_column_definitions, TableType::Data);
+  }
+
+  // Appends the data in pieces of the given size and parses all batches into a table
+  std::shared_ptr<Table> parse(const std::string& data, const CopyFormat format, const size_t piece_size,
+                               const ChunkOffset batch_row_count = 100) {
+    auto parser = CopyDataParser{_column_definitions, format, batch_row_count};
+    auto batches = std::vector<std::string>{};
+    for (auto offset = size_t{0}; offset < data.size(); offset += piece_size) {
+      parser.append(std::string_view{data}.substr(offset, piece_size));
+      while (auto batch = parser.next_batch()) {
+        batches.emplace_back(std::move(*batch));
+      }
+    }
+    batches.emplace_back(parser.finish());
+
+    auto table = std::make_shared<Table>(_column_definitions, TableType::Data, batch_row_count);
+    for (const auto& batch : batches) {
+      const auto segments = parser.parse_batch(batch);
+      if (segments.front()->size() > 0) table->append_chunk(segments);
+    }
+    return table;
+  }
+
+  static void append_int16(std::string& data, const int16_t value) {
+    const auto network_value = htons(static_cast<uint16_t>(value));
+    data.append(reinterpret_cast<const char*>(&network_value), sizeof(network_value));
+  }
+
+  static void append_int32(std::string& data, const int32_t value) {
+    const auto network_value = htonl(static_cast<uint32_t>(value));
+    data.append(reinterpret_cast<const char*>(&network_value), sizeof(network_value));
+  }
+
+  TableColumnDefinitions _column_definitions;
+  std::shared_ptr<Table> _expected_table;
+};
+
+TEST_F(CopyDataParserTest, ParseText) {
+  const auto data = std::string{"1\t0.5\tfoo\n2\t\\N\ta\\tb\\\\c\\nd\r\n3\t-2e3\t\\N\n4\t1\t\\\\N"};
+  _expected_table->append({1, 0.5, "foo"});
+  _expected_table->append({2, NULL_VALUE, "a\tb\\c\nd"});
+  _expected_table->append({3, -2000.0, NULL_VALUE});
+  _expected_table->append({4, 1.0, "\\N"});
+
+  // The pieces end within rows, fields, and escape sequences
+  for (const auto piece_size : {size_t{1}, size_t{3}, size_t{7}, data.size()}) {
+    EXPECT_TABLE_EQ_ORDERED(parse(data, CopyFormat::Text, piece_size), _expected_table);
+  }
+}
+
+TEST_F(CopyDataParserTest, ParseCsv) {
+  const auto data = std::string{"1,0.5,foo\n2,,\"a,\"\"b\"\"\nc\"\r\n3,-2e3,\n4,1,\"\"\n"};
+  _expected_table->append({1, 0.5, "foo"});
+  _expected_table->append({2, NULL_VALUE, "a,\"b\"\nc"});
+  _expected_table->append({3, -2000.0, NULL_VALUE});
+  _expected_table->append({4, 1.0, ""});
+
+  for (const auto piece_size : {size_t{1}, size_t{4}, data.size()}) {
+    EXPECT_TABLE_EQ_ORDERED(parse(data, CopyFormat::Csv, piece_size), _expected_table);
+  }
+}
+
+TEST_F(CopyDataParserTest, ParseBinary) {
+  // Header with an extension of two bytes
+  auto data = std::string{"PGCOPY\n\377\r\n\0", 11};
+  append_int32(data, 0);
+  append_int32(data, 2);
+  data.append("xx");
+
+  append_int16(data, 3);
+  append_int32(data, 4);
+  append_int32(data, 7);
+  append_int32(data, 8);
+  data.append("\x3f\xe0\x00\x00\x00\x00\x00\x00", 8);
+  append_int32(data, 3);
+  data.append("foo");
+
+  append_int16(data, 3);
+  append_int32(data, 4);
+  append_int32(data, -8);
+  append_int32(data, -1);
+  append_int32(data, 0);
+
+  // Trailer
+  append_int16(data, -1);
+
+  _expected_table->append({7, 0.5, "foo"});
+  _expected_table->append({-8, NULL_VALUE, ""});
+
+  for (const auto piece_size : {size_t{1}, size_t{5}, data.size()}) {
+    EXPECT_TABLE_EQ_ORDERED(parse(data, CopyFormat::Binary, piece_size), _expected_table);
+  }
+}
+
+TEST_F(CopyDataParserTest, SplitIntoBatches) {
+  auto parser = CopyDataParser{_column_definitions, CopyFormat::Text, 2};
+
+  parser.append("1\t1\ta\n2\t2\tb\n3\t3");
+  const auto first_batch = parser.next_batch();
+  ASSERT_TRUE(first_batch);
+  EXPECT_EQ(*first_batch, "1\t1\ta\n2\t2\tb\n");
+  EXPECT_FALSE(parser.next_batch());
+
+  parser.append("\tc\n4\t4\td\n5\t5\te\n");
+  const auto second_batch = parser.next_batch();
+  ASSERT_TRUE(second_batch);
+  EXPECT_EQ(*second_batch, "3\t3\tc\n4\t4\td\n");
+  EXPECT_FALSE(parser.next_batch());
+
+  const auto last_batch = parser.finish();
+  EXPECT_EQ(last_batch, "5\t5\te\n");
+  EXPECT_EQ(parser.parse_batch(last_batch).front()->size(), 1u);
+}
+
+TEST_F(CopyDataParserTest, RejectInvalidData) {
+  // Wrong number of fields
+  EXPECT_THROW(parse("1\t1\n", CopyFormat::Text, 4), InvalidInputException);
+  EXPECT_THROW(parse("1,1,a,b\n", CopyFormat::Csv, 4), InvalidInputException);
+
+  // Values that do not match the column types
+  EXPECT_THROW(parse("x\t1\ta\n", CopyFormat::Text, 4), InvalidInputException);
+  EXPECT_THROW(parse("1\t1.5.3\ta\n", CopyFormat::Text, 4), InvalidInputException);
+  EXPECT_THROW(parse("\\N\t1\ta\n", CopyFormat::Text, 4), InvalidInputException);
+
+  // Data that ends within a quoted field or without trailer
+  EXPECT_THROW(parse("1,1,\"a\n", CopyFormat::Csv, 4), InvalidInputException);
+  EXPECT_THROW(parse(std::string{"PGCOPY\n\377\r\n\0\0\0\0\0\0\0\0\0", 19}, CopyFormat::Binary, 4),
+               InvalidInputException);
+  EXPECT_THROW(parse("COPY\n", CopyFormat::Binary, 4), InvalidInputException);
+}
+
+}  // namespace opossum
@@ -7,11 +7,14 @@
 #include "gmock/gmock.h"
 
 #include "storage/prepared_plan.hpp"
+#include "tasks/server/append_server_copy_data_task.hpp"
 #include "tasks/server/bind_server_prepared_statement_task.hpp"
 #include "tasks/server/create_pipeline_task.hpp"
 #include "tasks/server/execute_server_prepared_statement_task.hpp"
 #include "tasks/server/execute_server_query_task.hpp"
+#include "tasks/server/execute_server_result_batch_task.hpp"
 #include "tasks/server/load_server_file_task.hpp"
+#include "tasks/server/parse_server_copy_data_task.hpp"
 #include "tasks/server/parse_server_prepared_statement_task.hpp"
 
 namespace opossum {
@@ -26,8 +29,13 @@ class MockTaskRunner {
                boost::future<std::unique_ptr<CreatePipelineResult>>(std::shared_ptr<CreatePipelineTask>));
   MOCK_METHOD1(dispatch_server_task,
                boost::future<std::shared_ptr<const Table>>(std::shared_ptr<ExecuteServerPreparedStatementTask>));
-  MOCK_METHOD1(dispatch_server_task, boost::future<void>(std::shared_ptr<ExecuteServerQueryTask>));
+  MOCK_METHOD1(dispatch_server_task,
+               boost::future<std::shared_ptr<const Table>>(std::shared_ptr<ExecuteServerQueryTask>));
+  MOCK_METHOD1(dispatch_server_task,
+               boost::future<std::shared_ptr<const Table>>(std::shared_ptr<ExecuteServerResultBatchTask>));
   MOCK_METHOD1(dispatch_server_task, boost::future<void>(std::shared_ptr<LoadServerFileTask>));
+  MOCK_METHOD1(dispatch_server_task, boost::future<Segments>(std::shared_ptr<ParseServerCopyDataTask>));
+  MOCK_METHOD1(dispatch_server_task, boost::future<uint64_t>(std::shared_ptr<AppendServerCopyDataTask>));
 };
 
 }  // namespace opossum
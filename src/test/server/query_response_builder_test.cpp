@@ -0,0 +1,144 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "server/postgres_wire_handler.hpp"
+#include "server/query_response_builder.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class QueryResponseBuilderTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto column_definitions =
+        TableColumnDefinitions{{"a", DataType::Int, true},   {"b", DataType::Long, false},
+                               {"c", DataType::Float, false}, {"d", DataType::Double, false},
+                               {"e", DataType::String, true}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+    _table->append({-12, int64_t{5000000000}, 1.5f, 0.1, "abc"});
+    _table->append({NULL_VALUE, int64_t{-1}, -2.0f, 1e20, NULL_VALUE});
+  }
+
+  // Appends a value with its length as expected in a DataRow message
+  static void append_value(ByteBuffer& expected_bytes, const std::string& value) {
+    append_int32(expected_bytes, static_cast<int32_t>(value.size()));
+    expected_bytes.insert(expected_bytes.end(), value.begin(), value.end());
+  }
+
+  static void append_int32(ByteBuffer& expected_bytes, const int32_t value) {
+    const auto network_value = htonl(static_cast<uint32_t>(value));
+    const auto chars = reinterpret_cast<const char*>(&network_value);
+    expected_bytes.insert(expected_bytes.end(), chars, chars + sizeof(network_value));
+  }
+
+  static void append_data_row_header(ByteBuffer& expected_bytes, const int32_t message_size) {
+    expected_bytes.push_back('D');
+    append_int32(expected_bytes, message_size);
+    expected_bytes.push_back(0);
+    expected_bytes.push_back(5);
+  }
+
+  std::shared_ptr<Table> _table;
+  const std::vector<ResultFormat> _text_formats = std::vector<ResultFormat>(5, ResultFormat::Text);
+  const std::vector<ResultFormat> _binary_formats = std::vector<ResultFormat>(5, ResultFormat::Binary);
+};
+
+TEST_F(QueryResponseBuilderTest, BuildResultFormats) {
+  EXPECT_EQ(QueryResponseBuilder::build_result_formats({}, 2),
+            std::vector<ResultFormat>({ResultFormat::Text, ResultFormat::Text}));
+  EXPECT_EQ(QueryResponseBuilder::build_result_formats({1}, 2),
+            std::vector<ResultFormat>({ResultFormat::Binary, ResultFormat::Binary}));
+  EXPECT_EQ(QueryResponseBuilder::build_result_formats({1, 0}, 2),
+            std::vector<ResultFormat>({ResultFormat::Binary, ResultFormat::Text}));
+
+  EXPECT_THROW(QueryResponseBuilder::build_result_formats({0, 1, 0}, 2), InvalidInputException);
+  EXPECT_THROW(QueryResponseBuilder::build_result_formats({2}, 2), InvalidInputException);
+}
+
+TEST_F(QueryResponseBuilderTest, BuildRowDescription) {
+  const auto result_formats = QueryResponseBuilder::build_result_formats({1}, 5);
+  const auto row_description = QueryResponseBuilder::build_row_description(_table, result_formats);
+
+  ASSERT_EQ(row_description.size(), 5u);
+  EXPECT_EQ(row_description[0].column_name, "a");
+  EXPECT_EQ(row_description[0].object_id, 23u);
+  EXPECT_EQ(row_description[4].type_width, -1);
+  EXPECT_EQ(row_description[4].format, ResultFormat::Binary);
+}
+
+TEST_F(QueryResponseBuilderTest, BuildTextDataRows) {
+  auto packet = OutputPacket{};
+  QueryResponseBuilder::build_data_rows(*_table->get_chunk(ChunkID{0}), _text_formats, packet);
+
+  auto expected_bytes = ByteBuffer{};
+  // Length, column count, and the values with their lengths
+  append_data_row_header(expected_bytes, 4 + 2 + 5 * 4 + 3 + 10 + 3 + 3 + 3);
+  append_value(expected_bytes, "-12");
+  append_value(expected_bytes, "5000000000");
+  append_value(expected_bytes, "1.5");
+  append_value(expected_bytes, "0.1");
+  append_value(expected_bytes, "abc");
+
+  // NULLs are sent with a length of -1 and without value bytes
+  append_data_row_header(expected_bytes, 4 + 2 + 5 * 4 + 2 + 2 + 5);
+  append_int32(expected_bytes, -1);
+  append_value(expected_bytes, "-1");
+  append_value(expected_bytes, "-2");
+  append_value(expected_bytes, "1e+20");
+  append_int32(expected_bytes, -1);
+
+  EXPECT_EQ(packet.data, expected_bytes);
+}
+
+TEST_F(QueryResponseBuilderTest, BuildBinaryDataRows) {
+  auto packet = OutputPacket{};
+  packet.data = {'x'};
+  QueryResponseBuilder::build_data_rows(*_table->get_chunk(ChunkID{0}), _binary_formats, packet);
+
+  // The DataRow messages are appended to the existing content of the packet
+  auto expected_bytes = ByteBuffer{'x'};
+  append_data_row_header(expected_bytes, 4 + 2 + 5 * 4 + 4 + 8 + 4 + 8 + 3);
+  append_value(expected_bytes, std::string{"\xff\xff\xff\xf4", 4});
+  append_value(expected_bytes, std::string{"\x00\x00\x00\x01\x2a\x05\xf2\x00", 8});
+  append_value(expected_bytes, std::string{"\x3f\xc0\x00\x00", 4});
+  append_value(expected_bytes, std::string{"\x3f\xb9\x99\x99\x99\x99\x99\x9a", 8});
+  append_value(expected_bytes, "abc");
+
+  append_data_row_header(expected_bytes, 4 + 2 + 5 * 4 + 8 + 4 + 8);
+  append_int32(expected_bytes, -1);
+  append_value(expected_bytes, std::string{"\xff\xff\xff\xff\xff\xff\xff\xff", 8});
+  append_value(expected_bytes, std::string{"\xc0\x00\x00\x00", 4});
+  append_value(expected_bytes, std::string{"\x44\x15\xaf\x1d\x78\xb5\x8c\x40", 8});
+  append_int32(expected_bytes, -1);
+
+  EXPECT_EQ(packet.data, expected_bytes);
+}
+
+TEST_F(QueryResponseBuilderTest, SendQueryResponseCombinesSmallChunks) {
+  for (auto row_index = 0; row_index < 10; ++row_index) {
+    _table->append({row_index, int64_t{row_index}, 0.0f, 0.0, "x"});
+  }
+
+  auto packets = std::vector<std::shared_ptr<OutputPacket>>{};
+  const auto send_data_rows = [&](const std::shared_ptr<OutputPacket>& packet) {
+    packets.emplace_back(packet);
+    return boost::make_ready_future();
+  };
+
+  const auto row_count = QueryResponseBuilder::send_query_response(send_data_rows, *_table, _text_formats).get();
+  EXPECT_EQ(row_count, 12u);
+
+  // All six chunks fit into a single packet
+  ASSERT_EQ(packets.size(), 1u);
+  auto expected_data = OutputPacket{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    QueryResponseBuilder::build_data_rows(*_table->get_chunk(chunk_id), _text_formats, expected_data);
+  }
+  EXPECT_EQ(packets.front()->data, expected_data.data);
+}
+
+}  // namespace opossum
@@ -0,0 +1,118 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "expression/expression_functional.hpp"
+#include "operators/get_table.hpp"
+#include "operators/projection.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/validate.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/topology.hpp"
+#include "server/result_stream.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class ResultStreamTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // More chunks than cores, so that the result is streamed in more than one batch
+    _chunk_count = Topology::get().num_cpus() * 2 + 1;
+
+    const auto table = std::make_shared<Table>(
+        TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}}, TableType::Data, 3,
+        UseMvcc::Yes);
+    for (auto row_index = 0; row_index < static_cast<int>(_chunk_count * 3); ++row_index) {
+      table->append({row_index, row_index % 4});
+    }
+    StorageManager::get().add_table("t", table);
+  }
+
+  // Validate -> TableScan -> Projection on top of a GetTable, the typical plan of a point or range query
+  std::shared_ptr<AbstractOperator> create_plan() const {
+    const auto get_table = std::make_shared<GetTable>("t");
+    const auto validate = std::make_shared<Validate>(get_table);
+    const auto a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+    const auto b = pqp_column_(ColumnID{1}, DataType::Int, false, "b");
+    const auto table_scan = std::make_shared<TableScan>(validate, greater_than_(b, 0));
+    const auto projection = std::make_shared<Projection>(table_scan, expression_vector(add_(a, b), a));
+
+    projection->set_transaction_context_recursively(TransactionManager::get().new_transaction_context());
+    return projection;
+  }
+
+  size_t _chunk_count{0};
+};
+
+TEST_F(ResultStreamTest, ReturnsSameRowsAsCompleteExecution) {
+  const auto expected_plan = create_plan();
+  CurrentScheduler::schedule_and_wait_for_tasks(
+      OperatorTask::make_tasks_from_operator(expected_plan, CleanupTemporaries::Yes));
+
+  const auto result_stream = ResultStream::create(create_plan());
+  ASSERT_TRUE(result_stream);
+  result_stream->execute_input();
+
+  auto batches = std::vector<std::shared_ptr<const Table>>{};
+  while (result_stream->has_next_batch()) {
+    batches.emplace_back(result_stream->execute_next_batch());
+  }
+  EXPECT_EQ(batches.size(), 3u);
+
+  // The batches, concatenated in the order in which they were returned, form the complete result
+  auto streamed_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  for (const auto& batch : batches) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < batch->chunk_count(); ++chunk_id) {
+      streamed_chunks.emplace_back(std::const_pointer_cast<Chunk>(batch->get_chunk(chunk_id)));
+    }
+  }
+  const auto streamed_table = std::make_shared<Table>(batches.front()->column_definitions(), batches.front()->type(),
+                                                      std::move(streamed_chunks));
+
+  EXPECT_TABLE_EQ_ORDERED(streamed_table, expected_plan->get_output());
+}
+
+TEST_F(ResultStreamTest, ReturnsFirstBatchForEmptyInput) {
+  StorageManager::get().add_table(
+      "empty", std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data));
+  const auto a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto table_scan = std::make_shared<TableScan>(std::make_shared<GetTable>("empty"), greater_than_(a, 0));
+
+  const auto result_stream = ResultStream::create(table_scan);
+  ASSERT_TRUE(result_stream);
+  result_stream->execute_input();
+
+  ASSERT_TRUE(result_stream->has_next_batch());
+  const auto batch = result_stream->execute_next_batch();
+  ASSERT_TRUE(batch);
+  EXPECT_EQ(batch->column_count(), 1u);
+  EXPECT_EQ(batch->row_count(), 0u);
+  EXPECT_FALSE(result_stream->has_next_batch());
+}
+
+TEST_F(ResultStreamTest, OnlyStreamsChunkWisePipelines) {
+  // Without an operator that processes the chunks independently, there is nothing to stream
+  EXPECT_FALSE(ResultStream::create(std::make_shared<GetTable>("t")));
+
+  const auto sort =
+      std::make_shared<Sort>(create_plan(), std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{1}}});
+  EXPECT_FALSE(ResultStream::create(sort));
+
+  // Subqueries would be executed again for each batch
+  const auto subquery = pqp_subquery_(create_plan(), DataType::Int, false);
+  const auto table_scan = std::make_shared<TableScan>(
+      std::make_shared<GetTable>("t"), greater_than_(pqp_column_(ColumnID{0}, DataType::Int, false, "a"), subquery));
+  EXPECT_FALSE(ResultStream::create(table_scan));
+}
+
+}  // namespace opossum
@@ -6,6 +6,7 @@
 #include "base_test.hpp"
 #include "mock_connection.hpp"
 #include "mock_task_runner.hpp"
+#include "scheduler/topology.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 
 namespace opossum {
@@ -76,12 +77,41 @@ class ServerSessionTest : public BaseTest {
     ON_CALL(*_connection, send_row_description(_)).WillByDefault(Invoke([](const std::vector<ColumnDescription>&) {
       return boost::make_ready_future();
     }));
-    ON_CALL(*_connection, send_data_row(_)).WillByDefault(Invoke([](const std::vector<std::string>&) {
+    ON_CALL(*_connection, send_data_rows(_)).WillByDefault(Invoke([](const std::shared_ptr<OutputPacket>&) {
       return boost::make_ready_future();
     }));
     ON_CALL(*_connection, send_command_complete(_)).WillByDefault(Invoke([](const std::string&) {
       return boost::make_ready_future();
     }));
+    ON_CALL(*_connection, send_copy_in_response(_, _)).WillByDefault(Invoke([](CopyFormat, size_t) {
+      return boost::make_ready_future();
+    }));
+    ON_CALL(*_connection, flush()).WillByDefault(Invoke([]() { return boost::make_ready_future(); }));
+    ON_CALL(*_connection, skip_packet_body(_)).WillByDefault(Invoke([](uint32_t) {
+      return boost::make_ready_future();
+    }));
+  }
+
+  void _expect_sync() {
+    RequestHeader sync_request{NetworkMessageType::SyncCommand, 42};
+    EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(sync_request))));
+    EXPECT_CALL(*_connection, receive_sync_packet_body(42)).WillOnce(Return(ByMove(boost::make_ready_future())));
+    EXPECT_CALL(*_connection, send_ready_for_query());
+  }
+
+  void _expect_copy_data(const std::string& data) {
+    RequestHeader copy_data_request{NetworkMessageType::CopyDataCommand, static_cast<uint32_t>(data.size())};
+    EXPECT_CALL(*_connection, receive_packet_header())
+        .WillOnce(Return(ByMove(boost::make_ready_future(copy_data_request))));
+    EXPECT_CALL(*_connection, receive_copy_data_packet_body(static_cast<uint32_t>(data.size())))
+        .WillOnce(Return(ByMove(boost::make_ready_future(data))));
+  }
+
+  template <typename TTask>
+  static auto _execute_task(const std::shared_ptr<TTask>& task) {
+    auto future = task->get_future();
+    task->execute();
+    return future;
   }
 
   std::shared_ptr<SQLPipeline> _create_working_sql_pipeline() {
@@ -224,13 +254,14 @@ TEST_F(ServerSessionTest, SessionExecutesSimpleQueryCommand) {
 
   // The session executes the SQLPipeline using another scheduled task
   EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ExecuteServerQueryTask>>()))
-      .WillOnce(Return(ByMove(boost::make_ready_future())));
+      .WillOnce(Invoke(_execute_task<ExecuteServerQueryTask>));
 
   // It sends the result schema...
   EXPECT_CALL(*_connection, send_row_description(_));
 
   // ... as well as the row data (one message per row)
-  EXPECT_CALL(*_connection, send_data_row(_)).Times(3);
+  // All three rows are sent in one packet
+  EXPECT_CALL(*_connection, send_data_rows(_)).Times(1);
 
   // Finally, the session completes the command...
   EXPECT_CALL(*_connection, send_command_complete(_));
@@ -245,6 +276,49 @@ TEST_F(ServerSessionTest, SessionExecutesSimpleQueryCommand) {
   _session->start().wait();
 }
 
+TEST_F(ServerSessionTest, SessionStreamsSimpleQueryResultInBatches) {
+  // More chunks than cores, so that the result is streamed in three batches
+  const auto chunk_count = Topology::get().num_cpus() * 2 + 1;
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, 1,
+                                             UseMvcc::Yes);
+  for (auto row_index = 0; row_index < static_cast<int>(chunk_count); ++row_index) {
+    table->append({row_index});
+  }
+  StorageManager::get().add_table("foo", table);
+
+  const auto sql_pipeline =
+      std::make_shared<SQLPipeline>(SQLPipelineBuilder{"SELECT * FROM foo;"}.create_pipeline());
+  auto create_pipeline_result = std::make_unique<CreatePipelineResult>();
+  create_pipeline_result->sql_pipeline = sql_pipeline;
+
+  RequestHeader request{NetworkMessageType::SimpleQueryCommand, 42};
+  RequestHeader termination_header{NetworkMessageType::TerminateCommand, 0};
+  EXPECT_CALL(*_connection, receive_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(request))))
+      .WillOnce(Return(ByMove(boost::make_ready_future(termination_header))));
+  EXPECT_CALL(*_connection, receive_simple_query_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::string("SELECT * FROM foo;")))));
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<CreatePipelineTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::move(create_pipeline_result)))));
+
+  // The task only executes the first batch, the session requests the other two while sending the previous ones
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ExecuteServerQueryTask>>()))
+      .WillOnce(Invoke(_execute_task<ExecuteServerQueryTask>));
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ExecuteServerResultBatchTask>>()))
+      .Times(2)
+      .WillRepeatedly(Invoke(_execute_task<ExecuteServerResultBatchTask>));
+
+  // The rows of each batch are sent in one packet, the command is completed with the total row count
+  EXPECT_CALL(*_connection, send_row_description(_));
+  EXPECT_CALL(*_connection, send_data_rows(_)).Times(3);
+  EXPECT_CALL(*_connection, send_command_complete("SELECT " + std::to_string(chunk_count)));
+
+  _session->start().wait();
+
+  // The pipeline did not execute the statement, so the session committed it after the last batch
+  EXPECT_EQ(sql_pipeline->get_physical_plans().front()->transaction_context()->phase(), TransactionPhase::Committed);
+}
+
 TEST_F(ServerSessionTest, SessionHandlesExtendedProtocolFlow) {
   InSequence s;
 
@@ -272,7 +346,7 @@ TEST_F(ServerSessionTest, SessionHandlesExtendedProtocolFlow) {
   RequestHeader bind_request{NetworkMessageType::BindCommand, 42};
   EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(bind_request))));
 
-  BindPacket bind_packet = {"", "", {}};
+  BindPacket bind_packet = {"", "", {}, {}};
   EXPECT_CALL(*_connection, receive_bind_packet_body(42))
       .WillOnce(Return(ByMove(boost::make_ready_future(bind_packet))));
 
@@ -297,7 +371,8 @@ TEST_F(ServerSessionTest, SessionHandlesExtendedProtocolFlow) {
       .WillOnce(Return(ByMove(boost::make_ready_future(sql_pipeline->get_result_table().second))));
 
   // It sends the row data (one message per row)
-  EXPECT_CALL(*_connection, send_data_row(_)).Times(3);
+  // All three rows are sent in one packet
+  EXPECT_CALL(*_connection, send_data_rows(_)).Times(1);
 
   // ... and completes the command
   EXPECT_CALL(*_connection, send_command_complete(_));
@@ -374,7 +449,8 @@ TEST_F(ServerSessionTest, SessionSendsErrorWhenRedefiningNamedStatement) {
       send_error(
           "Invalid input error: Named prepared statements must be explicitly closed before they can be redefined."));
 
-  EXPECT_CALL(*_connection, send_ready_for_query());
+  // The ReadyForQuery is only sent for the next Sync
+  _expect_sync();
   EXPECT_CALL(*_connection, receive_packet_header());
 
   _session->start().wait();
@@ -388,16 +464,63 @@ TEST_F(ServerSessionTest, SessionSendsErrorWhenBindingUnknownNamedStatement) {
   RequestHeader bind_request{NetworkMessageType::BindCommand, 42};
   EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(bind_request))));
 
-  BindPacket bind_packet = {"my_named_statement", "", {}};
+  BindPacket bind_packet = {"my_named_statement", "", {}, {}};
   EXPECT_CALL(*_connection, receive_bind_packet_body(42))
       .WillOnce(Return(ByMove(boost::make_ready_future(bind_packet))));
 
   EXPECT_CALL(*_connection, send_error("Invalid input error: The specified statement does not exist."));
 
+  // The ReadyForQuery is only sent for the next Sync
+  _expect_sync();
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+}
+
+TEST_F(ServerSessionTest, NamedStatementsAreLocalToTheSession) {
+  InSequence s;
+
   EXPECT_CALL(*_connection, send_ready_for_query());
+
+  RequestHeader parse_request{NetworkMessageType::ParseCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(parse_request))));
+
+  ParsePacket parse_packet = {"my_named_statement", "SELECT * FROM foo;"};
+  EXPECT_CALL(*_connection, receive_parse_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(parse_packet))));
+
+  auto sql_pipeline = _create_working_sql_pipeline();
+  auto parse_server_prepared_plan_result =
+      std::make_unique<PreparedPlan>(sql_pipeline->get_optimized_logical_plans().front(), std::vector<ParameterID>{});
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ParseServerPreparedStatementTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::move(parse_server_prepared_plan_result)))));
+
+  EXPECT_CALL(*_connection, send_status_message(NetworkMessageType::ParseComplete));
   EXPECT_CALL(*_connection, receive_packet_header());
 
   _session->start().wait();
+
+  // A second session (which may run on another I/O thread) does not know the statement of the first one
+  _connection = std::make_shared<TestConnection>();
+  _configure_default_message_flow();
+  auto second_session = std::make_shared<TestServerSession>(_connection, _task_runner);
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  RequestHeader bind_request{NetworkMessageType::BindCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(bind_request))));
+
+  BindPacket bind_packet = {"my_named_statement", "", {}, {}};
+  EXPECT_CALL(*_connection, receive_bind_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(bind_packet))));
+
+  EXPECT_CALL(*_connection, send_error("Invalid input error: The specified statement does not exist."));
+
+  // The ReadyForQuery is only sent for the next Sync
+  _expect_sync();
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  second_session->start().wait();
 }
 
 TEST_F(ServerSessionTest, SessionSendsErrorWhenRedefiningNamedPortal) {
@@ -426,7 +549,7 @@ TEST_F(ServerSessionTest, SessionSendsErrorWhenRedefiningNamedPortal) {
   RequestHeader bind_request{NetworkMessageType::BindCommand, 42};
   EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(bind_request))));
 
-  BindPacket bind_packet = {"my_named_statement", "my_named_portal", {}};
+  BindPacket bind_packet = {"my_named_statement", "my_named_portal", {}, {}};
   EXPECT_CALL(*_connection, receive_bind_packet_body(42))
       .WillOnce(Return(ByMove(boost::make_ready_future(bind_packet))));
 
@@ -445,10 +568,182 @@ TEST_F(ServerSessionTest, SessionSendsErrorWhenRedefiningNamedPortal) {
   EXPECT_CALL(*_connection,
               send_error("Invalid input error: Named portals must be explicitly closed before they can be redefined."));
 
+  // The ReadyForQuery is only sent for the next Sync
+  _expect_sync();
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+}
+
+TEST_F(ServerSessionTest, SessionDiscardsPipelinedMessagesAfterErrorUntilSync) {
+  InSequence s;
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  // The client pipelines Bind, Execute, and Sync, but the Bind fails
+  RequestHeader bind_request{NetworkMessageType::BindCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(bind_request))));
+
+  BindPacket bind_packet = {"my_named_statement", "", {}, {}};
+  EXPECT_CALL(*_connection, receive_bind_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(bind_packet))));
+
+  EXPECT_CALL(*_connection, send_error("Invalid input error: The specified statement does not exist."));
+
+  // The Execute message is skipped instead of failing for the missing portal
+  RequestHeader execute_request{NetworkMessageType::ExecuteCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(execute_request))));
+  EXPECT_CALL(*_connection, skip_packet_body(42));
+
+  _expect_sync();
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+}
+
+TEST_F(ServerSessionTest, SessionBindsPreparedStatementTemplateWithoutTask) {
+  InSequence s;
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  RequestHeader parse_request{NetworkMessageType::ParseCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(parse_request))));
+
+  ParsePacket parse_packet = {"my_named_statement", "SELECT * FROM foo;"};
+  EXPECT_CALL(*_connection, receive_parse_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(parse_packet))));
+
+  auto sql_pipeline = _create_working_sql_pipeline();
+  auto parse_server_prepared_plan_result =
+      std::make_unique<PreparedPlan>(sql_pipeline->get_unoptimized_logical_plans().front(), std::vector<ParameterID>{});
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ParseServerPreparedStatementTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::move(parse_server_prepared_plan_result)))));
+
+  EXPECT_CALL(*_connection, send_status_message(NetworkMessageType::ParseComplete));
+
+  // The first Bind creates the template of the statement in a task, which is executed right away here
+  RequestHeader bind_request{NetworkMessageType::BindCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(bind_request))));
+
+  BindPacket first_bind_packet = {"my_named_statement", "first_portal", {}, {}};
+  EXPECT_CALL(*_connection, receive_bind_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(first_bind_packet))));
+
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<BindServerPreparedStatementTask>>()))
+      .WillOnce(Invoke([](const std::shared_ptr<BindServerPreparedStatementTask>& task) {
+        auto future = task->get_future();
+        task->execute();
+        return future;
+      }));
+
+  EXPECT_CALL(*_connection, send_status_message(NetworkMessageType::BindComplete));
+
+  // The second Bind only copies the PQP of the template, without dispatching another task
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(bind_request))));
+
+  BindPacket second_bind_packet = {"my_named_statement", "second_portal", {}, {}};
+  EXPECT_CALL(*_connection, receive_bind_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(second_bind_packet))));
+
+  EXPECT_CALL(*_connection, send_status_message(NetworkMessageType::BindComplete));
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+}
+
+TEST_F(ServerSessionTest, SessionCopiesDataFromStdin) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, true}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 2, UseMvcc::Yes);
+  StorageManager::get().add_table("copy_table", table);
+
+  InSequence s;
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  RequestHeader request{NetworkMessageType::SimpleQueryCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(request))));
+
+  EXPECT_CALL(*_connection, receive_simple_query_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::string("COPY copy_table FROM STDIN;")))));
+
+  // The session schedules a CreatePipelineTask which is responsible for detecting the COPY command
+  auto create_pipeline_result = std::make_unique<CreatePipelineResult>();
+  create_pipeline_result->copy_from_stdin = CopyFromStdin{"copy_table", CopyFormat::Text};
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<CreatePipelineTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::move(create_pipeline_result)))));
+
+  EXPECT_CALL(*_connection, send_copy_in_response(CopyFormat::Text, 2u));
+
+  // The first batch of two rows (the chunk size of the table) is parsed as soon as it is complete, even though the
+  // CopyData messages are not aligned with the rows
+  _expect_copy_data("1\tfoo\n2\t");
+  _expect_copy_data("\\N\n3\tb");
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ParseServerCopyDataTask>>()))
+      .WillOnce(Invoke(_execute_task<ParseServerCopyDataTask>));
+  _expect_copy_data("ar\n");
+
+  // The remaining row is parsed after CopyDone, then all rows are appended
+  RequestHeader copy_done_request{NetworkMessageType::CopyDoneCommand, 0};
+  EXPECT_CALL(*_connection, receive_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(copy_done_request))));
+  EXPECT_CALL(*_connection, receive_copy_done_packet_body(0)).WillOnce(Return(ByMove(boost::make_ready_future())));
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ParseServerCopyDataTask>>()))
+      .WillOnce(Invoke(_execute_task<ParseServerCopyDataTask>));
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<AppendServerCopyDataTask>>()))
+      .WillOnce(Invoke(_execute_task<AppendServerCopyDataTask>));
+
+  EXPECT_CALL(*_connection, send_command_complete("COPY 3"));
   EXPECT_CALL(*_connection, send_ready_for_query());
   EXPECT_CALL(*_connection, receive_packet_header());
 
   _session->start().wait();
+
+  const auto expected_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  expected_table->append({1, "foo"});
+  expected_table->append({2, NULL_VALUE});
+  expected_table->append({3, "bar"});
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+}
+
+TEST_F(ServerSessionTest, SessionSendsErrorWhenCopyFails) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 2, UseMvcc::Yes);
+  StorageManager::get().add_table("copy_table", table);
+
+  InSequence s;
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  RequestHeader request{NetworkMessageType::SimpleQueryCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(request))));
+
+  EXPECT_CALL(*_connection, receive_simple_query_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::string("COPY copy_table FROM STDIN;")))));
+
+  auto create_pipeline_result = std::make_unique<CreatePipelineResult>();
+  create_pipeline_result->copy_from_stdin = CopyFromStdin{"copy_table", CopyFormat::Csv};
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<CreatePipelineTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::move(create_pipeline_result)))));
+
+  EXPECT_CALL(*_connection, send_copy_in_response(CopyFormat::Csv, 1u));
+  _expect_copy_data("1\n");
+
+  // The client aborts the COPY, nothing is appended
+  RequestHeader copy_fail_request{NetworkMessageType::CopyFailCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(copy_fail_request))));
+  EXPECT_CALL(*_connection, receive_copy_fail_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::string("canceled")))));
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<AppendServerCopyDataTask>>())).Times(0);
+
+  EXPECT_CALL(*_connection, send_error("Invalid input error: COPY from stdin failed: canceled"));
+  EXPECT_CALL(*_connection, send_ready_for_query());
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+
+  EXPECT_EQ(table->row_count(), 0u);
 }
 
 }  // namespace opossum
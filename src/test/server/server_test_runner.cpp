@@ -14,7 +14,9 @@ namespace opossum {
 
 class /* #1357 */ DISABLED_ServerTestRunner : public BaseTest {
  protected:
-  void SetUp() override {
+  void SetUp() override { _start_server(0); }
+
+  void _start_server(const size_t io_thread_count) {
     StorageManager::get().reset();
 
     _table_a = load_table("resources/test_data/tbl/int_float.tbl", 2);
@@ -28,7 +30,8 @@ class /* #1357 */ DISABLED_ServerTestRunner : public BaseTest {
     auto cv = std::make_shared<std::condition_variable>();
 
     auto server_runner = [&, cv](boost::asio::io_service& io_service) {
-      Server server{io_service, /* port = */ 0};  // run on port 0 so the server can pick a free one
+      // run on port 0 so the server can pick a free one
+      Server server{io_service, /* port = */ 0, io_thread_count};
 
       {
         std::unique_lock<std::mutex> lock{mutex};
@@ -68,6 +71,12 @@ class /* #1357 */ DISABLED_ServerTestRunner : public BaseTest {
   std::shared_ptr<Table> _table_a;
 };
 
+// Runs the sessions on io threads of the server instead of the io_service that accepts the connections
+class /* #1357 */ DISABLED_ThreadedServerTestRunner : public DISABLED_ServerTestRunner {
+ protected:
+  void SetUp() override { _start_server(2); }
+};
+
 TEST_F(/* #1357 */ DISABLED_ServerTestRunner, TestSimpleSelect) {
   pqxx::connection connection{_connection_string};
 
@@ -159,4 +168,34 @@ TEST_F(/* #1357 */ DISABLED_ServerTestRunner, TestParallelConnections) {
   }
 }
 
+TEST_F(/* #1357 */ DISABLED_ThreadedServerTestRunner, TestParallelConnections) {
+  // More connections than io threads, so that each thread serves multiple sessions concurrently. TearDown() then
+  // destroys the server together with its io threads.
+  const std::string sql = "SELECT * FROM table_a;";
+  const auto expected_num_rows = _table_a->row_count();
+
+  const auto connection_run = [&]() {
+    pqxx::connection connection{_connection_string};
+    pqxx::nontransaction transaction{connection};
+    for (auto query_idx = 0; query_idx < 10; ++query_idx) {
+      const auto result = transaction.exec(sql);
+      EXPECT_EQ(result.size(), expected_num_rows);
+    }
+  };
+
+  const auto num_threads = 8u;
+  std::vector<std::future<void>> thread_futures;
+  thread_futures.reserve(num_threads);
+
+  for (auto thread_num = 0u; thread_num < num_threads; ++thread_num) {
+    thread_futures.emplace_back(std::async(std::launch::async, connection_run));
+  }
+
+  for (auto& thread_fut : thread_futures) {
+    if (thread_fut.wait_for(std::chrono::seconds(150)) == std::future_status::timeout) {
+      ASSERT_TRUE(false) << "At least one thread got stuck and did not commit.";
+    }
+  }
+}
+
 }  // namespace opossum
@@ -484,6 +484,68 @@ TEST_F(SQLPipelineStatementTest, GetResultTableJoin) {
   EXPECT_TABLE_EQ_UNORDERED(table, _join_result);
 }
 
+TEST_F(SQLPipelineStatementTest, GetResultTableWithAdaptiveReoptimization) {
+  const auto query =
+      "SELECT t1.a, table_b.b, t2.b FROM table_a AS t1, table_b, table_a AS t2 WHERE t1.a = table_b.a AND "
+      "table_b.a = t2.a";
+
+  auto sql_pipeline = SQLPipelineBuilder{query}.create_pipeline_statement();
+  const auto [pipeline_status, table] = sql_pipeline.get_result_table();
+  EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+
+  // Every deviation from the estimated cardinality triggers a re-optimization
+  auto reoptimized_sql_pipeline =
+      SQLPipelineBuilder{query}.with_reoptimization_threshold(1.0f).create_pipeline_statement();
+  const auto [reoptimized_pipeline_status, reoptimized_table] = reoptimized_sql_pipeline.get_result_table();
+  EXPECT_EQ(reoptimized_pipeline_status, SQLPipelineStatus::Success);
+  EXPECT_GT(reoptimized_sql_pipeline.metrics()->reoptimization_count, 0u);
+  EXPECT_EQ(reoptimized_sql_pipeline.transaction_context()->phase(), TransactionPhase::Committed);
+
+  EXPECT_TABLE_EQ_UNORDERED(reoptimized_table, table);
+}
+
+TEST_F(SQLPipelineStatementTest, GetTasksBeforeAdaptiveReoptimization) {
+  const auto query =
+      "SELECT t1.a, table_b.b, t2.b FROM table_a AS t1, table_b, table_a AS t2 WHERE t1.a = table_b.a AND "
+      "table_b.a = t2.a";
+
+  auto sql_pipeline = SQLPipelineBuilder{query}.with_reoptimization_threshold(1.0f).create_pipeline_statement();
+  const auto initial_physical_plan = sql_pipeline.get_physical_plan();
+  const auto initial_tasks = sql_pipeline.get_tasks();
+  EXPECT_EQ(initial_tasks.back()->get_operator(), initial_physical_plan);
+
+  const auto [pipeline_status, table] = sql_pipeline.get_result_table();
+  EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+  EXPECT_EQ(table->row_count(), 3u);
+
+  // The tasks belong to the plan that replaced the initial one, and the executed joins count as execution
+  const auto& tasks = sql_pipeline.get_tasks();
+  EXPECT_NE(sql_pipeline.get_physical_plan(), initial_physical_plan);
+  EXPECT_EQ(tasks.back()->get_operator(), sql_pipeline.get_physical_plan());
+  EXPECT_EQ(tasks.back()->get_operator()->get_output(), table);
+  EXPECT_GT(sql_pipeline.metrics()->plan_execution_duration.count(), 0);
+}
+
+TEST_F(SQLPipelineStatementTest, GetResultTableWithoutAdaptiveReoptimization) {
+  const auto query =
+      "SELECT t1.a, table_b.b, t2.b FROM table_a AS t1, table_b, table_a AS t2 WHERE t1.a = table_b.a AND "
+      "table_b.a = t2.a";
+
+  // Estimations are never off by this much for these small tables
+  auto sql_pipeline = SQLPipelineBuilder{query}.with_reoptimization_threshold(1'000'000.0f).create_pipeline_statement();
+  const auto [pipeline_status, table] = sql_pipeline.get_result_table();
+  EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+  EXPECT_EQ(sql_pipeline.metrics()->reoptimization_count, 0u);
+  EXPECT_EQ(table->row_count(), 3u);
+
+  // Single joins are not executed adaptively
+  auto join_sql_pipeline =
+      SQLPipelineBuilder{_join_query}.with_reoptimization_threshold(1.0f).create_pipeline_statement();
+  const auto [join_pipeline_status, join_table] = join_sql_pipeline.get_result_table();
+  EXPECT_EQ(join_sql_pipeline.metrics()->reoptimization_count, 0u);
+  EXPECT_TABLE_EQ_UNORDERED(join_table, _join_result);
+}
+
 TEST_F(SQLPipelineStatementTest, GetResultTableWithScheduler) {
   auto sql_pipeline = SQLPipelineBuilder{_join_query}.create_pipeline_statement();
 
@@ -601,6 +663,61 @@ TEST_F(SQLPipelineStatementTest, CacheQueryPlan) {
   EXPECT_TRUE(_lqp_cache->has(_select_query_a));
 }
 
+TEST_F(SQLPipelineStatementTest, CacheQueryPlanPerQueryTemplate) {
+  const auto pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
+
+  auto first_sql_pipeline = SQLPipelineBuilder{"SELECT * FROM table_int WHERE a = 9"}
+                                .with_lqp_cache(_lqp_cache)
+                                .with_pqp_cache(pqp_cache)
+                                .with_query_templates()
+                                .create_pipeline_statement();
+  const auto [first_pipeline_status, first_table] = first_sql_pipeline.get_result_table();
+  EXPECT_EQ(first_pipeline_status, SQLPipelineStatus::Success);
+  EXPECT_FALSE(first_sql_pipeline.metrics()->query_plan_cache_hit);
+
+  auto expected_first_result = std::make_shared<Table>(_int_int_int_column_definitions, TableType::Data);
+  expected_first_result->append({9, 10, 11});
+  expected_first_result->append({9, 10, 9});
+  EXPECT_TABLE_EQ_UNORDERED(first_table, expected_first_result);
+
+  EXPECT_EQ(_lqp_cache->size(), 1u);
+  EXPECT_TRUE(_lqp_cache->has("SELECT * FROM table_int WHERE a = ?"));
+  EXPECT_EQ(pqp_cache->size(), 1u);
+
+  // Only the literal differs, so the cached plan is reused
+  auto second_sql_pipeline = SQLPipelineBuilder{"SELECT * FROM table_int WHERE a = 11"}
+                                 .with_lqp_cache(_lqp_cache)
+                                 .with_pqp_cache(pqp_cache)
+                                 .with_query_templates()
+                                 .create_pipeline_statement();
+  const auto [second_pipeline_status, second_table] = second_sql_pipeline.get_result_table();
+  EXPECT_EQ(second_pipeline_status, SQLPipelineStatus::Success);
+  EXPECT_TRUE(second_sql_pipeline.metrics()->query_plan_cache_hit);
+  EXPECT_EQ(pqp_cache->size(), 1u);
+
+  auto expected_second_result = std::make_shared<Table>(_int_int_int_column_definitions, TableType::Data);
+  expected_second_result->append({11, 10, 11});
+  EXPECT_TABLE_EQ_UNORDERED(second_table, expected_second_result);
+}
+
+TEST_F(SQLPipelineStatementTest, ReoptimizeQueryTemplateForLiterals) {
+  const auto pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
+
+  // Every deviation of the estimation for the literals from the one for the generic plan triggers a re-optimization
+  auto sql_pipeline = SQLPipelineBuilder{"SELECT * FROM table_int WHERE a > 100"}
+                          .with_lqp_cache(_lqp_cache)
+                          .with_pqp_cache(pqp_cache)
+                          .with_query_templates(1.0f)
+                          .create_pipeline_statement();
+  const auto [pipeline_status, table] = sql_pipeline.get_result_table();
+  EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+  EXPECT_TRUE(sql_pipeline.metrics()->reoptimized_for_literals);
+  EXPECT_EQ(table->row_count(), 0u);
+
+  // Re-optimized plans are specific to the literals and not cached
+  EXPECT_EQ(pqp_cache->size(), 0u);
+}
+
 TEST_F(SQLPipelineStatementTest, CopySubselectFromCache) {
   const auto subquery_query = "SELECT * FROM table_int WHERE a = (SELECT MAX(b) FROM table_int)";
 
@@ -0,0 +1,45 @@
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "sql/sql_query_template.hpp"
+
+namespace opossum {
+
+class SQLQueryTemplateTest : public BaseTest {};
+
+TEST_F(SQLQueryTemplateTest, ExtractsComparedLiterals) {
+  const auto query_template = create_sql_query_template(
+      "SELECT * FROM t WHERE a = 5 AND b > 'x''y' AND c BETWEEN 1.5 AND 3000000000 AND d LIKE 'a%'");
+  ASSERT_TRUE(query_template);
+
+  EXPECT_EQ(query_template->sql, "SELECT * FROM t WHERE a = ? AND b > ? AND c BETWEEN ? AND ? AND d LIKE ?");
+  ASSERT_EQ(query_template->parameters.size(), 5u);
+  EXPECT_EQ(query_template->parameters[0], AllTypeVariant{int32_t{5}});
+  EXPECT_EQ(query_template->parameters[1], AllTypeVariant{pmr_string{"x'y"}});
+  EXPECT_EQ(query_template->parameters[2], AllTypeVariant{1.5});
+  EXPECT_EQ(query_template->parameters[3], AllTypeVariant{int64_t{3'000'000'000}});
+  EXPECT_EQ(query_template->parameters[4], AllTypeVariant{pmr_string{"a%"}});
+}
+
+TEST_F(SQLQueryTemplateTest, KeepsOtherLiterals) {
+  const auto query_template = create_sql_query_template(
+      "SELECT a + 1, \"b=2\" FROM t WHERE a = 5 + b AND c <= 3 -- d = 4\n ORDER BY 1 LIMIT 10");
+  ASSERT_TRUE(query_template);
+
+  EXPECT_EQ(query_template->sql,
+            "SELECT a + 1, \"b=2\" FROM t WHERE a = 5 + b AND c <= ? -- d = 4\n ORDER BY 1 LIMIT 10");
+  ASSERT_EQ(query_template->parameters.size(), 1u);
+  EXPECT_EQ(query_template->parameters[0], AllTypeVariant{int32_t{3}});
+}
+
+TEST_F(SQLQueryTemplateTest, NoTemplate) {
+  EXPECT_FALSE(create_sql_query_template("SELECT * FROM t"));
+  EXPECT_FALSE(create_sql_query_template("SELECT * FROM t WHERE a = ? AND b = 5"));
+  EXPECT_FALSE(create_sql_query_template("SELECT * FROM t WHERE a = 'unterminated"));
+  EXPECT_FALSE(create_sql_query_template("INSERT INTO t VALUES (1)"));
+  EXPECT_FALSE(create_sql_query_template("DELETE FROM t WHERE a = 5"));
+}
+
+}  // namespace opossum
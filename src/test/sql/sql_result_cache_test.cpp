@@ -0,0 +1,147 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_manager.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_pipeline_statement.hpp"
+#include "sql/sql_result_cache.hpp"
+#include "storage/storage_manager.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class SQLResultCacheTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+
+    _result_cache = std::make_shared<SQLResultCache>();
+  }
+
+  // Executes the query and returns its result, with the cache hit stored in @param result_cache_hit
+  std::shared_ptr<const Table> execute(const std::string& query, bool& result_cache_hit) {
+    auto sql_pipeline = SQLPipelineBuilder{query}.with_result_cache(_result_cache).create_pipeline_statement();
+    const auto [pipeline_status, table] = sql_pipeline.get_result_table();
+    EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+
+    result_cache_hit = sql_pipeline.metrics()->result_cache_hit;
+    return table;
+  }
+
+  const std::string _query = "SELECT a FROM table_a WHERE a > 1000";
+
+  std::shared_ptr<SQLResultCache> _result_cache;
+};
+
+TEST_F(SQLResultCacheTest, ServeUnchangedResult) {
+  auto result_cache_hit = false;
+  const auto first_result = execute(_query, result_cache_hit);
+  EXPECT_FALSE(result_cache_hit);
+  EXPECT_EQ(first_result->row_count(), 2u);
+  EXPECT_EQ(_result_cache->size(), 1u);
+  EXPECT_GT(_result_cache->memory_usage(), 0u);
+
+  const auto second_result = execute(_query, result_cache_hit);
+  EXPECT_TRUE(result_cache_hit);
+  EXPECT_EQ(second_result, first_result);
+
+  // Equal LQPs share the entry, even if their SQL strings differ
+  execute("SELECT a FROM table_a WHERE a > 1000;", result_cache_hit);
+  EXPECT_TRUE(result_cache_hit);
+
+  execute("SELECT a FROM table_a WHERE a > 100", result_cache_hit);
+  EXPECT_FALSE(result_cache_hit);
+  EXPECT_EQ(_result_cache->size(), 2u);
+}
+
+TEST_F(SQLResultCacheTest, InvalidateOnModification) {
+  auto result_cache_hit = false;
+  execute(_query, result_cache_hit);
+
+  SQLPipelineBuilder{"INSERT INTO table_a VALUES (5000, 1.0)"}.create_pipeline_statement().get_result_table();
+  EXPECT_EQ(StorageManager::get().get_table("table_a")->last_modified_commit_id(),
+            TransactionManager::get().last_commit_id());
+
+  const auto result_after_insert = execute(_query, result_cache_hit);
+  EXPECT_FALSE(result_cache_hit);
+  EXPECT_EQ(result_after_insert->row_count(), 3u);
+
+  SQLPipelineBuilder{"DELETE FROM table_a WHERE a = 5000"}.create_pipeline_statement().get_result_table();
+
+  const auto result_after_delete = execute(_query, result_cache_hit);
+  EXPECT_FALSE(result_cache_hit);
+  EXPECT_EQ(result_after_delete->row_count(), 2u);
+
+  execute(_query, result_cache_hit);
+  EXPECT_TRUE(result_cache_hit);
+}
+
+TEST_F(SQLResultCacheTest, InvalidateOnReplacedTable) {
+  auto result_cache_hit = false;
+  execute(_query, result_cache_hit);
+
+  StorageManager::get().drop_table("table_a");
+  StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_float2.tbl", 2));
+
+  execute(_query, result_cache_hit);
+  EXPECT_FALSE(result_cache_hit);
+}
+
+TEST_F(SQLResultCacheTest, NotVisibleToOlderTransaction) {
+  auto result_cache_hit = false;
+
+  // Starts before the INSERT, so the result computed afterwards must not be served to it
+  const auto old_transaction_context = TransactionManager::get().new_transaction_context();
+
+  SQLPipelineBuilder{"INSERT INTO table_a VALUES (5000, 1.0)"}.create_pipeline_statement().get_result_table();
+  execute(_query, result_cache_hit);
+
+  const auto lqp = SQLPipelineBuilder{_query}.create_pipeline_statement().get_optimized_logical_plan();
+  EXPECT_FALSE(_result_cache->try_get(lqp, old_transaction_context->snapshot_commit_id()));
+  EXPECT_TRUE(_result_cache->try_get(lqp, TransactionManager::get().last_commit_id()));
+}
+
+TEST_F(SQLResultCacheTest, OnlyAutoCommittedReads) {
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  auto sql_pipeline = SQLPipelineBuilder{_query}
+                          .with_result_cache(_result_cache)
+                          .with_transaction_context(transaction_context)
+                          .create_pipeline_statement();
+  sql_pipeline.get_result_table();
+  EXPECT_EQ(_result_cache->size(), 0u);
+
+  auto result_cache_hit = false;
+  execute("INSERT INTO table_a VALUES (5000, 1.0)", result_cache_hit);
+  EXPECT_EQ(_result_cache->size(), 0u);
+
+  auto no_mvcc_sql_pipeline =
+      SQLPipelineBuilder{_query}.with_result_cache(_result_cache).disable_mvcc().create_pipeline_statement();
+  no_mvcc_sql_pipeline.get_result_table();
+  EXPECT_EQ(_result_cache->size(), 0u);
+}
+
+TEST_F(SQLResultCacheTest, MemoryBudget) {
+  auto result_cache_hit = false;
+  execute(_query, result_cache_hit);
+  execute("SELECT b FROM table_a", result_cache_hit);
+  EXPECT_EQ(_result_cache->size(), 2u);
+
+  // Evicts the least recently used result
+  execute(_query, result_cache_hit);
+  _result_cache->set_memory_budget(_result_cache->memory_usage() - 1);
+  EXPECT_EQ(_result_cache->size(), 1u);
+
+  execute(_query, result_cache_hit);
+  EXPECT_TRUE(result_cache_hit);
+
+  // Results larger than the budget are not cached at all
+  _result_cache->set_memory_budget(0);
+  EXPECT_EQ(_result_cache->size(), 0u);
+  execute(_query, result_cache_hit);
+  EXPECT_EQ(_result_cache->size(), 0u);
+}
+
+}  // namespace opossum
@@ -210,4 +210,16 @@ TEST_F(StorageChunkTest, OrderedBy) {
   EXPECT_EQ(chunk->ordered_by(), ordered_by);
 }
 
+TEST_F(StorageChunkTest, ReserveRows) {
+  chunk = std::make_shared<Chunk>(Segments({vs_int, vs_str}));
+
+  // Reservations start after the existing rows and are limited by the maximum size
+  EXPECT_EQ(chunk->reserve_rows(2, 6), std::make_pair(ChunkOffset{3}, ChunkOffset{2}));
+  EXPECT_EQ(chunk->reserve_rows(2, 6), std::make_pair(ChunkOffset{5}, ChunkOffset{1}));
+  EXPECT_EQ(chunk->reserve_rows(2, 6).second, 0u);
+
+  // Reserving does not grow the chunk
+  EXPECT_EQ(chunk->size(), 3u);
+}
+
 }  // namespace opossum
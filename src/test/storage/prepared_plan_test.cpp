@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 
+#include "expression/correlated_parameter_expression.hpp"
 #include "expression/expression_functional.hpp"
 #include "logical_query_plan/aggregate_node.hpp"
 #include "logical_query_plan/dummy_table_node.hpp"
@@ -69,4 +70,20 @@ TEST_F(PreparedPlanTest, Instantiate) {
   EXPECT_LQP_EQ(actual_lqp, expected_lqp);
 }
 
+TEST_F(PreparedPlanTest, InstantiateGeneric) {
+  const auto lqp =
+      PredicateNode::make(between_inclusive_(a_a, placeholder_(ParameterID{0}), placeholder_(ParameterID{1})), node_a);
+  const auto prepared_plan = PreparedPlan{lqp, {ParameterID{0}, ParameterID{1}}};
+  const auto actual_lqp = prepared_plan.instantiate_generic({DataType::Int, DataType::String});
+
+  // The placeholders are replaced by parameters, whose values can be set in the PQP
+  const auto parameter_a = std::make_shared<CorrelatedParameterExpression>(
+      ParameterID{0}, CorrelatedParameterExpression::ReferencedExpressionInfo{DataType::Int, "?"});
+  const auto parameter_b = std::make_shared<CorrelatedParameterExpression>(
+      ParameterID{1}, CorrelatedParameterExpression::ReferencedExpressionInfo{DataType::String, "?"});
+  const auto expected_lqp = PredicateNode::make(between_inclusive_(a_a, parameter_a, parameter_b), node_a);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
 }  // namespace opossum
@@ -186,6 +186,24 @@ TEST_F(StorageTableTest, EmplaceChunkDoesNotReplaceIfNumberOfChunksGreaterOne) {
   EXPECT_EQ(t->chunk_count(), 3u);
 }
 
+TEST_F(StorageTableTest, AppendMutableChunkReservesRows) {
+  const auto mvcc_table = std::make_shared<Table>(column_definitions, TableType::Data, 100, UseMvcc::Yes);
+
+  // Appending single rows does not allocate memory for the entire chunk
+  mvcc_table->append({4, "Hello,"});
+  const auto appended_segment =
+      std::static_pointer_cast<ValueSegment<int32_t>>(mvcc_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  EXPECT_LT(appended_segment->values().capacity(), 100u);
+
+  mvcc_table->append_mutable_chunk(ChunkOffset{100});
+  const auto reserved_chunk = mvcc_table->get_chunk(ChunkID{1});
+  const auto reserved_segment =
+      std::static_pointer_cast<ValueSegment<int32_t>>(reserved_chunk->get_segment(ColumnID{0}));
+  EXPECT_EQ(reserved_chunk->size(), 0u);
+  EXPECT_GE(reserved_segment->values().capacity(), 100u);
+  EXPECT_GE(reserved_chunk->get_scoped_mvcc_data_lock()->tids.capacity(), 100u);
+}
+
 TEST_F(StorageTableTest, ChunkSizeZeroThrows) {
   if (!HYRISE_DEBUG) GTEST_SKIP();
   TableColumnDefinitions column_definitions{};
@@ -25,6 +25,11 @@ TEST_F(LoadServerFileTaskTest, LoadsDifferentFileTypes) {
   bin_task->execute();
   EXPECT_TABLE_EQ_ORDERED(StorageManager::get().get_table("int_float_bin"), int_float_expected);
 
+  auto parquet_task =
+      std::make_shared<LoadServerFileTask>("resources/test_data/parquet/int_float.parquet", "int_float_parquet");
+  parquet_task->execute();
+  EXPECT_TABLE_EQ_ORDERED(StorageManager::get().get_table("int_float_parquet"), int_float_expected);
+
   auto fail_task = std::make_shared<LoadServerFileTask>("unsupport.ed", "unsupported");
   auto future = fail_task->get_future();
   fail_task->execute();